@@ -33,8 +33,14 @@ enum ArielShmemCmd_t {
     ARIEL_SWITCH_POOL = 110,
     ARIEL_NOOP = 128,
     ARIEL_OUTPUT_STATS = 140,
+    ARIEL_INSTRUCTION_BUNDLE = 150,
 };
 
+/* Most accesses one ARIEL_INSTRUCTION_BUNDLE carries; instructions with
+ * more are sent as ARIEL_START_INSTRUCTION, one ARIEL_PERFORM_READ or
+ * ARIEL_PERFORM_WRITE per access and ARIEL_END_INSTRUCTION */
+#define ARIEL_MAX_BUNDLE_ACCESSES 2
+
 struct ArielCommand {
     ArielShmemCmd_t command;
     uint64_t instPtr;
@@ -45,6 +51,16 @@ struct ArielCommand {
             uint32_t instClass;
 	    uint32_t simdElemCount;
         } inst;
+        /* A whole instruction in one command: accesses
+         * [0, numReads) are reads, the next numWrites are writes */
+        struct {
+            uint32_t instClass;
+            uint32_t simdElemCount;
+            uint8_t numReads;
+            uint8_t numWrites;
+            uint32_t size[ARIEL_MAX_BUNDLE_ACCESSES];
+            uint64_t addr[ARIEL_MAX_BUNDLE_ACCESSES];
+        } bundle;
         struct {
             uint64_t vaddr;
             uint64_t alloc_len;
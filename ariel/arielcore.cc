@@ -280,30 +280,21 @@ bool ArielCore::refillQueue() {
             }
             break;
 
-        case ARIEL_START_INSTRUCTION:
-	    if(ARIEL_INST_SP_FP == ac.inst.instClass) {
-		statFPSPIns->addData(1);
+        case ARIEL_INSTRUCTION_BUNDLE:
+            recordInstruction(ac.bundle.instClass, ac.bundle.simdElemCount);
 
-		if(ac.inst.simdElemCount > 1) {
-			statFPSPSIMDIns->addData(1);
-		} else {
-			statFPSPScalarIns->addData(1);
-		}
+            for(uint32_t i = 0; i < ac.bundle.numReads; ++i) {
+                createReadEvent(ac.bundle.addr[i], ac.bundle.size[i]);
+            }
 
-		if(ac.inst.simdElemCount < 32)
-			statFPSPOps->addData(ac.inst.simdElemCount);
-            } else if(ARIEL_INST_DP_FP == ac.inst.instClass) {
-		statFPDPIns->addData(1);
+            for(uint32_t i = ac.bundle.numReads; i < (uint32_t) ac.bundle.numReads + ac.bundle.numWrites; ++i) {
+                createWriteEvent(ac.bundle.addr[i], ac.bundle.size[i]);
+            }
 
-		if(ac.inst.simdElemCount > 1) {
-			statFPDPSIMDIns->addData(1);
-		} else {
-			statFPDPScalarIns->addData(1);
-		}
+            break;
 
-		if(ac.inst.simdElemCount < 16)
-			statFPDPOps->addData(ac.inst.simdElemCount);
-	    }
+        case ARIEL_START_INSTRUCTION:
+            recordInstruction(ac.inst.instClass, ac.inst.simdElemCount);
 
             while(ac.command != ARIEL_END_INSTRUCTION) {
                 ac = tunnel->readMessage(coreID);
@@ -327,9 +318,6 @@ bool ArielCore::refillQueue() {
                 }
             }
 
-            // Add one to our instruction counts
-	    statInstructionCount->addData(1);
-
             break;
 
         case ARIEL_NOOP:
@@ -362,6 +350,35 @@ bool ArielCore::refillQueue() {
 	return true;
 }
 
+void ArielCore::recordInstruction(uint32_t instClass, uint32_t simdElemCount) {
+	if(ARIEL_INST_SP_FP == instClass) {
+		statFPSPIns->addData(1);
+
+		if(simdElemCount > 1) {
+			statFPSPSIMDIns->addData(1);
+		} else {
+			statFPSPScalarIns->addData(1);
+		}
+
+		if(simdElemCount < 32)
+			statFPSPOps->addData(simdElemCount);
+	} else if(ARIEL_INST_DP_FP == instClass) {
+		statFPDPIns->addData(1);
+
+		if(simdElemCount > 1) {
+			statFPDPSIMDIns->addData(1);
+		} else {
+			statFPDPScalarIns->addData(1);
+		}
+
+		if(simdElemCount < 16)
+			statFPDPOps->addData(simdElemCount);
+	}
+
+	// Add one to our instruction counts
+	statInstructionCount->addData(1);
+}
+
 void ArielCore::handleFreeEvent(ArielFreeEvent* rFE) {
 	output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " processing a free event (for virtual address=%" PRIu64 ")\n", coreID, rFE->getVirtualAddress());
 
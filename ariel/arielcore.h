@@ -93,6 +93,7 @@ class ArielCore {
 	private:
 		bool processNextEvent();
 		bool refillQueue();
+		void recordInstruction(uint32_t instClass, uint32_t simdElemCount);
 		uint32_t coreID;
 		uint32_t maxPendingTransactions;
 		Output* output;
@@ -245,52 +245,30 @@ VOID copy(void* dest, const void* input, UINT32 length) {
 	}
 }
 
-VOID WriteInstructionRead(ADDRINT* address, UINT32 readSize, THREADID thr, ADDRINT ip,
-	UINT32 instClass, UINT32 simdOpWidth) {
-
-	const uint64_t addr64 = (uint64_t) address;
-
-        ArielCommand ac;
-
-        ac.command = ARIEL_PERFORM_READ;
-	ac.instPtr = (uint64_t) ip;
-        ac.inst.addr = addr64;
-        ac.inst.size = readSize;
-	ac.inst.instClass = instClass;
-	ac.inst.simdElemCount = simdOpWidth;
-
-        tunnel->writeMessage(thr, ac);
-}
-
-VOID WriteInstructionWrite(ADDRINT* address, UINT32 writeSize, THREADID thr, ADDRINT ip,
-	UINT32 instClass, UINT32 simdOpWidth) {
-
-	const uint64_t addr64 = (uint64_t) address;
+VOID WriteInstructionBundle(THREADID thr, ADDRINT ip, UINT32 instClass, UINT32 simdOpWidth,
+	UINT32 numReads, ADDRINT* readAddr, UINT32 readSize,
+	UINT32 numWrites, ADDRINT* writeAddr, UINT32 writeSize) {
 
 	ArielCommand ac;
 
-        ac.command = ARIEL_PERFORM_WRITE;
+	ac.command = ARIEL_INSTRUCTION_BUNDLE;
 	ac.instPtr = (uint64_t) ip;
-        ac.inst.addr = addr64;
-        ac.inst.size = writeSize;
-	ac.inst.instClass = instClass;
-        ac.inst.simdElemCount = simdOpWidth;
-
-	tunnel->writeMessage(thr, ac);
-}
+	ac.bundle.instClass = instClass;
+	ac.bundle.simdElemCount = simdOpWidth;
+	ac.bundle.numReads = (uint8_t) numReads;
+	ac.bundle.numWrites = (uint8_t) numWrites;
+
+	if(numReads > 0) {
+		ac.bundle.addr[0] = (uint64_t) readAddr;
+		ac.bundle.size[0] = readSize;
+	}
 
-VOID WriteStartInstructionMarker(UINT32 thr, ADDRINT ip) {
-    	ArielCommand ac;
-    	ac.command = ARIEL_START_INSTRUCTION;
-    	ac.instPtr = (uint64_t) ip;
-    	tunnel->writeMessage(thr, ac);
-}
+	if(numWrites > 0) {
+		ac.bundle.addr[numReads] = (uint64_t) writeAddr;
+		ac.bundle.size[numReads] = writeSize;
+	}
 
-VOID WriteEndInstructionMarker(UINT32 thr, ADDRINT ip) {
-    	ArielCommand ac;
-    	ac.command = ARIEL_END_INSTRUCTION;
-    	ac.instPtr = (uint64_t) ip;
-    	tunnel->writeMessage(thr, ac);
+	tunnel->writeMessage(thr, ac);
 }
 
 VOID WriteInstructionReadWrite(THREADID thr, ADDRINT* readAddr, UINT32 readSize,
@@ -299,10 +277,8 @@ VOID WriteInstructionReadWrite(THREADID thr, ADDRINT* readAddr, UINT32 readSize,
 
 	if(enable_output) {
 		if(thr < core_count) {
-			WriteStartInstructionMarker( thr, ip );
-			WriteInstructionRead(  readAddr,  readSize,  thr, ip, instClass, simdOpWidth );
-			WriteInstructionWrite( writeAddr, writeSize, thr, ip, instClass, simdOpWidth );
-			WriteEndInstructionMarker( thr, ip );
+			WriteInstructionBundle( thr, ip, instClass, simdOpWidth,
+				1, readAddr, readSize, 1, writeAddr, writeSize );
 		}
 	}
 }
@@ -312,9 +288,8 @@ VOID WriteInstructionReadOnly(THREADID thr, ADDRINT* readAddr, UINT32 readSize,
 
 	if(enable_output) {
 		if(thr < core_count) {
-			WriteStartInstructionMarker(thr, ip);
-			WriteInstructionRead(  readAddr,  readSize,  thr, ip, instClass, simdOpWidth );
-			WriteEndInstructionMarker(thr, ip);
+			WriteInstructionBundle( thr, ip, instClass, simdOpWidth,
+				1, readAddr, readSize, 0, NULL, 0 );
 		}
 	}
 
@@ -336,9 +311,8 @@ VOID WriteInstructionWriteOnly(THREADID thr, ADDRINT* writeAddr, UINT32 writeSiz
 
 	if(enable_output) {
 		if(thr < core_count) {
-                        WriteStartInstructionMarker(thr, ip);
-                        WriteInstructionWrite(writeAddr, writeSize,  thr, ip, instClass, simdOpWidth);
-                        WriteEndInstructionMarker(thr, ip);
+			WriteInstructionBundle( thr, ip, instClass, simdOpWidth,
+				0, NULL, 0, 1, writeAddr, writeSize );
 		}
 	}
 
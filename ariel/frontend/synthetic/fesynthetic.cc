@@ -0,0 +1,182 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * Synthetic Ariel frontend: writes generated instructions into the Ariel
+ * tunnel instead of running an application under PIN, so the tunnel and
+ * ArielCore can be benchmarked on their own. Use it as the ariel launcher:
+ *
+ *	ariel.addParams({
+ *		"launcher"          : "<libexecdir>/fesynthetic",
+ *		"executable"        : "/bin/true",
+ *		"launchparamcount"  : 2,
+ *		"launchparam0"      : "-n",
+ *		"launchparam1"      : "10000000" })
+ *
+ * Each core gets -n instructions (default 1000000) that cycle through a
+ * load, a store, a read-modify-write and a no-op, striding through a 1MB
+ * region of its own. -u sends every access as its own command between
+ * start and end instruction markers instead of one bundle per instruction.
+ * The other PIN tool arguments Ariel passes are ignored.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <string>
+
+//This must be defined before inclusion of inttypes.h
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+
+#include <sst/elements/ariel/ariel_shmem.h>
+#include <sst/elements/ariel/ariel_inst_class.h>
+
+#undef __STDC_FORMAT_MACROS
+
+using namespace SST::ArielComponent;
+
+#define SYNTHETIC_REGION_SIZE (1024 * 1024)
+#define SYNTHETIC_ACCESS_SIZE 8
+
+static ArielTunnel* tunnel = NULL;
+static uint64_t messages = 0;
+
+static void writeAccess(uint32_t core, ArielShmemCmd_t command, uint64_t ip, uint64_t addr) {
+	ArielCommand ac;
+	ac.command = command;
+	ac.instPtr = ip;
+	ac.inst.addr = addr;
+	ac.inst.size = SYNTHETIC_ACCESS_SIZE;
+	ac.inst.instClass = ARIEL_INST_INT;
+	ac.inst.simdElemCount = 1;
+	tunnel->writeMessage(core, ac);
+	messages++;
+}
+
+static void writeMarker(uint32_t core, ArielShmemCmd_t command, uint64_t ip) {
+	ArielCommand ac;
+	ac.command = command;
+	ac.instPtr = ip;
+	ac.inst.instClass = ARIEL_INST_INT;
+	ac.inst.simdElemCount = 1;
+	tunnel->writeMessage(core, ac);
+	messages++;
+}
+
+static void writeInstruction(uint32_t core, uint64_t ip, uint64_t addr,
+	uint32_t numReads, uint32_t numWrites, bool bundled) {
+
+	if(bundled) {
+		ArielCommand ac;
+		ac.command = ARIEL_INSTRUCTION_BUNDLE;
+		ac.instPtr = ip;
+		ac.bundle.instClass = ARIEL_INST_INT;
+		ac.bundle.simdElemCount = 1;
+		ac.bundle.numReads = (uint8_t) numReads;
+		ac.bundle.numWrites = (uint8_t) numWrites;
+
+		for(uint32_t i = 0; i < numReads + numWrites; ++i) {
+			ac.bundle.addr[i] = addr;
+			ac.bundle.size[i] = SYNTHETIC_ACCESS_SIZE;
+		}
+
+		tunnel->writeMessage(core, ac);
+		messages++;
+	} else {
+		writeMarker(core, ARIEL_START_INSTRUCTION, ip);
+
+		for(uint32_t i = 0; i < numReads; ++i) {
+			writeAccess(core, ARIEL_PERFORM_READ, ip, addr);
+		}
+
+		for(uint32_t i = 0; i < numWrites; ++i) {
+			writeAccess(core, ARIEL_PERFORM_WRITE, ip, addr);
+		}
+
+		writeMarker(core, ARIEL_END_INSTRUCTION, ip);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	std::string tunnelName;
+	uint32_t coreCount = 1;
+	uint64_t instCount = 1000000;
+	bool bundled = true;
+
+	for(int i = 1; i < argc; ++i) {
+		if(0 == strcmp(argv[i], "--")) {
+			break;
+		} else if(0 == strcmp(argv[i], "-p") && i + 1 < argc) {
+			tunnelName = argv[++i];
+		} else if(0 == strcmp(argv[i], "-c") && i + 1 < argc) {
+			coreCount = (uint32_t) strtoul(argv[++i], NULL, 0);
+		} else if(0 == strcmp(argv[i], "-n") && i + 1 < argc) {
+			instCount = strtoull(argv[++i], NULL, 0);
+		} else if(0 == strcmp(argv[i], "-u")) {
+			bundled = false;
+		}
+	}
+
+	if(tunnelName.empty()) {
+		fprintf(stderr, "ARIEL-SYNTHETIC: No tunnel given, use -p <tunnel name>\n");
+		return -1;
+	}
+
+	tunnel = new ArielTunnel(tunnelName);
+
+	struct timeval start;
+	struct timeval end;
+	gettimeofday(&start, NULL);
+
+	for(uint64_t inst = 0; inst < instCount; ++inst) {
+		const uint64_t ip = 0x400000 + (inst % 4) * 4;
+
+		for(uint32_t core = 0; core < coreCount; ++core) {
+			const uint64_t addr = ((uint64_t) (core + 1) * SYNTHETIC_REGION_SIZE) +
+				((inst * SYNTHETIC_ACCESS_SIZE) % SYNTHETIC_REGION_SIZE);
+
+			switch(inst % 4) {
+			case 0:
+				writeInstruction(core, ip, addr, 1, 0, bundled);
+				break;
+			case 1:
+				writeInstruction(core, ip, addr, 0, 1, bundled);
+				break;
+			case 2:
+				writeInstruction(core, ip, addr, 1, 1, bundled);
+				break;
+			default:
+				writeMarker(core, ARIEL_NOOP, ip);
+				break;
+			}
+		}
+	}
+
+	gettimeofday(&end, NULL);
+
+	ArielCommand ac;
+	ac.command = ARIEL_PERFORM_EXIT;
+	ac.instPtr = (uint64_t) 0;
+	tunnel->writeMessage(0, ac);
+
+	delete tunnel;
+
+	const double seconds = (end.tv_sec - start.tv_sec) + ((end.tv_usec - start.tv_usec) / 1.0e6);
+	fprintf(stderr, "ARIEL-SYNTHETIC: Wrote %" PRIu64 " instructions on %" PRIu32 " cores as %" PRIu64
+		" %s commands in %f seconds (%f million instructions/s)\n",
+		instCount * coreCount, coreCount, messages, bundled ? "bundled" : "unbundled", seconds,
+		(seconds > 0) ? (instCount * coreCount) / seconds / 1.0e6 : 0.0);
+
+	return 0;
+}
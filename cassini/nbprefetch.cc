@@ -26,6 +26,7 @@ NextBlockPrefetcher::NextBlockPrefetcher(Component* owner, Params& params) : Cac
 	Simulation::getSimulation()->requireEvent("memHierarchy.MemEvent");
 
 	blockSize = params.find<uint64_t>("cache_line_size", 64);
+	prefetcherID = NodeIDMap::getID("Prefetcher");
 
 	statPrefetchEventsIssued = registerStatistic<uint64_t>("prefetches_issued");
 	statMissEventsProcessed  = registerStatistic<uint64_t>("miss_events_processed");
@@ -50,7 +51,7 @@ void NextBlockPrefetcher::notifyAccess(const CacheListenerNotification& notify)
 			// Create a new read request, we cannot issue a write because the data will get
 			// overwritten and corrupt memory (even if we really do want to do a write)
             		MemEvent* newEv = new MemEvent(parent, nextBlockAddr, nextBlockAddr, GetS);
-            		newEv->setSrc("Prefetcher");
+            		newEv->setSrc(prefetcherID);
             		newEv->setSize(blockSize);
             		newEv->setPrefetchFlag(true);
 			(*(*callbackItr))(newEv);
@@ -42,6 +42,7 @@ class NextBlockPrefetcher : public SST::MemHierarchy::CacheListener {
     private:
 	std::vector<Event::HandlerBase*> registeredCallbacks;
 	uint64_t blockSize;
+	NodeID prefetcherID;
 
 	Statistic<uint64_t>* statPrefetchEventsIssued;
 	Statistic<uint64_t>* statMissEventsProcessed;
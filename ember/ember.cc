@@ -288,6 +288,8 @@ static const ElementInfoParam component_params[] = {
 
     { "motifLog", "Sets a file path to a file where motif execution details are written, empty = no log", "" },
 
+    { "motifReplay", "Lets motifs that support it record one iteration and replay it instead of regenerating it, 0 = off", "1" },
+
     { "Send_bin_width", "Bin width of the send time histogram", "5" },
     { "Compute_bin_width", "Bin width of the compute time histogram", "5" },
     { "Init_bin_width", "Bin width of the init time histogram", "5" },
@@ -351,6 +353,8 @@ static const ElementInfoParam randomgen_params[] = {
 
 static const ElementInfoParam siriustrace_params[] = {
 	{       "arg.traceprefix",              "Sets the trace prefix for loading SIRIUS files", "" },
+	{       "arg.tracefile",                "Sets a packed SIRIUS trace holding all ranks (from sst-siriuspack), used instead of arg.traceprefix", "" },
+	{       "arg.traceblocksize",           "Sets the read size in bytes used when a trace cannot be memory mapped", "65536" },
 	{	NULL,	NULL,	NULL	}
 };
 
@@ -1039,6 +1043,12 @@ static const ElementInfoModule modules[] = {
     {   NULL, NULL, NULL, NULL, NULL, NULL, NULL  }
 };
 
+static const ElementInfoStatistic component_statistics[] = {
+    { "EmberEventPool_hits", "Motif events allocated from the recycling pool", "count", 1},
+    { "EmberEventPool_misses", "Motif events that fell through to the heap", "count", 1},
+    { NULL, NULL, NULL, 0 }
+};
+
 static const ElementInfoComponent components[] = {
     {
         "EmberEngine",
@@ -1048,7 +1058,7 @@ static const ElementInfoComponent components[] = {
         component_params,
         component_ports,
         COMPONENT_CATEGORY_UNCATEGORIZED,
-        NULL
+        component_statistics
     },
     { NULL, NULL, NULL, NULL, NULL, NULL, 0, NULL}
 };
@@ -26,12 +26,16 @@ using namespace SST::Hermes;
 EmberEngine::EmberEngine(SST::ComponentId_t id, SST::Params& params) :
     Component( id ),
 	currentMotif(0),
-	m_motifDone(false)
+	m_motifDone(false),
+	m_recorded(false),
+	m_eventPoolHits(0),
+	m_eventPoolMisses(0)
 {
 	// Get the level of verbosity the user is asking to print out, default is 1
 	// which means don't print much.
 	uint32_t verbosity = (uint32_t) params.find_integer("verbose", 1);
 	m_jobId = params.find_integer("jobId", -1);
+	m_replayEnabled = params.find_integer("motifReplay", 1);
 
 	std::ostringstream prefix;
 	prefix << "@t:" << m_jobId << ":EmberEngine:@p:@l: ";
@@ -83,6 +87,9 @@ EmberEngine::EmberEngine(SST::ComponentId_t id, SST::Params& params) :
 		motifParams[i] = params.find_prefix_params( "motif" + tmp.str() + "." );
 	} 
 
+    m_statEventPoolHits = registerStatistic<uint64_t>("EmberEventPool_hits");
+    m_statEventPoolMisses = registerStatistic<uint64_t>("EmberEventPool_misses");
+
     registerAsPrimaryComponent();
 
     // Init the first Motif
@@ -101,6 +108,8 @@ EmberEngine::EmberEngine(SST::ComponentId_t id, SST::Params& params) :
 }
 
 EmberEngine::~EmberEngine() {
+	clearRecording();
+
 	ApiMap::iterator iter = m_apiMap.begin();
 	for ( ; iter != m_apiMap.end(); ++ iter ) {
 		delete iter->second->api;
@@ -209,6 +218,9 @@ void EmberEngine::finish() {
     }
 
 	m_os->finish();
+
+    m_statEventPoolHits->addData( m_eventPoolHits );
+    m_statEventPoolMisses->addData( m_eventPoolMisses );
 }
 
 void EmberEngine::setup() {
@@ -232,6 +244,61 @@ void EmberEngine::setup() {
 	issueNextEvent(0);
 }
 
+bool EmberEngine::refillQueue() {
+
+	if ( m_recorded && m_generator->replayIteration() ) {
+		output.verbose(CALL_INFO, 4, 0, "Replaying %lu recorded events\n",
+												m_recording.size());
+		for ( size_t i = 0; i < m_recording.size(); i++ ) {
+			m_recording[i].first->rewind( m_recording[i].second );
+			evQueue.push( m_recording[i].first );
+		}
+		return false;
+	}
+
+	bool record = m_replayEnabled && ! m_recorded &&
+							m_generator->recordIteration();
+
+	bool done = m_generator->generate( evQueue );
+
+	if ( record && ! done ) {
+		recordIteration();
+	}
+
+	uint64_t hits, misses;
+	EmberEventPool::drainStats( hits, misses );
+	m_eventPoolHits += hits;
+	m_eventPoolMisses += misses;
+
+	return done;
+}
+
+// Events are only queued while the queue is empty, so everything in it
+// came from the generate() call just made
+void EmberEngine::recordIteration() {
+	size_t count = evQueue.size();
+	m_recording.reserve( count );
+
+	for ( size_t i = 0; i < count; i++ ) {
+		EmberEvent* ev = evQueue.front();
+		evQueue.pop();
+		ev->setPersistent();
+		m_recording.push_back( std::make_pair( ev, ev->state() ) );
+		evQueue.push( ev );
+	}
+
+	output.verbose(CALL_INFO, 2, 0, "Recorded %lu events for replay\n", count);
+	m_recorded = true;
+}
+
+void EmberEngine::clearRecording() {
+	for ( size_t i = 0; i < m_recording.size(); i++ ) {
+		delete m_recording[i].first;
+	}
+	m_recording.clear();
+	m_recorded = false;
+}
+
 void EmberEngine::issueNextEvent(uint64_t nanoDelay) {
 
     output.verbose(CALL_INFO, 8, 0, "Engine issuing next event with delay %" PRIu64 "\n", nanoDelay);
@@ -249,6 +316,7 @@ void EmberEngine::issueNextEvent(uint64_t nanoDelay) {
 	            primaryComponentOKToEndSim();
             }
             delete m_generator;
+            clearRecording();
 
             if ( ++currentMotif == motifParams.size() ) {
                 return;
@@ -274,7 +342,8 @@ bool EmberEngine::completeFunctor( int retval, EmberEvent* ev )
     output.verbose(CALL_INFO, 2, 0, "%s %s Event\n", 
               ev->stateName( ev->state() ).c_str(), ev->getName().c_str());
 
-    if ( ev->complete( getCurrentSimTimeNano(), retval ) ) {
+    if ( ev->complete( getCurrentSimTimeNano(), retval ) &&
+                                                ! ev->persistent() ) {
         delete ev;
     }  
 
@@ -307,7 +376,8 @@ void EmberEngine::handleEvent(Event* ev) {
         break;
 
       case EmberEvent::Complete:
-        if ( eEv->complete( getCurrentSimTimeNano() ) ) {
+        if ( eEv->complete( getCurrentSimTimeNano() ) &&
+                                                ! eEv->persistent() ) {
             delete ev;
         }
 	    issueNextEvent(0);
@@ -25,6 +25,7 @@
 
 #include "embermotiflog.h"
 #include "embergen.h"
+#include "emberevent.h"
 
 namespace SST {
 namespace Ember {
@@ -50,9 +51,9 @@ public:
 	Hermes::NodePerf* getNodePerf( ) { return m_nodePerf; } 
 
 private:
-	bool refillQueue() {
-		return m_generator->generate( evQueue );
-	}
+	bool refillQueue();
+	void recordIteration();
+	void clearRecording();
 	void handleEvent(SST::Event* ev);
 	void issueNextEvent(uint64_t nanoSecDelay);
     bool completeFunctor( int retval, EmberEvent* ev ); 
@@ -78,9 +79,19 @@ private:
 
 	std::queue<EmberEvent*> evQueue;
 
+	// events of the recorded iteration and the state each one starts in
+	typedef std::vector< std::pair< EmberEvent*, EmberEvent::State > > Recording;
+	Recording   m_recording;
+	bool        m_recorded;
+	bool        m_replayEnabled;
+
     Hermes::NodePerf*   m_nodePerf;
 	EmberGenerator*     m_generator;
 	SST::Link*          selfEventLink;
+	uint64_t            m_eventPoolHits;
+	uint64_t            m_eventPoolMisses;
+	Statistic<uint64_t>* m_statEventPoolHits;
+	Statistic<uint64_t>* m_statEventPoolMisses;
 	SST::TimeConverter* nanoTimeConverter;
 	EmberMotifLog*      m_motifLogger;
 
@@ -33,6 +33,81 @@ typedef Hermes::MP::Functor FOO;
 
 typedef Statistic<uint32_t> EmberEventTimeStatistic;
 
+/*
+ *  Recycling allocator for EmberEvents
+ *  Motifs allocate a fresh event for every call they enqueue and the engine
+ *  deletes it once it completes. The storage is kept on per-thread free
+ *  lists, one per 16-byte size class, so the next generate() reuses it.
+ *  Free lists are bounded; anything beyond the bound goes back to the heap.
+ *  Hits/misses are counted per thread; the engine drains them after each
+ *  refill of its event queue and records them at finish().
+ */
+class EmberEventPool {
+public:
+    /** Allocate storage for an object of 'size' bytes */
+    static void* allocate(size_t size) {
+        size_t sc = sizeClass(size);
+        PoolState &s = state();
+        if (sc < NUM_CLASSES && s.heads[sc] != NULL) {
+            FreeNode * node = s.heads[sc];
+            s.heads[sc] = node->next;
+            s.counts[sc]--;
+            s.hits++;
+            return node;
+        }
+        s.misses++;
+        return ::operator new(sc < NUM_CLASSES ? (sc + 1) * CLASS_BYTES : size);
+    }
+
+    /** Return storage previously obtained from allocate() */
+    static void release(void * ptr, size_t size) {
+        if (ptr == NULL) return;
+        size_t sc = sizeClass(size);
+        PoolState &s = state();
+        if (sc >= NUM_CLASSES || s.counts[sc] >= MAX_FREE_PER_CLASS) {
+            ::operator delete(ptr);
+            return;
+        }
+        FreeNode * node = static_cast<FreeNode*>(ptr);
+        node->next = s.heads[sc];
+        s.heads[sc] = node;
+        s.counts[sc]++;
+    }
+
+    /** Return hits/misses on this thread since the last call, and reset them */
+    static void drainStats(uint64_t &hits, uint64_t &misses) {
+        PoolState &s = state();
+        hits = s.hits;
+        misses = s.misses;
+        s.hits = 0;
+        s.misses = 0;
+    }
+
+private:
+    static const size_t CLASS_BYTES = 16;
+    static const size_t NUM_CLASSES = 32;           // Objects up to 512 bytes are pooled
+    static const size_t MAX_FREE_PER_CLASS = 4096;
+
+    struct FreeNode {
+        FreeNode * next;
+    };
+
+    /* Plain-old-data so it can live in thread-local storage */
+    struct PoolState {
+        FreeNode *  heads[NUM_CLASSES];
+        size_t      counts[NUM_CLASSES];
+        uint64_t    hits;
+        uint64_t    misses;
+    };
+
+    static size_t sizeClass(size_t size) { return (size - 1) / CLASS_BYTES; }
+
+    static PoolState& state() {
+        static __thread PoolState s;
+        return s;
+    }
+};
+
 class EmberEvent : public SST::Event {
 
 public:
@@ -42,15 +117,32 @@ public:
     } m_state;
 
 	EmberEvent( Output* output, EmberEventTimeStatistic* stat = NULL) :
-        m_state(Issue), m_output(output), m_evStat(stat), m_completeDelayNS(0)
+        m_state(Issue), m_output(output), m_evStat(stat), m_completeDelayNS(0),
+        m_persistent(false)
 	{}
 	EmberEvent( ) : 
-        m_state(Issue), m_output(NULL), m_evStat(NULL), m_completeDelayNS(0) {}
+        m_state(Issue), m_output(NULL), m_evStat(NULL), m_completeDelayNS(0),
+        m_persistent(false) {}
 	~EmberEvent() {} 
 
+    // every EmberEvent subclass is allocated from EmberEventPool, the sized
+    // delete gets the size of the most derived type
+    static void* operator new( size_t size ) {
+        return EmberEventPool::allocate( size );
+    }
+    static void operator delete( void* ptr, size_t size ) {
+        EmberEventPool::release( ptr, size );
+    }
+
 	virtual std::string getName() { return "?????"; };
 
     State state() { return m_state; }
+
+    // A persistent event belongs to the engine's replay recording, it is
+    // not deleted when it completes and is rewound before it is reissued
+    bool persistent() { return m_persistent; }
+    void setPersistent() { m_persistent = true; }
+    void rewind( State state ) { m_state = state; }
     std::string stateName( State i ) { return m_enumName[i]; }
 
     virtual void issue( uint64_t time, FOO* = NULL ) {
@@ -86,6 +178,7 @@ public:
     EmberEventTimeStatistic*  m_evStat;
     uint64_t            m_completeDelayNS;
     uint64_t            m_issueTime;
+    bool                m_persistent;
     
     NotSerializable(EmberEvent)
 };
@@ -50,6 +50,18 @@ class EmberGenerator : public SubComponent {
 
     virtual bool primary( ) { return true; }
 
+    // Motifs whose generate() queues the same events on every iteration
+    // can have the engine record one iteration and replay it.
+    // recordIteration() is asked before generate() while nothing is
+    // recorded; returning true keeps the events of that call for replay.
+    virtual bool recordIteration() { return false; }
+
+    // Asked in place of generate() once an iteration is recorded. Returning
+    // true replays it, so the motif must advance its own state as that
+    // generate() call would have; it must not be the last iteration.
+    // Returning false falls back to generate().
+    virtual bool replayIteration() { return false; }
+
   protected:
 
     Output& getOutput() { return *m_output; }
@@ -115,6 +115,9 @@ public:
 
 protected:
 
+    // replay skips generate(), and with it the spyplot accounting
+    bool replaySafe() { return m_spyplotMode == EMBER_SPYPLOT_NONE; }
+
 	void getPosition( int32_t rank, int32_t px, int32_t py, int32_t pz, 
 					int32_t* myX, int32_t* myY, int32_t* myZ );	
 	void getPosition( int32_t rank, int32_t px, int32_t py,
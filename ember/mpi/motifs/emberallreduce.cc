@@ -51,3 +51,16 @@ bool EmberAllreduceGenerator::generate( std::queue<EmberEvent*>& evQ) {
     }
     return false;
 }
+
+// the first and last iterations also read the clock, record one in between
+bool EmberAllreduceGenerator::recordIteration() {
+    return replaySafe() && 1 == m_loopIndex && m_loopIndex + 1 < m_iterations;
+}
+
+bool EmberAllreduceGenerator::replayIteration() {
+    if ( m_loopIndex + 1 >= m_iterations ) {
+        return false;
+    }
+    ++m_loopIndex;
+    return true;
+}
@@ -23,6 +23,8 @@ class EmberAllreduceGenerator : public EmberMessagePassingGenerator {
 public:
 	EmberAllreduceGenerator(SST::Component* owner, Params& params);
     bool generate( std::queue<EmberEvent*>& evQ);
+    bool recordIteration();
+    bool replayIteration();
 
 private:
     uint64_t  m_startTime;
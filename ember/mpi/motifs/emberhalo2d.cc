@@ -181,3 +181,17 @@ bool EmberHalo2DGenerator::generate( std::queue<EmberEvent*>& evQ) {
         return false;
     }
 }
+
+// every iteration queues the same events, the last one is generated so
+// generate() can report the motif done
+bool EmberHalo2DGenerator::replayIteration() {
+    if ( m_loopIndex + 1 >= iterations ) {
+        return false;
+    }
+
+    verbose(CALL_INFO, 2, 0, "Halo 2D motif replaying loopIndex %" PRIu32 "\n", m_loopIndex);
+
+    messageCount += sendEast + sendWest + sendNorth + sendSouth;
+    ++m_loopIndex;
+    return true;
+}
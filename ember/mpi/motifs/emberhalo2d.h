@@ -24,6 +24,8 @@ public:
 	EmberHalo2DGenerator(SST::Component* owner, Params& params);
 	void configure();
     bool generate( std::queue<EmberEvent*>& evQ);
+    bool recordIteration() { return replaySafe(); }
+    bool replayIteration();
 	void completed(const SST::Output* output, uint64_t );
 
 private:
@@ -255,3 +255,18 @@ bool EmberHalo3DGenerator::generate( std::queue<EmberEvent*>& evQ )
     }
 
 }
+
+// every iteration queues the same events, the recorded one keeps its
+// MessageRequests; the last iteration is generated so generate() can
+// report the motif done
+bool EmberHalo3DGenerator::replayIteration()
+{
+    if ( m_loopIndex + 1 >= iterations ) {
+        return false;
+    }
+
+    verbose(CALL_INFO, 1, 0, "loop=%d (replay)\n", m_loopIndex );
+
+    ++m_loopIndex;
+    return true;
+}
@@ -25,6 +25,8 @@ public:
 	~EmberHalo3DGenerator() {}
 	void configure();
 	bool generate( std::queue<EmberEvent*>& evQ );
+	bool recordIteration() { return replaySafe(); }
+	bool replayIteration();
 
 private:
 	uint32_t m_loopIndex;
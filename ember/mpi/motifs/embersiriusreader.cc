@@ -0,0 +1,194 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+
+#include "embersiriusreader.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+
+#include "sirius/siriusglobals.h"
+
+using namespace SST::Ember;
+
+EmberSIRIUSTraceReader::EmberSIRIUSTraceReader(size_t blockSize) :
+	blockSize(blockSize),
+	mapping(NULL),
+	mappingLen(0),
+	mapped(NULL),
+	file(NULL),
+	bufferPos(0),
+	bufferLen(0),
+	length(0),
+	pos(0)
+{
+}
+
+EmberSIRIUSTraceReader::~EmberSIRIUSTraceReader() {
+	close();
+}
+
+void EmberSIRIUSTraceReader::close() {
+	if( NULL != mapping ) {
+		munmap(mapping, mappingLen);
+		mapping = NULL;
+		mapped = NULL;
+	}
+
+	if( NULL != file ) {
+		fclose(file);
+		file = NULL;
+	}
+
+	std::vector<char>().swap(buffer);
+	bufferPos = bufferLen = 0;
+	length = pos = 0;
+}
+
+bool EmberSIRIUSTraceReader::openFile(const std::string& path, std::string& error) {
+	FILE* newFile = fopen(path.c_str(), "rb");
+
+	if( NULL == newFile ) {
+		error = "unable to open " + path + ": " + strerror(errno);
+		return false;
+	}
+
+	struct stat info;
+	if( 0 != fstat(fileno(newFile), &info) ) {
+		error = "unable to stat " + path + ": " + strerror(errno);
+		fclose(newFile);
+		return false;
+	}
+
+	return openRange(newFile, path, 0, info.st_size, error);
+}
+
+bool EmberSIRIUSTraceReader::openPacked(const std::string& path, uint32_t rank,
+	std::string& error) {
+
+	FILE* newFile = fopen(path.c_str(), "rb");
+
+	if( NULL == newFile ) {
+		error = "unable to open " + path + ": " + strerror(errno);
+		return false;
+	}
+
+	uint64_t magic = 0;
+	uint32_t header[2] = { 0, 0 };
+
+	if( 1 != fread(&magic, sizeof(magic), 1, newFile) ||
+		1 != fread(header, sizeof(header), 1, newFile) ||
+		SIRIUS_PACK_MAGIC != magic ) {
+
+		error = path + " is not a packed SIRIUS trace";
+		fclose(newFile);
+		return false;
+	}
+
+	const uint32_t rankCount = header[0];
+	if( rank >= rankCount ) {
+		char msg[64];
+		snprintf(msg, sizeof(msg), " holds %" PRIu32 " ranks, not rank %" PRIu32,
+			rankCount, rank);
+		error = path + msg;
+		fclose(newFile);
+		return false;
+	}
+
+	uint64_t entry[2];
+	if( 0 != fseeko(newFile, SIRIUS_PACK_HEADER_SIZE +
+			(off_t) rank * SIRIUS_PACK_INDEX_ENTRY_SIZE, SEEK_SET) ||
+		1 != fread(entry, sizeof(entry), 1, newFile) ) {
+
+		error = "unable to read the index of " + path;
+		fclose(newFile);
+		return false;
+	}
+
+	return openRange(newFile, path, entry[0], entry[1], error);
+}
+
+bool EmberSIRIUSTraceReader::openRange(FILE* newFile, const std::string& path,
+	uint64_t offset, uint64_t len, std::string& error) {
+
+	close();
+	length = len;
+
+	if( 0 == len ) {
+		fclose(newFile);
+		return true;
+	}
+
+	// mmap wants a page aligned offset
+	const uint64_t page = sysconf(_SC_PAGESIZE);
+	const uint64_t start = offset - (offset % page);
+	const size_t mapLen = (size_t) (offset - start + len);
+
+	void* addr = mmap(NULL, mapLen, PROT_READ, MAP_PRIVATE, fileno(newFile), start);
+
+	if( MAP_FAILED != addr ) {
+#ifdef MADV_SEQUENTIAL
+		madvise(addr, mapLen, MADV_SEQUENTIAL);
+#endif
+		mapping = (char*) addr;
+		mappingLen = mapLen;
+		mapped = mapping + (offset - start);
+		fclose(newFile);
+		return true;
+	}
+
+	if( 0 != fseeko(newFile, (off_t) offset, SEEK_SET) ) {
+		error = "unable to seek in " + path + ": " + strerror(errno);
+		fclose(newFile);
+		length = 0;
+		return false;
+	}
+
+	// we do our own blocking
+	setvbuf(newFile, NULL, _IONBF, 0);
+	file = newFile;
+	buffer.resize(blockSize);
+	return true;
+}
+
+bool EmberSIRIUSTraceReader::readBuffered(char* dest, size_t len) {
+	while( len > 0 ) {
+		if( bufferPos == bufferLen ) {
+			const size_t want = (size_t) std::min<uint64_t>(buffer.size(),
+				remaining());
+
+			bufferLen = fread(&buffer[0], 1, want, file);
+			bufferPos = 0;
+
+			if( 0 == bufferLen ) {
+				return false;
+			}
+		}
+
+		const size_t n = std::min(len, bufferLen - bufferPos);
+		memcpy(dest, &buffer[bufferPos], n);
+
+		bufferPos += n;
+		pos += n;
+		dest += n;
+		len -= n;
+	}
+
+	return true;
+}
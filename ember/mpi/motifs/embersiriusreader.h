@@ -0,0 +1,87 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_EMBER_SIRIUS_READER
+#define _H_EMBER_SIRIUS_READER
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Ember {
+
+/*
+ * Reads one rank's SIRIUS trace, either a whole per-rank file or that
+ * rank's slice of a packed container (see siriusglobals.h).
+ *
+ * The slice is mapped and the descriptor closed straight away, so a large
+ * job does not hold one descriptor per rank and fields are decoded from
+ * memory instead of one fread each. If the file cannot be mapped it is
+ * read in blocks of blockSize bytes instead; that keeps its descriptor
+ * open until the reader is closed.
+ */
+class EmberSIRIUSTraceReader {
+public:
+	EmberSIRIUSTraceReader(size_t blockSize);
+	~EmberSIRIUSTraceReader();
+
+	// Both return false and set error on failure
+	bool openFile(const std::string& path, std::string& error);
+	bool openPacked(const std::string& path, uint32_t rank, std::string& error);
+	void close();
+
+	bool read(void* dest, size_t len) {
+		if( len > remaining() ) {
+			return false;
+		}
+
+		if( NULL != mapped ) {
+			memcpy(dest, mapped + pos, len);
+			pos += len;
+			return true;
+		}
+
+		return readBuffered((char*) dest, len);
+	}
+
+	uint64_t remaining() const { return length - pos; }
+
+private:
+	bool openRange(FILE* file, const std::string& path, uint64_t offset,
+		uint64_t len, std::string& error);
+	bool readBuffered(char* dest, size_t len);
+
+	size_t blockSize;
+
+	// mapped case
+	char* mapping;
+	size_t mappingLen;
+	const char* mapped;
+
+	// buffered case
+	FILE* file;
+	std::vector<char> buffer;
+	size_t bufferPos;
+	size_t bufferLen;
+
+	uint64_t length;
+	uint64_t pos;
+};
+
+}
+}
+
+#endif
@@ -24,20 +24,32 @@ EmberSIRIUSTraceGenerator::EmberSIRIUSTraceGenerator(SST::Component* owner,
 	EmberMessagePassingGenerator(owner, params, "SIRIUSTrace")
 {
 	std::string trace_prefix = params.find_string("arg.traceprefix", "");
+	std::string packed_trace = params.find_string("arg.tracefile", "");
+	uint64_t block_size = (uint64_t) params.find_integer("arg.traceblocksize", 65536);
 
-	if( "" == trace_prefix ) {
+	traceReader = new EmberSIRIUSTraceReader(block_size);
+	std::string error;
+
+	if( "" != packed_trace ) {
+		if( ! traceReader->openPacked(packed_trace, rank(), error) ) {
+			fatal(CALL_INFO, -1, "Error: unable to open SIRIUS trace: %s\n", error.c_str());
+		} else {
+			verbose(CALL_INFO, 1, 0, "Successfully opened rank %d of packed SIRIUS trace: %s\n",
+				rank(), packed_trace.c_str());
+		}
+	} else if( "" == trace_prefix ) {
 		fatal(CALL_INFO, -1, "Error: trace prefix is empty, no way to load a trace!\n");
 	} else {
 		char* full_trace = (char*) malloc( sizeof(char) * PATH_MAX );
 		sprintf(full_trace, "%s.%d", trace_prefix.c_str(), rank());
 
-		trace_file = fopen(full_trace, "rb");
-
-		if( NULL == trace_file ) {
-			fatal(CALL_INFO, -1, "Error: unable to open SIRIUS trace: %s\n", full_trace);
+		if( ! traceReader->openFile(full_trace, error) ) {
+			fatal(CALL_INFO, -1, "Error: unable to open SIRIUS trace: %s\n", error.c_str());
 		} else {
 			verbose(CALL_INFO, 1, 0, "Successfully opened SIRIUS trace: %s\n", full_trace);
 		}
+
+		free(full_trace);
 	}
 
 	currentTraceTime = 0;
@@ -53,9 +65,7 @@ EmberSIRIUSTraceGenerator::EmberSIRIUSTraceGenerator(SST::Component* owner,
 }
 
 EmberSIRIUSTraceGenerator::~EmberSIRIUSTraceGenerator() {
-	if( NULL != trace_file ) {
-		fclose(trace_file);
-	}
+	delete traceReader;
 }
 
 void EmberSIRIUSTraceGenerator::enqueueCompute( std::queue<EmberEvent*>& evQ,
@@ -442,62 +452,39 @@ void EmberSIRIUSTraceGenerator::readMPIFinalize( std::queue<EmberEvent*>& evQ )
 	// there is a Fini motif for this work
 }
 
-double EmberSIRIUSTraceGenerator::readTime() const {
-	double tmp = 0;
-	size_t readLen = fread(&tmp, sizeof(tmp), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace, size read %" PRIu64 " != %" PRIu64 "\n",
-			(uint64_t) readLen, (uint64_t) sizeof(tmp));
+void EmberSIRIUSTraceGenerator::readBytes(void* dest, size_t len) const {
+	if( ! traceReader->read(dest, len) ) {
+		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace, wanted %" PRIu64 " bytes, %" PRIu64 " left\n",
+			(uint64_t) len, traceReader->remaining());
 	}
+}
 
+double EmberSIRIUSTraceGenerator::readTime() const {
+	double tmp = 0;
+	readBytes(&tmp, sizeof(tmp));
 	return tmp;
 }
 
 uint32_t EmberSIRIUSTraceGenerator::readUINT32() const {
 	uint32_t tmp = 0;
-	size_t readLen = fread(&tmp, sizeof(tmp), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace, size read %" PRIu64 " != %" PRIu64 "\n",
-			(uint64_t) readLen, (uint64_t) sizeof(tmp));
-	}
-
+	readBytes(&tmp, sizeof(tmp));
 	return tmp;
 }
 
 uint64_t EmberSIRIUSTraceGenerator::readUINT64() const {
 	uint64_t tmp = 0;
-	size_t readLen = fread(&tmp, sizeof(tmp), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace, size read %" PRIu64 " != %" PRIu64 "\n",
-			(uint64_t) readLen, (uint64_t) sizeof(tmp));
-	}
-
+	readBytes(&tmp, sizeof(tmp));
 	return tmp;
 }
 
 int32_t EmberSIRIUSTraceGenerator::readINT32() const {
 	int32_t tmp = 0;
-	size_t readLen = fread(&tmp, sizeof(tmp), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace, size read %" PRIu64 " != %" PRIu64 "\n",
-			(uint64_t) readLen, (uint64_t) sizeof(tmp));
-	}
-
+	readBytes(&tmp, sizeof(tmp));
 	return tmp;
 }
 
 const Communicator* EmberSIRIUSTraceGenerator::readCommunicator() const {
-	uint32_t comm;
-
-	size_t readLen = fread(&comm, sizeof(comm), 1, trace_file);
-
-        if( 1 != readLen ) {
-                fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace.\n");
-        }
+	const uint32_t comm = readUINT32();
 
 	if( 0 == comm ) {
 		return &GroupWorld;
@@ -515,13 +502,7 @@ const Communicator* EmberSIRIUSTraceGenerator::readCommunicator() const {
 }
 
 PayloadDataType EmberSIRIUSTraceGenerator::readDataType() const {
-	uint32_t dType;
-
-	size_t readLen = fread(&dType, sizeof(dType), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace.\n");
-	}
+	const uint32_t dType = readUINT32();
 
 	switch(dType) {
 	case SIRIUS_MPI_INTEGER:
@@ -566,13 +547,7 @@ size_t EmberSIRIUSTraceGenerator::getTypeElementSize(const PayloadDataType dType
 }
 
 ReductionOperation EmberSIRIUSTraceGenerator::readReductionOp() const {
-	uint32_t opType;
-
-	size_t readLen = fread(&opType, sizeof(opType), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace.\n");
-	}
+	const uint32_t opType = readUINT32();
 
 	switch(opType) {
 	case SIRIUS_MPI_SUM:
@@ -17,6 +17,7 @@
 #include <unordered_map>
 
 #include "sirius/siriusglobals.h"
+#include "embersiriusreader.h"
 
 namespace SST {
 namespace Ember {
@@ -38,11 +39,12 @@ public:
 	}
 
 private:
-	FILE* trace_file;
+	EmberSIRIUSTraceReader* traceReader;
 	std::unordered_map<uint32_t, Communicator*> communicatorMap;
 	std::unordered_map<uint64_t, MessageRequest*> liveRequests;
 	double currentTraceTime;
 
+	void readBytes(void* dest, size_t len) const;
 	double readTime() const;
 	uint32_t readUINT32() const;
 	uint64_t readUINT64() const;
@@ -53,3 +53,11 @@
 #define SIRIUS_MPI_MIN 17
 
 #define SIRIUS_MPI_REQUEST_NULL UINT64_MAX
+
+// A packed trace holds the traces of many ranks in one file:
+//   uint64 SIRIUS_PACK_MAGIC, uint32 rank count, uint32 zero,
+//   rank count x { uint64 offset, uint64 length } (offsets from file start),
+//   followed by each rank's trace exactly as it would be in its own file.
+#define SIRIUS_PACK_MAGIC 0x4B50535549524953ULL
+#define SIRIUS_PACK_HEADER_SIZE 16
+#define SIRIUS_PACK_INDEX_ENTRY_SIZE 16
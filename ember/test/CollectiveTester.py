@@ -0,0 +1,92 @@
+#! /usr/bin/env python
+
+# Sweeps the Firefly collective algorithms (allreduceAlgorithm and
+# bcastAlgorithm) over power-of-two and non-power-of-two rank counts.
+# The large counts are big enough that rabenseifner and ring do not fall
+# back to recursive doubling.
+
+import sys,os
+from subprocess import call
+import CrossProduct
+from CrossProduct import *
+import hashlib
+import binascii
+
+config = "emberLoad.py"
+
+tests = []
+networks = []
+
+net = { 'topo' : 'torus',
+        'args' : [
+                    [ '--shape', ['4x4x4'] ],
+                    [ '--numNodes', ['2','3','8','13','16','27'] ],
+                    [ '--allreduceAlgorithm', ['recursive_doubling','rabenseifner','ring'] ]
+                 ]
+      }
+
+networks.append(net);
+
+net = { 'topo' : 'torus',
+        'args' : [
+                    [ '--shape', ['4x4x4'] ],
+                    [ '--numNodes', ['2','3','8','13','16','27'] ],
+                    [ '--bcastAlgorithm', ['scatter_allgather'] ]
+                 ]
+      }
+
+networks.append(net);
+
+test = { 'motif' : 'Allreduce',
+         'args'  : [
+                        [ 'iterations'  , ['1','10']],
+                        [ 'count' , ['1','100000']]
+                   ]
+        }
+
+tests.append( test )
+
+test = { 'motif' : 'Barrier',
+         'args'  : [
+                        [ 'iterations'  , ['1','10']]
+                   ]
+        }
+
+tests.append( test )
+
+test = { 'motif' : 'Bcast',
+         'args'  : [
+                        [ 'iterations'  , ['1','10']],
+                        [ 'count' , ['1','100000']],
+                        [ 'root' , ['0','1']]
+                   ]
+        }
+
+tests.append( test )
+
+for network in networks :
+    for test in tests :
+        for x in CrossProduct( network['args'] ) :
+            for y in CrossProduct( test['args'] ):
+                hash_object  = hashlib.md5(b"sst --model-options=\"--topo={0} {1} --cmdLine=\\\"Init\\\" --cmdLine=\\\"{2} {3}\\\" --cmdLine=\\\"Fini\\\"\" {4}".format(network['topo'], x, test['motif'], y, config))
+                hex_dig = hash_object.hexdigest()
+                print "test_SweepCollectives_" + hex_dig + "() {"
+                print "echo \"    \" {0} {1} {2} {3}".format(network['topo'], x, test['motif'], y)
+                print "pushd $SST_ROOT/sst/elements/ember/test"
+                print "sst --model-options=\"--topo={0} {1} --cmdLine=\\\"Init\\\" --cmdLine=\\\"{2} {3}\\\" --cmdLine=\\\"Fini\\\"\" {4} > tmp_file".format(network['topo'], x, test['motif'], y, config)
+                print "grep Simulation.is.complete tmp_file > outFile "
+                print "TL=`grep Simulation.is.complete tmp_file`"
+                print "echo $TL"
+                print "echo {0}   $TL >> $SST_TEST_OUTPUTS/SweepCollectives_cumulative.out".format(hex_dig)
+                print "RL=`grep {0} $SST_TEST_REFERENCE/test_SweepCollectives.out`".format(hex_dig)
+                print "if [[ \"$RL\" != *\"$TL\"* ]] ; then "
+                print "    echo output does not match reference time"
+                print "    echo Reference entry is $RL"
+                print "    fail \"output does not match reference time\""
+                print "    echo Out Put file:"
+                print "    cat outFile "
+                print "else"
+                print "    echo ' '; echo Test Passed; echo ' ' "
+                print "fi"
+                print "popd"
+                print "}"
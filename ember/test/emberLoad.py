@@ -41,6 +41,9 @@ netShape = ''
 netInspect = ''
 rtrArb = ''
 
+allreduceAlgorithm = ''
+bcastAlgorithm = ''
+
 rndmPlacement = False
 #rndmPlacement = True
 bgPercentage = int(0)
@@ -61,7 +64,8 @@ try:
 		"numCores=","loadFile=","cmdLine=","printStats=","randomPlacement=",
 		"emberVerbose=","netBW=","netPktSize=","netFlitSize=",
 		"rtrArb=","embermotifLog=",	"rankmapper=",
-		"bgPercentage=","bgMean=","bgStddev=","bgMsgSize=","netInspect="])
+		"bgPercentage=","bgMean=","bgStddev=","bgMsgSize=","netInspect=",
+		"allreduceAlgorithm=","bcastAlgorithm="])
 
 except getopt.GetoptError as err:
     print str(err)
@@ -115,6 +119,10 @@ for o, a in opts:
         bgStddev = int(a) 
     elif o in ("--bgMsgSize"):
         bgMsgSize = int(a) 
+    elif o in ("--allreduceAlgorithm"):
+        allreduceAlgorithm = a
+    elif o in ("--bcastAlgorithm"):
+        bcastAlgorithm = a
     else:
         assert False, "unhandle option" 
 
@@ -294,6 +302,12 @@ hermesParams['hermesParams.nicParams.verboseLevel'] = debug
 hermesParams['hermesParams.functionSM.verboseLevel'] = debug
 hermesParams['hermesParams.ctrlMsg.verboseLevel'] = debug
 emberParams['verbose'] = emberVerbose
+if allreduceAlgorithm:
+    hermesParams['hermesParams.functionSM.Allreduce.allreduceAlgorithm'] = allreduceAlgorithm
+    hermesParams['hermesParams.functionSM.Barrier.allreduceAlgorithm'] = allreduceAlgorithm
+if bcastAlgorithm:
+    # bcast runs on the Reduce function state machine
+    hermesParams['hermesParams.functionSM.Reduce.bcastAlgorithm'] = bcastAlgorithm
 if embermotifLog:
     emberParams['motifLog'] = embermotifLog
 if emberrankmapper:
@@ -0,0 +1,100 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <vector>
+
+#include "sirius/siriusglobals.h"
+
+void usage() {
+	printf("Usage: siriuspack <number ranks> <trace prefix> <file out>\n");
+	printf("<no ranks>       Is the number of ranks traced\n");
+	printf("<trace prefix>   Is the prefix of the per-rank traces (<prefix>.<rank>)\n");
+	printf("<file out>       Is the packed trace to be written\n");
+	exit(-1);
+}
+
+int main(int argc, char* argv[]) {
+	printf("SST SIRIUS Trace Packer\n");
+
+	if(argc < 4) {
+		usage();
+	}
+
+	const uint32_t rankCount = (uint32_t) atoi(argv[1]);
+
+	FILE* packed = fopen(argv[3], "wb");
+	if(NULL == packed) {
+		fprintf(stderr, "Unable to open output trace: %s\n", argv[3]);
+		exit(-1);
+	}
+
+	const uint64_t magic = SIRIUS_PACK_MAGIC;
+	const uint32_t header[2] = { rankCount, 0 };
+	fwrite(&magic, sizeof(magic), 1, packed);
+	fwrite(header, sizeof(header), 1, packed);
+
+	// Index is filled in once the traces are copied
+	std::vector<uint64_t> index(2 * rankCount, 0);
+	fwrite(&index[0], sizeof(uint64_t), index.size(), packed);
+
+	uint64_t offset = SIRIUS_PACK_HEADER_SIZE +
+		(uint64_t) rankCount * SIRIUS_PACK_INDEX_ENTRY_SIZE;
+
+	char* traceName = (char*) malloc(sizeof(char) * PATH_MAX);
+	const size_t copyBufferLen = 1024 * 1024;
+	char* copyBuffer = (char*) malloc(copyBufferLen);
+
+	for(uint32_t i = 0; i < rankCount; i++) {
+		snprintf(traceName, PATH_MAX, "%s.%" PRIu32, argv[2], i);
+
+		FILE* trace = fopen(traceName, "rb");
+		if(NULL == trace) {
+			fprintf(stderr, "Unable to open trace: %s\n", traceName);
+			exit(-1);
+		}
+
+		uint64_t length = 0;
+		size_t readLen;
+
+		while( (readLen = fread(copyBuffer, 1, copyBufferLen, trace)) > 0 ) {
+			if(readLen != fwrite(copyBuffer, 1, readLen, packed)) {
+				fprintf(stderr, "Error writing to: %s\n", argv[3]);
+				exit(-1);
+			}
+
+			length += readLen;
+		}
+
+		fclose(trace);
+
+		index[2 * i]     = offset;
+		index[2 * i + 1] = length;
+		offset += length;
+
+		printf("Packed rank %" PRIu32 ", %" PRIu64 " bytes\n", i, length);
+	}
+
+	fseek(packed, SIRIUS_PACK_HEADER_SIZE, SEEK_SET);
+	fwrite(&index[0], sizeof(uint64_t), index.size(), packed);
+	fclose(packed);
+
+	free(traceName);
+	free(copyBuffer);
+
+	return 0;
+}
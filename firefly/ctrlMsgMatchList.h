@@ -0,0 +1,266 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_CTRLMSGMATCHLIST_H
+#define COMPONENTS_FIREFLY_CTRLMSGMATCHLIST_H
+
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+#include "ctrlMsgXXX.h"
+
+namespace SST {
+namespace Firefly {
+namespace CtrlMsg {
+
+// Posted receive list indexed by (communicator, source, tag).
+//
+// Receives are kept in one of four families of hash buckets depending on
+// which of source and tag are wildcards. An arriving header looks at the
+// one bucket of each family it can match and takes the newest candidate,
+// the order the old linear list (pushed at the front) matched in, or the
+// oldest one if setPostingOrder() asks for MPI posting order.
+//
+// Every receive also gets a sequence number; a Fenwick tree over the live
+// sequence numbers gives the position the match would have had in a single
+// linear list walked in the same order, which is what a NIC walking its
+// match list would pay for.
+
+class PostedRecvList {
+
+    enum { Exact = 0, AnySrcFamily, AnyTagFamily, AnyBothFamily, NumFamilies };
+
+    struct Key {
+        Key( MP::Communicator _group, MP::RankID _rank, uint64_t _tag ) :
+            group( _group ), rank( _rank ), tag( _tag ) {}
+
+        bool operator==( const Key& rhs ) const {
+            return group == rhs.group && rank == rhs.rank && tag == rhs.tag;
+        }
+
+        MP::Communicator group;
+        MP::RankID       rank;
+        uint64_t         tag;
+    };
+
+    struct KeyHash {
+        size_t operator()( const Key& key ) const {
+            uint64_t h = key.tag * 0x9e3779b97f4a7c15ULL;
+            h ^= ( (uint64_t) key.rank << 32 | key.group ) +
+                                        0x7f4a7c159e3779b9ULL + (h << 6);
+            return h ^ ( h >> 29 );
+        }
+    };
+
+    struct Entry {
+        Entry( uint64_t _seq, _CommReq* _req ) : seq( _seq ), req( _req ) {}
+        uint64_t  seq;
+        _CommReq* req;
+    };
+
+    typedef std::deque< Entry* > Bucket;
+    typedef std::unordered_map< Key, Bucket, KeyHash > BucketMap;
+
+  public:
+    PostedRecvList() : m_postingOrder( false ), m_size( 0 ), m_nextSeq( 0 ) {
+        m_tree.resize( MinCapacity + 1, 0 );
+    }
+
+    ~PostedRecvList() {
+        for ( int i = 0; i < NumFamilies; i++ ) {
+            BucketMap::iterator iter = m_buckets[i].begin();
+            for ( ; iter != m_buckets[i].end(); ++iter ) {
+                for ( size_t j = 0; j < iter->second.size(); j++ ) {
+                    delete iter->second[j];
+                }
+            }
+        }
+    }
+
+    size_t size() { return m_size; }
+
+    // match the oldest posted receive (true) or the newest (false)
+    void setPostingOrder( bool postingOrder ) { m_postingOrder = postingOrder; }
+
+    void push( _CommReq* req ) {
+        if ( m_nextSeq + 1 >= m_tree.size() ) {
+            compact();
+        }
+        Entry* entry = new Entry( m_nextSeq++, req );
+        MatchHdr& hdr = req->hdr();
+        int family = familyOf( req );
+        m_buckets[family][ keyOf( family, hdr.group, hdr.rank, hdr.tag ) ].
+                                                        push_back( entry );
+        treeAdd( entry->seq, 1 );
+        ++m_size;
+    }
+
+    // Removes and returns the first posted receive in matching order that
+    // matches hdr, or NULL. `position` is set to the 1 based position the
+    // match had in that order, or to the list size if nothing matched.
+    // `examined` is incremented for every bucket entry actually looked at.
+    _CommReq* search( MatchHdr& hdr, int& position, int& examined ) {
+
+        Bucket*  bestBucket = NULL;
+        BucketMap::iterator bestIter;
+        int      bestFamily = 0;
+        size_t   bestPos = 0;
+        uint64_t bestSeq = 0;
+
+        for ( int family = 0; family < NumFamilies; family++ ) {
+            if ( m_buckets[family].empty() ) {
+                continue;
+            }
+            BucketMap::iterator iter = m_buckets[family].find(
+                            keyOf( family, hdr.group, hdr.rank, hdr.tag ) );
+            if ( iter == m_buckets[family].end() ) {
+                continue;
+            }
+            // buckets are in posting order, walk them in matching order
+            Bucket& bucket = iter->second;
+            size_t n = bucket.size();
+            for ( size_t j = 0; j < n; j++ ) {
+                size_t i = m_postingOrder ? j : n - 1 - j;
+                ++examined;
+                if ( bestBucket && ( m_postingOrder ?
+                        bucket[i]->seq > bestSeq : bucket[i]->seq < bestSeq ) ) {
+                    break;
+                }
+                if ( matches( hdr, bucket[i]->req ) ) {
+                    bestBucket = &bucket;
+                    bestIter = iter;
+                    bestFamily = family;
+                    bestPos = i;
+                    bestSeq = bucket[i]->seq;
+                    break;
+                }
+            }
+        }
+
+        if ( ! bestBucket ) {
+            position = m_size;
+            return NULL;
+        }
+
+        Entry* entry = (*bestBucket)[bestPos];
+        _CommReq* req = entry->req;
+
+        position = m_postingOrder ? treeSum( entry->seq ) :
+                                    m_size - treeSum( entry->seq ) + 1;
+        treeAdd( entry->seq, -1 );
+        --m_size;
+
+        bestBucket->erase( bestBucket->begin() + bestPos );
+        if ( bestBucket->empty() ) {
+            m_buckets[bestFamily].erase( bestIter );
+        }
+        delete entry;
+
+        return req;
+    }
+
+  private:
+    static const size_t MinCapacity = 1024;
+
+    static bool isAnyTag( _CommReq* req ) {
+        return req->ignore() || AnyTag == req->hdr().tag;
+    }
+
+    static int familyOf( _CommReq* req ) {
+        bool anySrc = MP::AnySrc == req->hdr().rank;
+        bool anyTag = isAnyTag( req );
+        if ( anySrc ) {
+            return anyTag ? AnyBothFamily : AnySrcFamily;
+        }
+        return anyTag ? AnyTagFamily : Exact;
+    }
+
+    static Key keyOf( int family, MP::Communicator group, MP::RankID rank,
+                                                            uint64_t tag ) {
+        switch ( family ) {
+          case AnySrcFamily:  return Key( group, MP::AnySrc, tag );
+          case AnyTagFamily:  return Key( group, rank, 0 );
+          case AnyBothFamily: return Key( group, MP::AnySrc, 0 );
+          default:            return Key( group, rank, tag );
+        }
+    }
+
+    // tag honours the ignore mask, rank honours AnySrc, the rest is exact
+    static bool matches( MatchHdr& hdr, _CommReq* req ) {
+        MatchHdr& want = req->hdr();
+        uint64_t ignore = req->ignore();
+        if ( ( AnyTag != want.tag ) &&
+                ( ( want.tag & ~ignore ) != ( hdr.tag & ~ignore ) ) ) {
+            return false;
+        }
+        if ( ( MP::AnySrc != want.rank ) && ( want.rank != hdr.rank ) ) {
+            return false;
+        }
+        return want.group == hdr.group && want.count == hdr.count &&
+                            want.dtypeSize == hdr.dtypeSize;
+    }
+
+    static bool seqOrder( const Entry* a, const Entry* b ) {
+        return a->seq < b->seq;
+    }
+
+    // renumber the live entries from zero, keeping their order, and
+    // resize the tree so there is room for at least as many new ones
+    void compact() {
+        std::vector< Entry* > live;
+        live.reserve( m_size );
+        for ( int i = 0; i < NumFamilies; i++ ) {
+            BucketMap::iterator iter = m_buckets[i].begin();
+            for ( ; iter != m_buckets[i].end(); ++iter ) {
+                live.insert( live.end(), iter->second.begin(),
+                                                    iter->second.end() );
+            }
+        }
+        std::sort( live.begin(), live.end(), seqOrder );
+
+        size_t capacity = std::max( (size_t) MinCapacity, live.size() * 2 );
+        m_tree.assign( capacity + 1, 0 );
+        for ( size_t i = 0; i < live.size(); i++ ) {
+            live[i]->seq = i;
+            treeAdd( i, 1 );
+        }
+        m_nextSeq = live.size();
+    }
+
+    void treeAdd( uint64_t seq, int value ) {
+        for ( size_t i = seq + 1; i < m_tree.size(); i += i & -i ) {
+            m_tree[i] += value;
+        }
+    }
+
+    // number of live entries with a sequence number <= seq
+    int treeSum( uint64_t seq ) {
+        int sum = 0;
+        for ( size_t i = seq + 1; i > 0; i -= i & -i ) {
+            sum += m_tree[i];
+        }
+        return sum;
+    }
+
+    bool                m_postingOrder;
+    BucketMap           m_buckets[NumFamilies];
+    std::vector<int>    m_tree;
+    size_t              m_size;
+    uint64_t            m_nextSeq;
+};
+
+}
+}
+}
+
+#endif
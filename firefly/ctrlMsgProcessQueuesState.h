@@ -14,6 +14,7 @@
 
 #include <sst/core/output.h>
 #include "ctrlMsgXXX.h"
+#include "ctrlMsgMatchList.h"
 
 namespace SST {
 namespace Firefly {
@@ -43,6 +44,7 @@ class ProcessQueuesState
         snprintf(buffer,100,"@t:%#x:%d:CtrlMsg::ProcessQueuesState::@p():@l ",
                             obj.nic().getNodeId(), obj.info()->worldRank());
         dbg().setPrefix(buffer);
+        m_pstdRcvQ.setPostingOrder( obj.matchPostingOrder() );
         for ( unsigned long i = 0; i < MinPostedShortBuffers; i++ ) {
             postShortRecvBuffer();
         }
@@ -280,9 +282,7 @@ class ProcessQueuesState
     void dmaRecvFiniGI( GetInfo*, nid_t, uint32_t, size_t );
     void dmaRecvFiniSRB( ShortRecvBuffer*, nid_t, uint32_t, size_t );
 
-    bool        checkMatchHdr( MatchHdr& hdr, MatchHdr& wantHdr,
-                                                    uint64_t ignore );
-    _CommReq*	searchPostedRecv( MatchHdr& hdr, int& delay );
+    _CommReq*	searchPostedRecv( MatchHdr& hdr, int& count );
     void        print( char* buf, int len );
 
     void exit( int delay = 0 ) {
@@ -325,7 +325,10 @@ class ProcessQueuesState
     int     m_numRecvLooped;
     bool    m_missedInt;
 
-    std::deque< _CommReq* >         m_pstdRcvQ;
+    PostedRecvList                  m_pstdRcvQ;
+    // unexpected messages stay in arrival order and are not hashed, each
+    // one is looked up in m_pstdRcvQ and charged its own memwalk when the
+    // queues are processed, skipping or batching them would change timing
     std::deque< Msg* >              m_recvdMsgQ;
 
     std::deque< _CommReq* >         m_longGetFiniQ;
@@ -489,7 +492,7 @@ void ProcessQueuesState<T1>::enterRecv( _CommReq* req, uint64_t exitDelay )
         }
     }
 
-    m_pstdRcvQ.push_front( req );
+    m_pstdRcvQ.push( req );
 
     size_t length = req->getLength( );
 
@@ -1045,62 +1048,22 @@ void ProcessQueuesState<T1>::loopHandler( int srcCore, std::vector<IoVec>& vec,
 template< class T1 >
 _CommReq* ProcessQueuesState<T1>::searchPostedRecv( MatchHdr& hdr, int& count )
 {
-    _CommReq* req = NULL;
     dbg().verbose(CALL_INFO,1,1,"posted size %lu\n",m_pstdRcvQ.size());
 
-    std::deque< _CommReq* >:: iterator iter = m_pstdRcvQ.begin();
-    for ( ; iter != m_pstdRcvQ.end(); ++iter ) {
+    int position = 0;
+    int examined = 0;
+    _CommReq* req = m_pstdRcvQ.search( hdr, position, examined );
 
-        ++count;
-        if ( ! checkMatchHdr( hdr, (*iter)->hdr(), (*iter)->ignore() ) ) {
-            continue;
-        }
+    // charge for the entries a linear match list would have walked,
+    // not just the ones the hash buckets made us look at
+    count += obj().modeledMatchCost() ? position : examined;
 
-        req = *iter;
-        m_pstdRcvQ.erase(iter);
-        break;
-    }
-    dbg().verbose(CALL_INFO,2,1,"req=%p\n",req);
+    dbg().verbose(CALL_INFO,2,1,"req=%p position=%d examined=%d\n",
+                                                req, position, examined );
 
     return req;
 }
 
-template< class T1 >
-bool ProcessQueuesState<T1>::checkMatchHdr( MatchHdr& hdr, MatchHdr& wantHdr,
-                                    uint64_t ignore )
-{
-    dbg().verbose(CALL_INFO,1,1,"posted tag %#" PRIx64 ", msg tag %#" PRIx64 "\n", wantHdr.tag, hdr.tag );
-    if ( ( AnyTag != wantHdr.tag ) && 
-            ( ( wantHdr.tag & ~ignore) != ( hdr.tag & ~ignore ) ) ) {
-        return false;
-    }
-
-    dbg().verbose(CALL_INFO,1,1,"want rank %d %d\n", wantHdr.rank, hdr.rank );
-    if ( ( MP::AnySrc != wantHdr.rank ) && ( wantHdr.rank != hdr.rank ) ) {
-        return false;
-    }
-
-    dbg().verbose(CALL_INFO,1,1,"want group %d %d\n", wantHdr.group,hdr.group);
-    if ( wantHdr.group != hdr.group ) {
-        return false;
-    }
-
-    dbg().verbose(CALL_INFO,1,1,"want count %d %d\n", wantHdr.count,
-                                    hdr.count);
-    if ( wantHdr.count !=  hdr.count ) {
-        return false;
-    }
-
-    dbg().verbose(CALL_INFO,1,1,"want dtypeSize %d %d\n", wantHdr.dtypeSize,
-                                    hdr.dtypeSize);
-    if ( wantHdr.dtypeSize !=  hdr.dtypeSize ) {
-        return false;
-    }
-
-    dbg().verbose(CALL_INFO,1,1,"matched\n");
-    return true;
-}
-
 template< class T1 >
 void ProcessQueuesState<T1>::copyIoVec( 
                 std::vector<IoVec>& dst, std::vector<IoVec>& src, size_t len )
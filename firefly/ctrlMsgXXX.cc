@@ -48,6 +48,8 @@ XXX::XXX( Component* owner, Params& params ) :
         new Event::Handler<XXX>(this,&XXX::delayHandler));
 
     m_matchDelay_ns = params.find_integer( "matchDelay_ns", 1 );
+    m_modeledMatchCost = params.find_integer( "modeledMatchCost", 1 );
+    m_matchPostingOrder = params.find_integer( "matchPostingOrder", 0 );
 
     std::string tmpName = params.find_string("txMemcpyMod");
     Params tmpParams = params.find_prefix_params("txMemcpyModParams.");
@@ -135,6 +137,10 @@ XXX::~XXX()
     if ( m_rxPostMod ) {
         delete m_rxPostMod;
     }
+
+    for ( size_t i = 0; i < m_delayEventPool.size(); i++ ) {
+        delete m_delayEventPool[i];
+    }
 }
 
 void XXX::init( Info* info, VirtNic* nic )
@@ -355,7 +361,7 @@ void XXX::waitAll( int count, MP::MessageRequest req[],
 void XXX::schedCallback( Callback callback, uint64_t delay )
 {
     m_dbg.verbose(CALL_INFO,1,1,"delay=%lu\n",delay);
-    m_delayLink->send( delay, new DelayEvent(callback) );
+    m_delayLink->send( delay, newDelayEvent(callback) );
 }
 
 void XXX::delayHandler( SST::Event* e )
@@ -365,7 +371,8 @@ void XXX::delayHandler( SST::Event* e )
     m_dbg.verbose(CALL_INFO,2,1,"execute callback\n");
 
     event->callback();
-    delete e;
+    event->callback = NULL;
+    m_delayEventPool.push_back( event );
 }
 
 void XXX::memcpy( Callback callback, MemAddr to, MemAddr from, size_t length )
@@ -382,7 +389,7 @@ void XXX::memcpy( Callback callback, MemAddr to, MemAddr from, size_t length )
         } else {
             assert(0);
         }
-        m_delayLink->send( delay, new DelayEvent(callback) );
+        m_delayLink->send( delay, newDelayEvent(callback) );
     }
 }
 
@@ -392,7 +399,7 @@ void XXX::memread( Callback callback, MemAddr addr, size_t length )
     if ( m_memLink ) {
         m_memLink->send( 0, new MemReadReqEvent( callback, 0, addr, length ) );
     } else {
-        m_delayLink->send( txMemcpyDelay( length ), new DelayEvent(callback) );
+        m_delayLink->send( txMemcpyDelay( length ), newDelayEvent(callback) );
     }
 }
 
@@ -402,26 +409,26 @@ void XXX::memwrite( Callback callback, MemAddr addr, size_t length )
     if ( m_memLink ) {
         m_memLink->send( 0, new MemWriteReqEvent( callback, 0, addr, length ) );
     } else {
-        m_delayLink->send( txMemcpyDelay( length ), new DelayEvent(callback) );
+        m_delayLink->send( txMemcpyDelay( length ), newDelayEvent(callback) );
     }
 }
 
 void XXX::mempin( Callback callback, MemAddr addr, size_t length )
 {
     m_dbg.verbose(CALL_INFO,1,1,"\n");
-    m_delayLink->send( regRegionDelay( length ), new DelayEvent(callback) );
+    m_delayLink->send( regRegionDelay( length ), newDelayEvent(callback) );
 }
 
 void XXX::memunpin( Callback callback, MemAddr addr, size_t length )
 {
     m_dbg.verbose(CALL_INFO,1,1,"\n");
-    m_delayLink->send( regRegionDelay( length ), new DelayEvent(callback) );
+    m_delayLink->send( regRegionDelay( length ), newDelayEvent(callback) );
 }
 
 void XXX::memwalk( Callback callback, int count )
 {
     m_dbg.verbose(CALL_INFO,1,1,"\n");
-    m_delayLink->send( matchDelay( count ), new DelayEvent(callback) );
+    m_delayLink->send( matchDelay( count ), newDelayEvent(callback) );
 }
 
 bool XXX::notifyGetDone( void* key )
@@ -103,6 +103,8 @@ class XXX  {
         MP::MessageResponse* resp[] );
 
     size_t shortMsgLength() { return m_shortMsgLength; }
+    bool modeledMatchCost() { return m_modeledMatchCost; }
+    bool matchPostingOrder() { return m_matchPostingOrder; }
 
     void schedCallback( Callback, uint64_t delay = 0 );
     void passCtrlToFunction( uint64_t delay = 0 );
@@ -184,6 +186,17 @@ class XXX  {
         NotSerializable(DelayEvent)
     };
 
+    // delayHandler() returns events here instead of deleting them
+    DelayEvent* newDelayEvent( Callback& callback ) {
+        if ( m_delayEventPool.empty() ) {
+            return new DelayEvent( callback );
+        }
+        DelayEvent* event = m_delayEventPool.back();
+        m_delayEventPool.pop_back();
+        event->callback = std::move( callback );
+        return event;
+    }
+
   private:
     void delayHandler( Event* );
     void loopHandler( Event* );
@@ -209,6 +222,7 @@ class XXX  {
     Link*           m_retLink;
     Link*           m_memLink;
     Link*           m_delayLink;
+    std::vector<DelayEvent*> m_delayEventPool;
     Link*           m_loopLink;
     Info*           m_info;
     VirtNic*        m_nic;
@@ -223,6 +237,8 @@ class XXX  {
     uint64_t m_waitanyStateDelay;
 
     int m_matchDelay_ns;
+    bool m_modeledMatchCost;
+    bool m_matchPostingOrder;
     int m_regRegionBaseDelay_ns;
     int m_regRegionPerPageDelay_ns;
     int m_regRegionXoverLength;
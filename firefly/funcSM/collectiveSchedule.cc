@@ -0,0 +1,330 @@
+// Copyright 2013-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+
+#include <algorithm>
+
+#include "funcSM/collectiveSchedule.h"
+
+using namespace SST::Firefly;
+
+static int largestPow2( int size )
+{
+    int pof2 = 1;
+    while ( pof2 * 2 <= size ) {
+        pof2 *= 2;
+    }
+    return pof2;
+}
+
+static int log2Of( int pof2 )
+{
+    int log = 0;
+    while ( pof2 > 1 ) {
+        pof2 >>= 1;
+        ++log;
+    }
+    return log;
+}
+
+bool CollectiveSchedule::parse( const std::string& name, Algorithm& algo )
+{
+    if ( 0 == name.compare( "tree" ) ) {
+        algo = Tree;
+    } else if ( 0 == name.compare( "recursive_doubling" ) ) {
+        algo = RecursiveDoubling;
+    } else if ( 0 == name.compare( "rabenseifner" ) ) {
+        algo = Rabenseifner;
+    } else if ( 0 == name.compare( "ring" ) ) {
+        algo = Ring;
+    } else if ( 0 == name.compare( "scatter_allgather" ) ) {
+        algo = ScatterAllgather;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void CollectiveSchedule::add( Step::Op op, int peer, size_t offset,
+                                                size_t len, bool scratch )
+{
+    Step step;
+    step.op = op;
+    step.peer = peer;
+    step.offset = offset;
+    step.len = len;
+    step.scratch = scratch;
+    step.round = m_round;
+    m_maxRound = std::max( m_maxRound, m_round );
+    m_steps.push_back( step );
+}
+
+void CollectiveSchedule::exchange( int recvPeer, size_t recvOffset,
+        size_t recvLen, int sendPeer, size_t sendOffset, size_t sendLen,
+        bool reduce )
+{
+    add( Step::Irecv, recvPeer, recvOffset, recvLen, reduce );
+    add( Step::Isend, sendPeer, sendOffset, sendLen, false );
+    add( Step::WaitAll, -1, 0, 0, false );
+    if ( reduce ) {
+        add( Step::Reduce, -1, recvOffset, recvLen, true );
+    }
+    ++m_round;
+}
+
+void CollectiveSchedule::sendOnly( int peer, size_t offset, size_t len )
+{
+    add( Step::Isend, peer, offset, len, false );
+    add( Step::WaitAll, -1, 0, 0, false );
+}
+
+void CollectiveSchedule::recvOnly( int peer, size_t offset, size_t len,
+                                                                bool reduce )
+{
+    add( Step::Irecv, peer, offset, len, reduce );
+    add( Step::WaitAll, -1, 0, 0, false );
+    if ( reduce ) {
+        add( Step::Reduce, -1, offset, len, true );
+    }
+}
+
+// Cut count elements into num nearly equal blocks, the first count % num
+// blocks get the extra element.
+void CollectiveSchedule::blocks( int num, size_t count, size_t dtypeSize )
+{
+    m_blockOffset.resize( num + 1 );
+    m_blockOffset[0] = 0;
+    for ( int i = 0; i < num; i++ ) {
+        size_t n = count / num + ( (size_t) i < count % num ? 1 : 0 );
+        m_blockOffset[i + 1] = m_blockOffset[i] + n * dtypeSize;
+    }
+}
+
+size_t CollectiveSchedule::blockBytes( int first, int last )
+{
+    return m_blockOffset[last] - m_blockOffset[first];
+}
+
+// With a size that is not a power of two the first 2 * rem ranks pair up,
+// the even one hands its data to the odd one and sits out until foldOut().
+// Returns the rank within the remaining power of two, or -1. Folding in is
+// round 0, the power of two part starts at round 1.
+int CollectiveSchedule::foldIn( int rank, int rem, size_t bytes )
+{
+    m_round = 0;
+    if ( rank < 2 * rem ) {
+        if ( 0 == rank % 2 ) {
+            sendOnly( rank + 1, 0, bytes );
+            return -1;
+        }
+        recvOnly( rank - 1, 0, bytes, true );
+        m_round = 1;
+        return rank / 2;
+    }
+    m_round = 1;
+    return rank - rem;
+}
+
+// the ranks that sat out don't know how many rounds the others took, so
+// folding out uses a round given by the caller
+void CollectiveSchedule::foldOut( int rank, int rem, size_t bytes, int round )
+{
+    m_round = round;
+    if ( rank < 2 * rem ) {
+        if ( rank % 2 ) {
+            sendOnly( rank - 1, 0, bytes );
+        } else {
+            recvOnly( rank + 1, 0, bytes, false );
+        }
+    }
+}
+
+void CollectiveSchedule::allreduceRecursiveDoubling( int rank, int size,
+                                                            size_t bytes )
+{
+    int pof2 = largestPow2( size );
+    int rem = size - pof2;
+
+    int newRank = foldIn( rank, rem, bytes );
+
+    if ( -1 != newRank ) {
+        for ( int mask = 1; mask < pof2; mask <<= 1 ) {
+            int dst = realRank( newRank ^ mask, rem );
+            exchange( dst, 0, bytes, dst, 0, bytes, true );
+        }
+    }
+
+    foldOut( rank, rem, bytes, 1 + log2Of( pof2 ) );
+}
+
+// Reduce-scatter by recursive halving followed by an allgather by recursive
+// doubling, after Rabenseifner and the MPICH implementation of it.
+void CollectiveSchedule::allreduceRabenseifner( int rank, int size,
+                                        size_t count, size_t dtypeSize )
+{
+    int pof2 = largestPow2( size );
+    int rem = size - pof2;
+    size_t bytes = count * dtypeSize;
+
+    if ( count < (size_t) pof2 ) {
+        allreduceRecursiveDoubling( rank, size, bytes );
+        return;
+    }
+
+    int newRank = foldIn( rank, rem, bytes );
+
+    if ( -1 != newRank ) {
+        blocks( pof2, count, dtypeSize );
+
+        int sendIdx = 0;
+        int recvIdx = 0;
+        int lastIdx = pof2;
+        int mask;
+
+        for ( mask = 1; mask < pof2; mask <<= 1 ) {
+            int newDst = newRank ^ mask;
+            int dst = realRank( newDst, rem );
+            size_t sendLen, recvLen;
+
+            if ( newRank < newDst ) {
+                sendIdx = recvIdx + pof2 / ( mask * 2 );
+                sendLen = blockBytes( sendIdx, lastIdx );
+                recvLen = blockBytes( recvIdx, sendIdx );
+            } else {
+                recvIdx = sendIdx + pof2 / ( mask * 2 );
+                sendLen = blockBytes( sendIdx, recvIdx );
+                recvLen = blockBytes( recvIdx, lastIdx );
+            }
+
+            exchange( dst, m_blockOffset[recvIdx], recvLen,
+                        dst, m_blockOffset[sendIdx], sendLen, true );
+
+            sendIdx = recvIdx;
+            if ( mask * 2 < pof2 ) {
+                lastIdx = recvIdx + pof2 / ( mask * 2 );
+            }
+        }
+
+        for ( mask >>= 1; mask > 0; mask >>= 1 ) {
+            int newDst = newRank ^ mask;
+            int dst = realRank( newDst, rem );
+            size_t sendLen, recvLen;
+
+            if ( newRank < newDst ) {
+                if ( mask != pof2 / 2 ) {
+                    lastIdx = lastIdx + pof2 / ( mask * 2 );
+                }
+                recvIdx = sendIdx + pof2 / ( mask * 2 );
+                sendLen = blockBytes( sendIdx, recvIdx );
+                recvLen = blockBytes( recvIdx, lastIdx );
+            } else {
+                recvIdx = sendIdx - pof2 / ( mask * 2 );
+                sendLen = blockBytes( sendIdx, lastIdx );
+                recvLen = blockBytes( recvIdx, sendIdx );
+            }
+
+            exchange( dst, m_blockOffset[recvIdx], recvLen,
+                        dst, m_blockOffset[sendIdx], sendLen, false );
+
+            if ( newRank > newDst ) {
+                sendIdx = recvIdx;
+            }
+        }
+    }
+
+    foldOut( rank, rem, bytes, 1 + 2 * log2Of( pof2 ) );
+}
+
+// Ring reduce-scatter then ring allgather, each of size - 1 steps moving
+// one block to the right neighbour.
+void CollectiveSchedule::allreduceRing( int rank, int size, size_t count,
+                                                        size_t dtypeSize )
+{
+    if ( count < (size_t) size ) {
+        allreduceRecursiveDoubling( rank, size, count * dtypeSize );
+        return;
+    }
+
+    blocks( size, count, dtypeSize );
+
+    int left = ( rank - 1 + size ) % size;
+    int right = ( rank + 1 ) % size;
+
+    for ( int step = 0; step < size - 1; step++ ) {
+        int sendBlk = ( rank - step + size ) % size;
+        int recvBlk = ( rank - step - 1 + size ) % size;
+        exchange( left, m_blockOffset[recvBlk], blockBytes(recvBlk,recvBlk+1),
+                right, m_blockOffset[sendBlk], blockBytes(sendBlk,sendBlk+1),
+                true );
+    }
+
+    for ( int step = 0; step < size - 1; step++ ) {
+        int sendBlk = ( rank + 1 - step + size ) % size;
+        int recvBlk = ( rank - step + size ) % size;
+        exchange( left, m_blockOffset[recvBlk], blockBytes(recvBlk,recvBlk+1),
+                right, m_blockOffset[sendBlk], blockBytes(sendBlk,sendBlk+1),
+                false );
+    }
+}
+
+// Binomial scatter from the root followed by a ring allgather, after
+// van de Geijn. Works on bytes, chunk i belongs to virtual rank i.
+void CollectiveSchedule::bcastScatterAllgather( int rank, int size, int root,
+                                                            size_t bytes )
+{
+    size_t chunk = ( bytes + size - 1 ) / size;
+    int vrank = ( rank - root + size ) % size;
+
+    m_blockOffset.resize( size + 1 );
+    for ( int i = 0; i <= size; i++ ) {
+        m_blockOffset[i] = std::min( bytes, chunk * i );
+    }
+
+    size_t have = 0 == vrank ? bytes : 0;
+    int mask;
+
+    // scatter message over bit `mask` uses round log2(mask)
+    for ( mask = 1; mask < size; mask <<= 1 ) {
+        if ( vrank & mask ) {
+            int src = ( vrank - mask + root ) % size;
+            m_round = log2Of( mask );
+            have = std::min( bytes - m_blockOffset[vrank], chunk * mask );
+            if ( have ) {
+                recvOnly( src, m_blockOffset[vrank], have, false );
+            }
+            break;
+        }
+    }
+
+    for ( mask >>= 1; mask > 0; mask >>= 1 ) {
+        if ( vrank + mask < size && have > chunk * mask ) {
+            int dst = ( vrank + mask + root ) % size;
+            size_t len = have - chunk * mask;
+            m_round = log2Of( mask );
+            sendOnly( dst, m_blockOffset[vrank + mask], len );
+            have -= len;
+        }
+    }
+
+    int left = ( rank - 1 + size ) % size;
+    int right = ( rank + 1 ) % size;
+
+    m_round = log2Of( largestPow2( size ) ) + 1;
+    for ( int step = 0; step < size - 1; step++ ) {
+        int sendBlk = ( vrank - step + size ) % size;
+        int recvBlk = ( vrank - step - 1 + size ) % size;
+        exchange( left, m_blockOffset[recvBlk], blockBytes(recvBlk,recvBlk+1),
+                right, m_blockOffset[sendBlk], blockBytes(sendBlk,sendBlk+1),
+                false );
+    }
+}
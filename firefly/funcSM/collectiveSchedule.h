@@ -0,0 +1,88 @@
+// Copyright 2013-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_FUNCSM_COLLECTIVESCHEDULE_H
+#define COMPONENTS_FIREFLY_FUNCSM_COLLECTIVESCHEDULE_H
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Firefly {
+
+// A non-tree collective algorithm flattened into the list of point to point
+// operations one rank performs. Offsets and lengths are in bytes into the
+// collective's buffer; a receive may land in a scratch buffer of the same
+// size instead, from which a Reduce step folds it into the buffer.
+// All ranks are ranks within the communicator.
+
+class CollectiveSchedule {
+
+  public:
+    enum Algorithm { Tree, RecursiveDoubling, Rabenseifner, Ring,
+                                                        ScatterAllgather };
+
+    struct Step {
+        enum Op { Irecv, Isend, WaitAll, Reduce } op;
+        int     peer;
+        size_t  offset;
+        size_t  len;
+        bool    scratch;
+        int     round;
+    };
+
+    static bool parse( const std::string& name, Algorithm& algo );
+
+    CollectiveSchedule() : m_round( 0 ), m_maxRound( 0 ) {}
+
+    void clear() { m_steps.clear(); m_round = 0; m_maxRound = 0; }
+    size_t size() { return m_steps.size(); }
+    // largest round number used by any step
+    int maxRound() { return m_maxRound; }
+    Step& operator[]( size_t i ) { return m_steps[i]; }
+
+    void allreduceRecursiveDoubling( int rank, int size, size_t bytes );
+    // both fall back to recursive doubling if count is smaller than the
+    // number of blocks the buffer has to be cut into
+    void allreduceRabenseifner( int rank, int size, size_t count,
+                                                        size_t dtypeSize );
+    void allreduceRing( int rank, int size, size_t count, size_t dtypeSize );
+    void bcastScatterAllgather( int rank, int size, int root, size_t bytes );
+
+  private:
+    int foldIn( int rank, int rem, size_t bytes );
+    void foldOut( int rank, int rem, size_t bytes, int round );
+    int realRank( int newRank, int rem ) {
+        return newRank < rem ? newRank * 2 + 1 : newRank + rem;
+    }
+
+    void blocks( int num, size_t count, size_t dtypeSize );
+    size_t blockBytes( int first, int last );
+
+    void exchange( int recvPeer, size_t recvOffset, size_t recvLen,
+                    int sendPeer, size_t sendOffset, size_t sendLen,
+                    bool reduce );
+    void sendOnly( int peer, size_t offset, size_t len );
+    void recvOnly( int peer, size_t offset, size_t len, bool reduce );
+    void add( Step::Op op, int peer, size_t offset, size_t len,
+                                                        bool scratch );
+
+    std::vector<Step>   m_steps;
+    std::vector<size_t> m_blockOffset;
+    int                 m_round;
+    int                 m_maxRound;
+};
+
+}
+}
+
+#endif
@@ -12,6 +12,8 @@
 
 #include <sst_config.h>
 
+#include <string.h>
+
 #include "funcSM/collectiveTree.h"
 #include "funcSM/collectiveOps.h"
 #include "info.h"
@@ -22,6 +24,45 @@ const char* CollectiveTreeFuncSM::m_enumName[] = {
     FOREACH_ENUM(GENERATE_STRING)
 };
 
+CollectiveTreeFuncSM::CollectiveTreeFuncSM( SST::Params& params ) :
+    FunctionSMInterface( params ),
+    m_event( NULL ),
+    m_seq( 0 ),
+    m_schedReqV( 2 ),
+    m_numSchedReqs( 0 )
+{
+    m_treeDegree = params.find_integer( "treeDegree", 2 );
+    if ( m_treeDegree < 1 ) {
+        m_dbg.fatal(CALL_INFO,-1,"treeDegree must be at least 1\n");
+    }
+
+    std::string algo = params.find_string( "allreduceAlgorithm", "tree" );
+    m_allreduceAuto = 0 == algo.compare( "auto" );
+    if ( m_allreduceAuto ) {
+        m_allreduceAlgo = CollectiveSchedule::Tree;
+    } else if ( ! CollectiveSchedule::parse( algo, m_allreduceAlgo ) ||
+                CollectiveSchedule::ScatterAllgather == m_allreduceAlgo ) {
+        m_dbg.fatal(CALL_INFO,-1,"unknown allreduceAlgorithm `%s`\n",
+                                                            algo.c_str());
+    }
+    m_allreduceShortMsgSize =
+                params.find_integer( "allreduceShortMsgSize", 2048 );
+    m_allreduceLongMsgSize =
+                params.find_integer( "allreduceLongMsgSize", 524288 );
+
+    algo = params.find_string( "bcastAlgorithm", "tree" );
+    m_bcastAuto = 0 == algo.compare( "auto" );
+    if ( m_bcastAuto ) {
+        m_bcastAlgo = CollectiveSchedule::Tree;
+    } else if ( ! CollectiveSchedule::parse( algo, m_bcastAlgo ) ||
+                ( CollectiveSchedule::Tree != m_bcastAlgo &&
+                  CollectiveSchedule::ScatterAllgather != m_bcastAlgo ) ) {
+        m_dbg.fatal(CALL_INFO,-1,"unknown bcastAlgorithm `%s`\n",
+                                                            algo.c_str());
+    }
+    m_bcastLongMsgSize = params.find_integer( "bcastLongMsgSize", 12288 );
+}
+
 void CollectiveTreeFuncSM::handleStartEvent( SST::Event *e, Retval& retval ) 
 {
     assert( NULL == m_event );
@@ -29,7 +70,14 @@ void CollectiveTreeFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
 
     ++m_seq;
 
-    m_yyy = new YYY( 2, m_info->getGroup(m_event->group)->getMyRank(),
+    CollectiveSchedule::Algorithm algo = chooseAlgorithm();
+    if ( CollectiveSchedule::Tree != algo ) {
+        startSchedule( algo, retval );
+        return;
+    }
+
+    m_yyy = new YYY( m_treeDegree,
+                m_info->getGroup(m_event->group)->getMyRank(),
                 m_info->getGroup(m_event->group)->getSize(), m_event->root ); 
 
     m_dbg.verbose(CALL_INFO,1,0,"%s group %d, root %d, size %d, rank %d\n",
@@ -86,6 +134,10 @@ void CollectiveTreeFuncSM::handleEnterEvent( Retval& retval )
     m_dbg.verbose(CALL_INFO,1,0,"%s state\n", stateName(m_state).c_str());
 
     switch ( m_state ) {
+    case RunSchedule:
+        runSchedule( retval );
+        return;
+
     case WaitUp:
         if (  m_yyy->numChildren() ) {
 
@@ -189,3 +241,163 @@ void CollectiveTreeFuncSM::handleEnterEvent( Retval& retval )
         m_event = NULL;
     }
 }
+
+CollectiveSchedule::Algorithm CollectiveTreeFuncSM::chooseAlgorithm()
+{
+    size_t bytes = m_event->count * m_info->sizeofDataType( m_event->dtype );
+
+    if ( m_info->getGroup(m_event->group)->getSize() < 2 ) {
+        return CollectiveSchedule::Tree;
+    }
+
+    switch ( m_event->type ) {
+      case CollectiveStartEvent::Allreduce:
+        if ( ! m_allreduceAuto ) {
+            return m_allreduceAlgo;
+        }
+        if ( bytes <= m_allreduceShortMsgSize ) {
+            return CollectiveSchedule::RecursiveDoubling;
+        } else if ( bytes < m_allreduceLongMsgSize ) {
+            return CollectiveSchedule::Rabenseifner;
+        }
+        return CollectiveSchedule::Ring;
+
+      case CollectiveStartEvent::Bcast:
+        if ( ! m_bcastAuto ) {
+            return m_bcastAlgo;
+        }
+        return bytes >= m_bcastLongMsgSize ?
+            CollectiveSchedule::ScatterAllgather : CollectiveSchedule::Tree;
+
+      default:
+        return CollectiveSchedule::Tree;
+    }
+}
+
+void CollectiveTreeFuncSM::startSchedule( CollectiveSchedule::Algorithm algo,
+                                                        Retval& retval )
+{
+    int rank = m_info->getGroup(m_event->group)->getMyRank();
+    int size = m_info->getGroup(m_event->group)->getSize();
+    size_t dtypeSize = m_info->sizeofDataType( m_event->dtype );
+
+    m_bufLen = m_event->count * dtypeSize;
+
+    m_schedule.clear();
+    switch ( algo ) {
+      case CollectiveSchedule::RecursiveDoubling:
+        m_schedule.allreduceRecursiveDoubling( rank, size, m_bufLen );
+        break;
+      case CollectiveSchedule::Rabenseifner:
+        m_schedule.allreduceRabenseifner( rank, size, m_event->count,
+                                                                dtypeSize );
+        break;
+      case CollectiveSchedule::Ring:
+        m_schedule.allreduceRing( rank, size, m_event->count, dtypeSize );
+        break;
+      case CollectiveSchedule::ScatterAllgather:
+        m_schedule.bcastScatterAllgather( rank, size, m_event->root,
+                                                                m_bufLen );
+        break;
+      default:
+        assert(0);
+    }
+
+    m_dbg.verbose(CALL_INFO,1,0,"%s group %d, size %d, rank %d, %lu steps\n",
+                m_event->typeName(), m_event->group, size, rank,
+                m_schedule.size() );
+
+    if ( m_schedule.maxRound() > MaxTagRound ) {
+        m_dbg.fatal(CALL_INFO,-1,"%s group %d of size %d needs %d rounds, "
+                "more than the %d that fit in a collective tag\n",
+                m_event->typeName(), m_event->group, size,
+                m_schedule.maxRound() + 1, MaxTagRound + 1 );
+    }
+
+    // bcast works in place on mydata, allreduce accumulates into result
+    if ( m_event->type == CollectiveStartEvent::Bcast ) {
+        m_schedBuf = m_event->mydata;
+    } else {
+        m_schedBuf = m_event->result;
+        if ( m_event->mydata && m_event->result &&
+                                    m_event->mydata != m_event->result ) {
+            memcpy( m_event->result, m_event->mydata, m_bufLen );
+        }
+    }
+
+    m_scratch = NULL;
+    if ( m_schedBuf && m_bufLen ) {
+        m_scratch = malloc( m_bufLen );
+        assert( m_scratch );
+    }
+
+    m_schedPos = 0;
+    m_numSchedReqs = 0;
+    m_state = RunSchedule;
+    handleEnterEvent( retval );
+}
+
+void* CollectiveTreeFuncSM::schedPtr( CollectiveSchedule::Step& step )
+{
+    void* base = step.scratch ? m_scratch : m_schedBuf;
+    if ( NULL == base ) {
+        return NULL;
+    }
+    return (unsigned char*) base + step.offset;
+}
+
+// issue the next point to point operation of the schedule, reductions are
+// local and don't need to return to the caller
+void CollectiveTreeFuncSM::runSchedule( Retval& retval )
+{
+    while ( m_schedPos < m_schedule.size() ) {
+        CollectiveSchedule::Step& step = m_schedule[ m_schedPos++ ];
+        CtrlMsg::nid_t nid;
+        void* in[2];
+
+        switch ( step.op ) {
+          case CollectiveSchedule::Step::Irecv:
+            nid = m_info->getGroup(m_event->group)->getMapping( step.peer );
+            m_dbg.verbose(CALL_INFO,1,0,"irecv %lu bytes from %d\n",
+                                                        step.len, step.peer );
+            proto()->irecv( schedPtr( step ), step.len, nid,
+                    genTag( step.round ), &m_schedReqV[ m_numSchedReqs++ ] );
+            return;
+
+          case CollectiveSchedule::Step::Isend:
+            nid = m_info->getGroup(m_event->group)->getMapping( step.peer );
+            m_dbg.verbose(CALL_INFO,1,0,"isend %lu bytes to %d\n",
+                                                        step.len, step.peer );
+            proto()->isend( schedPtr( step ), step.len, nid,
+                    genTag( step.round ), &m_schedReqV[ m_numSchedReqs++ ] );
+            return;
+
+          case CollectiveSchedule::Step::WaitAll:
+            m_schedReqV_ptrs.resize( m_numSchedReqs );
+            for ( unsigned int i = 0; i < m_numSchedReqs; i++ ) {
+                m_schedReqV_ptrs[i] = &m_schedReqV[i];
+            }
+            m_numSchedReqs = 0;
+            proto()->waitAll( m_schedReqV_ptrs );
+            return;
+
+          case CollectiveSchedule::Step::Reduce:
+            if ( m_schedBuf ) {
+                in[0] = (unsigned char*) m_schedBuf + step.offset;
+                in[1] = (unsigned char*) m_scratch + step.offset;
+                collectiveOp( in, 2, in[0],
+                    step.len / m_info->sizeofDataType( m_event->dtype ),
+                    m_event->dtype, m_event->op );
+            }
+            break;
+        }
+    }
+
+    m_dbg.verbose(CALL_INFO,1,0,"Exit\n" );
+    retval.setExit( 0 );
+    if ( m_scratch ) {
+        free( m_scratch );
+    }
+    delete m_event;
+    m_event = NULL;
+}
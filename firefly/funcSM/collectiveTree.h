@@ -14,6 +14,7 @@
 
 #include "funcSM/api.h"
 #include "funcSM/event.h"
+#include "funcSM/collectiveSchedule.h"
 #include "ctrlMsg.h"
 
 namespace SST {
@@ -95,6 +96,7 @@ class YYY {
     NAME( WaitDown ) \
     NAME( SendDown ) \
     NAME( Exit ) \
+    NAME( RunSchedule ) \
 
 #define GENERATE_ENUM(ENUM) ENUM,
 #define GENERATE_STRING(STRING) #STRING,
@@ -126,21 +128,27 @@ class CollectiveTreeFuncSM :  public FunctionSMInterface
     };
 
   public:
-    CollectiveTreeFuncSM( SST::Params& params ) :
-        FunctionSMInterface( params ),
-        m_event( NULL ),
-        m_seq( 0 )
-    { }
+    CollectiveTreeFuncSM( SST::Params& params );
 
     virtual void handleStartEvent( SST::Event*, Retval& );
     virtual void handleEnterEvent( Retval& );
 
   private:
 
-    uint32_t    genTag() {
-        return CtrlMsg::CollectiveTag | (m_seq & 0xffff);
+    // the round of a scheduled collective goes in bits 8-27 of the tag,
+    // startSchedule() checks that it fits
+    static const int MaxTagRound = 0xfffff;
+
+    uint32_t    genTag( int round = 0 ) {
+        return CtrlMsg::CollectiveTag | ( ( round & MaxTagRound ) << 8 ) |
+                                                        (m_seq & 0xff);
     }
 
+    CollectiveSchedule::Algorithm chooseAlgorithm();
+    void startSchedule( CollectiveSchedule::Algorithm, Retval& );
+    void runSchedule( Retval& );
+    void* schedPtr( CollectiveSchedule::Step& );
+
     CtrlMsg::API* proto() { return static_cast<CtrlMsg::API*>(m_proto); }
 
     WaitUpState         m_waitUpState;
@@ -155,6 +163,24 @@ class CollectiveTreeFuncSM :  public FunctionSMInterface
     size_t              m_bufLen;
     YYY*                m_yyy;
     int                 m_seq;
+    int                 m_treeDegree;
+
+    // algorithm selection, "auto" picks by message size
+    CollectiveSchedule::Algorithm   m_allreduceAlgo;
+    bool                m_allreduceAuto;
+    size_t              m_allreduceShortMsgSize;
+    size_t              m_allreduceLongMsgSize;
+    CollectiveSchedule::Algorithm   m_bcastAlgo;
+    bool                m_bcastAuto;
+    size_t              m_bcastLongMsgSize;
+
+    CollectiveSchedule  m_schedule;
+    size_t              m_schedPos;
+    void*               m_schedBuf;
+    void*               m_scratch;
+    std::vector<CtrlMsg::CommReq>   m_schedReqV;
+    std::vector<CtrlMsg::CommReq*>  m_schedReqV_ptrs;
+    unsigned int        m_numSchedReqs;
 };
         
 }
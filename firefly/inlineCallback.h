@@ -0,0 +1,171 @@
+// Copyright 2013-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_INLINECALLBACK_H
+#define COMPONENTS_FIREFLY_INLINECALLBACK_H
+
+#include <stddef.h>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+namespace SST {
+namespace Firefly {
+
+// A void() callable like std::function, except that the bound state of a
+// callable up to InlineSize bytes (a std::bind of a member function, its
+// object and a few arguments) lives inside the object instead of on the
+// heap. Larger callables still fall back to the heap.
+
+class InlineCallback {
+
+    static const size_t InlineSize = 64;
+
+    typedef typename std::aligned_storage< InlineSize >::type Storage;
+
+    struct Ops {
+        void (*invoke)( Storage& );
+        void (*copy)( Storage& dst, const Storage& src );
+        void (*move)( Storage& dst, Storage& src );
+        void (*destroy)( Storage& );
+    };
+
+    template < class F >
+    struct IsInline {
+        static const bool value = sizeof(F) <= sizeof(Storage) &&
+            std::alignment_of<Storage>::value % std::alignment_of<F>::value
+                                                                    == 0 &&
+            std::is_nothrow_move_constructible<F>::value;
+    };
+
+    template < class F, bool = IsInline<F>::value >
+    struct OpsFor {
+        static F& get( Storage& s ) { return *reinterpret_cast<F*>(&s); }
+        static const F& get( const Storage& s ) {
+            return *reinterpret_cast<const F*>(&s);
+        }
+        static void invoke( Storage& s ) { get(s)(); }
+        static void copy( Storage& dst, const Storage& src ) {
+            new (&dst) F( get(src) );
+        }
+        static void move( Storage& dst, Storage& src ) {
+            new (&dst) F( std::move( get(src) ) );
+            get(src).~F();
+        }
+        static void destroy( Storage& s ) { get(s).~F(); }
+        static void init( Storage& s, F&& f ) { new (&s) F( std::move(f) ); }
+        static void init( Storage& s, const F& f ) { new (&s) F( f ); }
+    };
+
+    template < class F >
+    struct OpsFor< F, false > {
+        static F*& get( Storage& s ) { return *reinterpret_cast<F**>(&s); }
+        static F* get( const Storage& s ) {
+            return *reinterpret_cast<F* const*>(&s);
+        }
+        static void invoke( Storage& s ) { (*get(s))(); }
+        static void copy( Storage& dst, const Storage& src ) {
+            new (&dst) F*( new F( *get(src) ) );
+        }
+        static void move( Storage& dst, Storage& src ) {
+            new (&dst) F*( get(src) );
+        }
+        static void destroy( Storage& s ) { delete get(s); }
+        static void init( Storage& s, F&& f ) {
+            new (&s) F*( new F( std::move(f) ) );
+        }
+        static void init( Storage& s, const F& f ) {
+            new (&s) F*( new F( f ) );
+        }
+    };
+
+    template < class F >
+    static const Ops* opsFor() {
+        typedef OpsFor<F> T;
+        static const Ops ops = { &T::invoke, &T::copy, &T::move, &T::destroy };
+        return &ops;
+    }
+
+  public:
+    InlineCallback() : m_ops( NULL ) {}
+    InlineCallback( std::nullptr_t ) : m_ops( NULL ) {}
+
+    template < class F, class D = typename std::decay<F>::type,
+        class = typename std::enable_if<
+                        ! std::is_same< D, InlineCallback >::value >::type,
+        class = decltype( std::declval<D&>()() ) >
+    InlineCallback( F&& f ) : m_ops( opsFor<D>() ) {
+        OpsFor<D>::init( m_storage, std::forward<F>(f) );
+    }
+
+    InlineCallback( const InlineCallback& other ) : m_ops( other.m_ops ) {
+        if ( m_ops ) {
+            m_ops->copy( m_storage, other.m_storage );
+        }
+    }
+
+    InlineCallback( InlineCallback&& other ) : m_ops( other.m_ops ) {
+        if ( m_ops ) {
+            m_ops->move( m_storage, other.m_storage );
+            other.m_ops = NULL;
+        }
+    }
+
+    ~InlineCallback() { reset(); }
+
+    InlineCallback& operator=( const InlineCallback& other ) {
+        if ( this != &other ) {
+            reset();
+            if ( other.m_ops ) {
+                other.m_ops->copy( m_storage, other.m_storage );
+                m_ops = other.m_ops;
+            }
+        }
+        return *this;
+    }
+
+    InlineCallback& operator=( InlineCallback&& other ) {
+        if ( this != &other ) {
+            reset();
+            if ( other.m_ops ) {
+                other.m_ops->move( m_storage, other.m_storage );
+                m_ops = other.m_ops;
+                other.m_ops = NULL;
+            }
+        }
+        return *this;
+    }
+
+    InlineCallback& operator=( std::nullptr_t ) {
+        reset();
+        return *this;
+    }
+
+    void operator()() { m_ops->invoke( m_storage ); }
+
+    explicit operator bool() const { return NULL != m_ops; }
+
+  private:
+    void reset() {
+        if ( m_ops ) {
+            m_ops->destroy( m_storage );
+            m_ops = NULL;
+        }
+    }
+
+    const Ops*  m_ops;
+    Storage     m_storage;
+};
+
+}
+}
+
+#endif
@@ -72,6 +72,8 @@ static const ElementInfoParam nic_params[] = {
 	{ "fattree:loading", "Sets the number of ports on edge router connected to nodes", "8"},
 	{ "fattree:radix", "Sets the number of ports on the network switches", "16"},
 	{ "packetSize", "Sets the size of the network packet in bytes", "64"},
+	{ "flowThreshold", "Messages of at least this many bytes are sent as a head packet plus an analytic flow at link_bw, 0 disables", "0"},
+	{ "payloadFreePackets", "Packets carry only protocol headers and lengths, message data is not copied", "0"},
 	{ "link_bw", "Sets the bandwidth of link connected to the router", "500Mhz"},
 	{ "buffer_size", "Sets the buffer size of the link connected to the router", "128"},
 	{ "module", "Sets the link control module", "merlin.linkcontrol"},
@@ -304,6 +306,12 @@ static const ElementInfoParam funcSMModule_params[] = {
     {"sendDelay", "Sets send delay", "0"},
     {"waitDelay", "Sets wait delay", "0"},
     {"irecvDelay", "Sets irecv delay", "0"},
+    {"treeDegree", "Sets the degree of the tree used by tree collectives", "2"},
+    {"allreduceAlgorithm", "Sets the allreduce/barrier algorithm: tree, recursive_doubling, rabenseifner, ring or auto", "tree"},
+    {"allreduceShortMsgSize", "auto uses recursive_doubling up to this many bytes", "2048"},
+    {"allreduceLongMsgSize", "auto uses ring from this many bytes, rabenseifner in between", "524288"},
+    {"bcastAlgorithm", "Sets the bcast algorithm: tree, scatter_allgather or auto", "tree"},
+    {"bcastLongMsgSize", "auto uses scatter_allgather from this many bytes", "12288"},
     {"debug", "Set the debug level", "0"},
     {"verbose", "Set the verbose level", "1"},
 	
@@ -323,6 +331,8 @@ static const ElementInfoParam ctrlMsgProtocolModule_params[] = {
     {"txMemcpyMod","Set the module used to calculate TX mempcy latency", ""},
     {"rxMemcpyMod","Set the module used to calculate RX mempcy latency", ""},
     {"matchDelay_ns","Sets the time to do a match", "100"},
+    {"matchPostingOrder","Match posted receives oldest first as MPI requires (1) or newest first as before (0)", "0"},
+    {"modeledMatchCost","Charge matchDelay_ns for every entry a linear match list would walk (1) or only for the hash bucket entries examined (0)", "1"},
     {"txSetupMod","Set the module used to calculate TX setup latency", ""},
     {"rxSetupMod","Set the module used to calculate RX setup latency", ""},
     {"txFiniMod","Set the module used to calculate TX fini latency", ""},
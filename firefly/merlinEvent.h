@@ -52,6 +52,8 @@ class FireflyNetworkEvent : public Event {
         assert( offset <= bufLen );
     }
     
+    // a NULL ptr only grows the length, bufPtr() returns NULL past the
+    // bytes actually stored
     void bufAppend( const void* ptr , size_t len ) {
         if ( ptr ) {
             buf.resize( bufLen + len);
@@ -66,6 +68,8 @@ class FireflyNetworkEvent : public Event {
         buf = me->buf;
         seq = me->seq;
         src = me->src;
+        offset = me->offset;
+        bufLen = me->bufLen;
     }
 
     FireflyNetworkEvent(const FireflyNetworkEvent &me) :
@@ -74,6 +78,8 @@ class FireflyNetworkEvent : public Event {
         buf = me.buf;
         seq = me.seq;
         src = me.src;
+        offset = me.offset;
+        bufLen = me.bufLen;
     }
 
     virtual Event* clone(void)
@@ -30,6 +30,7 @@ Nic::Nic(ComponentId_t id, Params &params) :
     m_sendNotifyCnt(0),
     m_sendMachine( 2, SendMachine( *this, m_dbg ) ),
     m_recvMachine( *this, m_dbg ),
+    m_lastSelfEvent( NULL ),
     m_getKey(10)
 {
     m_myNodeId = params.find_integer("nid", -1);
@@ -49,6 +50,9 @@ Nic::Nic(ComponentId_t id, Params &params) :
 
     m_tracedNode =     params.find_integer( "tracedNode", -1 );
     m_tracedPkt  =     params.find_integer( "tracedPkt", -1 );
+    bool payloadFree = params.find_integer( "payloadFreePackets", 0 );
+    m_flowThreshold = params.find_integer( "flowThreshold", 0 );
+    m_injectFreeAt = 0;
 
     UnitAlgebra xxx( params.find_string( "packetSize" ) );
     int packetSizeInBytes;
@@ -63,6 +67,18 @@ Nic::Nic(ComponentId_t id, Params &params) :
 	UnitAlgebra buf_size( params.find_string("buffer_size") );
 	UnitAlgebra link_bw( params.find_string("link_bw") );
 
+    m_packetSizeInBytes = packetSizeInBytes;
+    m_linkBytesPerNs = 0;
+    if ( link_bw.hasUnits( "B/s" ) ) {
+        m_linkBytesPerNs = (double) link_bw.getRoundedValue() / 1000000000.0;
+    } else if ( link_bw.hasUnits( "b/s" ) ) {
+        m_linkBytesPerNs = (double) link_bw.getRoundedValue() / 8000000000.0;
+    }
+    if ( m_flowThreshold && m_linkBytesPerNs <= 0 ) {
+        m_dbg.fatal(CALL_INFO,-1,"flowThreshold needs link_bw in B/s or b/s,"
+                    " got %s\n", link_bw.toString().c_str() );
+    }
+
     m_dbg.verbose(CALL_INFO,1,1,"id=%d buffer_size=%s link_bw=%s "
 			"packetSize=%d\n", m_myNodeId, buf_size.toString().c_str(),
 			link_bw.toString().c_str(), packetSizeInBytes);
@@ -96,8 +112,8 @@ Nic::Nic(ComponentId_t id, Params &params) :
 			params.find_string("corePortName","core") ) );
     }
     m_recvMachine.init( m_vNicV.size(), rxMatchDelay, hostReadDelay );
-    m_sendMachine[0].init( txDelay, packetSizeInBytes, 0 );
-    m_sendMachine[1].init( txDelay, packetSizeInBytes, 1 );
+    m_sendMachine[0].init( txDelay, packetSizeInBytes, 0, payloadFree );
+    m_sendMachine[1].init( txDelay, packetSizeInBytes, 1, payloadFree );
     m_memRgnM.resize( m_vNicV.size() );
 
     float dmaBW  = params.find_floating( "dmaBW_GBs", 0.0 ); 
@@ -117,6 +133,10 @@ Nic::~Nic()
         delete m_vNicV[i];
     }
 	delete m_arbitrateDMA;
+
+    for ( size_t i = 0; i < m_selfEventPool.size(); i++ ) {
+        delete m_selfEventPool[i];
+    }
 }
 
 void Nic::printStatus(Output &out)
@@ -171,14 +191,23 @@ void Nic::handleVnicEvent( Event* ev, int id )
 void Nic::handleSelfEvent( Event *e )
 {
     SelfEvent* event = static_cast<SelfEvent*>(e);
-    
-    if ( event->callback ) {
-        event->callback();
+
+    // callbacks scheduled from here on go into a new event
+    if ( event == m_lastSelfEvent ) {
+        m_lastSelfEvent = NULL;
+    }
+
+    if ( ! event->callbacks.empty() ) {
+        for ( size_t i = 0; i < event->callbacks.size(); i++ ) {
+            event->callbacks[i]();
+        }
+        event->callbacks.clear();
     } else if ( event->entry ) {
         m_sendMachine[0].run( static_cast<SendEntry*>(event->entry) );
+        event->entry = NULL;
     }
 
-    delete e;
+    m_selfEventPool.push_back( event );
 }
 
 void Nic::dmaSend( NicCmdEvent *e, int vNicNum )
@@ -21,6 +21,7 @@
 //#include "sst/elements/merlin/linkControl.h"
 #include "ioVec.h"
 #include "merlinEvent.h"
+#include "inlineCallback.h"
 
 namespace SST {
 namespace Firefly {
@@ -172,10 +173,15 @@ class Nic : public SST::Component  {
     typedef uint32_t NodeId;
     static const NodeId AnyId = -1;
 
+    // the state machines bind a callback or two per packet, keep the
+    // bound state out of the heap
+    typedef InlineCallback Callback;
+
   private:
 
     struct MsgHdr {
         enum Op { Msg, Rdma } op;
+        bool   flow;    // rest of the message follows as an analytic flow
         size_t len;
         int    tag;
         unsigned short    dst_vNicId;
@@ -183,17 +189,18 @@ class Nic : public SST::Component  {
     };
 
     class Entry;
+
+    // SelfEvents are recycled through m_selfEventPool; one event carries
+    // all callbacks scheduled for the same nanosecond in a row
     class SelfEvent : public SST::Event {
       public:
 
-        SelfEvent( Entry* entry) : 
-            entry(entry), callback(NULL) {}
-        SelfEvent( Callback _callback ) :
-            entry(NULL), callback( _callback) {}
-        
-        Entry*              entry;
-        Callback            callback;
-        
+        SelfEvent() : entry(NULL), when(0) {}
+
+        Entry*                  entry;
+        std::vector<Callback>   callbacks;
+        SimTime_t               when;
+
         NotSerializable(SelfEvent)
     };
 
@@ -525,7 +532,16 @@ public:
     }
 
     void schedCallback(  Callback callback, uint64_t delay = 0 ) {
-        schedEvent( new SelfEvent( callback ), delay);
+        SimTime_t when = getCurrentSimTimeNano() + delay;
+        if ( m_lastSelfEvent && m_lastSelfEvent->when == when ) {
+            m_lastSelfEvent->callbacks.push_back( std::move( callback ) );
+            return;
+        }
+        SelfEvent* event = allocSelfEvent();
+        event->callbacks.push_back( std::move( callback ) );
+        event->when = when;
+        m_lastSelfEvent = event;
+        schedEvent( event, delay );
     }
 
     void setNotifyOnSend( int vc ) {
@@ -553,6 +569,15 @@ public:
         m_selfLink->send( delay, event );
     }
 
+    SelfEvent* allocSelfEvent() {
+        if ( m_selfEventPool.empty() ) {
+            return new SelfEvent;
+        }
+        SelfEvent* event = m_selfEventPool.back();
+        m_selfEventPool.pop_back();
+        return event;
+    }
+
     void notifySendDmaDone( int vNicNum, void* key ) {
         m_vNicV[vNicNum]->notifySendDmaDone(  key );
     }
@@ -601,6 +626,8 @@ public:
     int                     m_myNodeId;
     int                     m_num_vNics;
     SST::Link*              m_selfLink;
+    std::vector<SelfEvent*> m_selfEventPool;
+    SelfEvent*              m_lastSelfEvent;
 
     // the interface to to Merlin
     // Merlin::LinkControl*                m_linkControl;
@@ -619,6 +646,36 @@ public:
   public:
 	int m_tracedPkt;
 	int m_tracedNode;
+
+    // Messages of at least m_flowThreshold bytes are sent as one head
+    // packet; the bytes that don't fit in it are charged against the
+    // injection or ejection link at link bandwidth instead of being
+    // packetized. Links inside the network are not modeled for flows.
+    size_t      m_flowThreshold;
+    size_t      m_packetSizeInBytes;
+    double      m_linkBytesPerNs;
+    SimTime_t   m_injectFreeAt;
+
+    bool isFlow( size_t bytes ) {
+        return m_flowThreshold && bytes >= m_flowThreshold;
+    }
+
+    size_t flowBytes( size_t bytes ) {
+        return bytes > m_packetSizeInBytes ? bytes - m_packetSizeInBytes : 0;
+    }
+
+    SimTime_t flowTime( size_t bytes ) {
+        return (SimTime_t) ( bytes / m_linkBytesPerNs );
+    }
+
+    // reserve the link starting at freeAt for `bytes` and return how long
+    // from now until the transfer is finished, in ns
+    SimTime_t flowDelay( SimTime_t& freeAt, size_t bytes ) {
+        SimTime_t now = getCurrentSimTimeNano();
+        SimTime_t start = freeAt > now ? freeAt : now;
+        freeAt = start + flowTime( bytes );
+        return freeAt - now;
+    }
 }; 
 
 } // namesapce Firefly 
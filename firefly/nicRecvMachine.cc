@@ -57,18 +57,16 @@ void Nic::RecvMachine::state_1(  FireflyNetworkEvent* ev )
 #endif
     MsgHdr& hdr = *(MsgHdr*) ev->bufPtr();
 
+    // the bytes of a flow that didn't travel in the head packet arrive
+    // at ejection link bandwidth, the machine is held until they have
+    SimTime_t flowDelay = 0;
+    if ( hdr.flow ) {
+        flowDelay = m_nic.flowTime( m_nic.flowBytes( ev->bufSize() ) );
+    }
+
     if ( MsgHdr::Msg == hdr.op ) {
         m_dbg.verbose(CALL_INFO,1,32,"Msg Operation\n");
-
-        Callback callback;
-        if ( findRecv( ev->src, hdr ) ) {
-            ev->bufPop( sizeof(MsgHdr) );
-
-            callback = std::bind( &Nic::RecvMachine::state_move_0, this, ev );
-        } else {
-            callback = std::bind( &Nic::RecvMachine::state_2, this, ev );
-        }
-        m_nic.schedCallback( callback, m_rxMatchDelay);
+        state_match( ev, flowDelay );
     } else if ( MsgHdr::Rdma == hdr.op ) {
 
         m_dbg.verbose(CALL_INFO,1,32,"RDMA Operation\n");
@@ -85,6 +83,7 @@ void Nic::RecvMachine::state_1(  FireflyNetworkEvent* ev )
 
             assert( findPut( ev->src, hdr, rdmaHdr ) );
             callback = std::bind( &Nic::RecvMachine::state_move_0, this, ev );
+            delay = flowDelay;
             break;
 
           case RdmaMsgHdr::Get:
@@ -107,13 +106,32 @@ void Nic::RecvMachine::state_1(  FireflyNetworkEvent* ev )
     }
 }
 
+// Match a message, an unexpected one keeps its flow delay until it matches
+void Nic::RecvMachine::state_match( FireflyNetworkEvent* ev,
+                                                SimTime_t flowDelay )
+{
+    MsgHdr& hdr = *(MsgHdr*) ev->bufPtr();
+
+    if ( findRecv( ev->src, hdr ) ) {
+        ev->bufPop( sizeof(MsgHdr) );
+
+        m_nic.schedCallback(
+            std::bind( &Nic::RecvMachine::state_move_0, this, ev ),
+            m_rxMatchDelay + flowDelay );
+    } else {
+        m_nic.schedCallback(
+            std::bind( &Nic::RecvMachine::state_2, this, ev, flowDelay ),
+            m_rxMatchDelay );
+    }
+}
+
 // Need Recv
-void Nic::RecvMachine::state_2( FireflyNetworkEvent* ev )
+void Nic::RecvMachine::state_2( FireflyNetworkEvent* ev, SimTime_t flowDelay )
 {
     m_dbg.verbose(CALL_INFO,1,32,"\n");
     processNeedRecv( 
         ev,
-        std::bind( &Nic::RecvMachine::state_0, this, ev )
+        std::bind( &Nic::RecvMachine::state_match, this, ev, flowDelay )
     );
 }
 
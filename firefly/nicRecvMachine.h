@@ -56,7 +56,8 @@ class RecvMachine {
       private:
         void state_0( FireflyNetworkEvent* );
         void state_1( FireflyNetworkEvent* );
-        void state_2( FireflyNetworkEvent* );
+        void state_match( FireflyNetworkEvent*, SimTime_t flowDelay );
+        void state_2( FireflyNetworkEvent*, SimTime_t flowDelay );
         void state_3( SendEntry* );
         void state_move_0( FireflyNetworkEvent* );
         void state_move_1( FireflyNetworkEvent* );
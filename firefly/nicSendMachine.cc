@@ -37,13 +37,14 @@ void Nic::SendMachine::state_0( SendEntry* entry )
     hdr.len = entry->totalBytes();
     hdr.dst_vNicId = entry->dst_vNic();
     hdr.src_vNicId = entry->local_vNic(); 
+    hdr.flow = m_nic.isFlow( entry->totalBytes() );
 
     m_dbg.verbose(CALL_INFO,1,16,"%d: setup hdr, src_vNic=%d, send dstNid=%d "
                     "dst_vNic=%d tag=%#x bytes=%lu\n", m_vc,
                     hdr.src_vNicId, entry->node(), 
                     hdr.dst_vNicId, hdr.tag, entry->totalBytes() ) ;
 
-    FireflyNetworkEvent* ev = new FireflyNetworkEvent;
+    FireflyNetworkEvent* ev = newNetworkEvent();
     ev->bufAppend( &hdr, sizeof(hdr) );
 
     m_nic.schedCallback( 
@@ -75,10 +76,18 @@ void Nic::SendMachine::state_2( SendEntry* entry, FireflyNetworkEvent *ev )
     m_dbg.verbose(CALL_INFO,2,16,"%d: send network packet\n",m_vc);
     assert( ev->bufSize() );
 
+    // a flow only puts its head packet on the network
+    size_t flowBytes = 0;
+    size_t wireBytes = ev->bufSize();
+    if ( m_nic.isFlow( entry->totalBytes() ) ) {
+        flowBytes = m_nic.flowBytes( wireBytes );
+        wireBytes -= flowBytes;
+    }
+
     SimpleNetwork::Request* req = new SimpleNetwork::Request();
     req->dest = m_nic.IdToNet( entry->node() );
     req->src = m_nic.IdToNet( m_nic.m_myNodeId );
-    req->size_in_bits = ev->bufSize() * 8;
+    req->size_in_bits = wireBytes * 8;
     req->vn = 0;
     req->givePayload( ev );
 
@@ -95,17 +104,15 @@ void Nic::SendMachine::state_2( SendEntry* entry, FireflyNetworkEvent *ev )
     assert( sent );
 
     if ( entry->isDone() ) {
-        m_dbg.verbose(CALL_INFO,1,16,"%d: send entry done\n",m_vc);
-        entry->notify();
-        delete entry;
-
-        if ( ! canSend( m_packetSizeInBytes ) ) {
-            m_dbg.verbose(CALL_INFO,2,16,"%d: send busy\n",m_vc);
-            setCanSendCallback( 
-                std::bind( &Nic::SendMachine::state_3, this ) 
+        if ( flowBytes ) {
+            m_dbg.verbose(CALL_INFO,1,16,"%d: flow of %lu bytes\n",m_vc,
+                                                            flowBytes);
+            m_nic.schedCallback(
+                std::bind( &Nic::SendMachine::state_4, this, entry ),
+                m_nic.flowDelay( m_nic.m_injectFreeAt, flowBytes )
             );
         } else {
-            state_3();
+            state_4( entry );
         }
 
     } else {
@@ -113,28 +120,48 @@ void Nic::SendMachine::state_2( SendEntry* entry, FireflyNetworkEvent *ev )
             m_dbg.verbose(CALL_INFO,2,16,"%d: send busy\n",m_vc);
             setCanSendCallback( 
                 std::bind( &Nic::SendMachine::state_1, this, 
-                                        entry, new FireflyNetworkEvent ) 
+                                        entry, newNetworkEvent() ) 
             );
         } else {
-            state_1( entry, new FireflyNetworkEvent );
+            state_1( entry, newNetworkEvent() );
         }
     }
 }    
 
+void Nic::SendMachine::state_4( SendEntry* entry )
+{
+    m_dbg.verbose(CALL_INFO,1,16,"%d: send entry done\n",m_vc);
+    entry->notify();
+    delete entry;
+
+    if ( ! canSend( m_packetSizeInBytes ) ) {
+        m_dbg.verbose(CALL_INFO,2,16,"%d: send busy\n",m_vc);
+        setCanSendCallback( 
+            std::bind( &Nic::SendMachine::state_3, this ) 
+        );
+    } else {
+        state_3();
+    }
+}
+
 void Nic::SendMachine::copyOut( Output& dbg,
                     FireflyNetworkEvent& event, Nic::Entry& entry )
 {
     dbg.verbose(CALL_INFO,3,16,"%d: ioVec.size()=%lu\n", m_vc, entry.ioVec().size() );
 
+    // a flow goes out as a single event
+    size_t maxBytes = m_nic.isFlow( entry.totalBytes() ) ?
+                        (size_t) -1 : m_packetSizeInBytes;
+
     for ( ; entry.currentVec < entry.ioVec().size() &&
-                event.bufSize() <  m_packetSizeInBytes;
+                event.bufSize() <  maxBytes;
                 entry.currentVec++, entry.currentPos = 0 ) {
 
         dbg.verbose(CALL_INFO,3,1,"vec[%lu].len %lu\n",entry.currentVec,
                     entry.ioVec()[entry.currentVec].len );
 
         if ( entry.ioVec()[entry.currentVec].len ) {
-            size_t toLen = m_packetSizeInBytes - event.bufSize();
+            size_t toLen = maxBytes - event.bufSize();
             size_t fromLen = entry.ioVec()[entry.currentVec].len -
                                                         entry.currentPos;
 
@@ -147,14 +174,18 @@ void Nic::SendMachine::copyOut( Output& dbg,
                     (const char*) entry.ioVec()[entry.currentVec].ptr + 
                                                         entry.currentPos;
 
-            if ( entry.ioVec()[entry.currentVec].ptr ) {
+            // in payload free mode only the leading vector, which holds
+            // the upper layer's protocol header, is carried, the rest of
+            // the message is accounted for by length alone
+            if ( entry.ioVec()[entry.currentVec].ptr &&
+                        ( ! m_payloadFree || 0 == entry.currentVec ) ) {
                 event.bufAppend( from, len );
             } else {
                 event.bufAppend( NULL, len );
             }
 
             entry.currentPos += len;
-            if ( event.bufSize() == m_packetSizeInBytes &&
+            if ( event.bufSize() == maxBytes &&
                     entry.currentPos != entry.ioVec()[entry.currentVec].len ) {
                 break;
             }
@@ -25,10 +25,12 @@ class SendMachine {
 
         ~SendMachine();
 
-        void init( int txDelay, int packetSizeInBytes, int vc ) {
+        void init( int txDelay, int packetSizeInBytes, int vc,
+                                        bool payloadFree = false ) {
             m_txDelay = txDelay;
             m_packetSizeInBytes = packetSizeInBytes;
 			m_vc = vc;
+            m_payloadFree = payloadFree;
         }
 
         void run( SendEntry* entry  ) {
@@ -63,6 +65,7 @@ class SendMachine {
         void state_0( SendEntry* );
         void state_1( SendEntry*, FireflyNetworkEvent* );
         void state_2( SendEntry*, FireflyNetworkEvent* );
+        void state_4( SendEntry* );
         void state_3( ) {
             if ( ! canSend( m_packetSizeInBytes ) ) {
                 m_dbg.verbose(CALL_INFO,2,16,"%d: send busy\n",m_vc);
@@ -80,6 +83,13 @@ class SendMachine {
         void copyOut( Output& dbg, FireflyNetworkEvent& event,
                                             Nic::Entry& entry );
 
+        // payload free packets only ever hold the headers, don't reserve
+        // room for a full packet of data
+        FireflyNetworkEvent* newNetworkEvent() {
+            return m_payloadFree ? new FireflyNetworkEvent( size_t(0) ) :
+                                    new FireflyNetworkEvent;
+        }
+
         Nic&        m_nic;
         Output&     m_dbg;
 
@@ -89,6 +99,7 @@ class SendMachine {
         int                     m_packetId;
         Callback                m_notifyCallback;
 		int						m_vc;
+        bool                    m_payloadFree;
 #ifdef NIC_SEND_DEBUG
         unsigned int            m_msgCount;
 #endif
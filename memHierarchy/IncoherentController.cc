@@ -31,7 +31,7 @@ using namespace SST::MemHierarchy;
 /**
  *  Handle eviction. Stall if eviction candidate is in transition.
  */
-CacheAction IncoherentController::handleEviction(CacheLine* wbCacheLine, string origRqstr, bool ignoredParam) {
+CacheAction IncoherentController::handleEviction(CacheLine* wbCacheLine, NodeID origRqstr, bool ignoredParam) {
     State state = wbCacheLine->getState();
     recordEvictionState(state);
     
@@ -322,7 +322,7 @@ CacheAction IncoherentController::handleDataResponse(MemEvent* responseEvent, Ca
  *  Send writeback to lower level cache
  *  Latency: cache access + tag to read data that is being written back and update coherence state
  */
-void IncoherentController::sendWriteback(Command cmd, CacheLine* cacheLine, string origRqstr){
+void IncoherentController::sendWriteback(Command cmd, CacheLine* cacheLine, NodeID origRqstr){
     MemEvent* newCommandEvent = new MemEvent((SST::Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), cmd);
     newCommandEvent->setDst(getDestination(cacheLine->getBaseAddr()));
     newCommandEvent->setSize(cacheLine->getSize());
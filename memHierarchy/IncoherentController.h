@@ -44,7 +44,7 @@ public:
 /* Event handlers */
     /* Public event handlers called by cache controller */
     /** Send cache line data to the lower level caches */
-    CacheAction handleEviction(CacheLine* _wbCacheLine, string _origRqstr, bool ignoredParameter=false);
+    CacheAction handleEviction(CacheLine* _wbCacheLine, NodeID _origRqstr, bool ignoredParameter=false);
 
     /** Process cache request:  GetX, GetS, GetSEx */
     CacheAction handleRequest(MemEvent* event, CacheLine* cacheLine, bool replay);
@@ -85,7 +85,7 @@ private:
     
 /* Private methods for sending events */
     /** Send writeback request to lower level caches */
-    void sendWriteback(Command cmd, CacheLine* cacheLine, string origRqstr);
+    void sendWriteback(Command cmd, CacheLine* cacheLine, NodeID origRqstr);
     
 /* Helper methods */
    
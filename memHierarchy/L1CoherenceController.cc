@@ -29,7 +29,7 @@ using namespace SST::MemHierarchy;
  *      isRetryNeeded
  */
   
-CacheAction L1CoherenceController::handleEviction(CacheLine* wbCacheLine, string origRqstr, bool ignoredParam) {
+CacheAction L1CoherenceController::handleEviction(CacheLine* wbCacheLine, NodeID origRqstr, bool ignoredParam) {
     State state = wbCacheLine->getState();
    
     /* L1 specific code */
@@ -215,7 +215,7 @@ CacheAction L1CoherenceController::handleGetSRequest(MemEvent* event, CacheLine*
     State state = cacheLine->getState();
     vector<uint8_t>* data = cacheLine->getData();
     
-    bool shouldRespond = !(event->isPrefetch() && (event->getRqstr() == name_));
+    bool shouldRespond = !(event->isPrefetch() && (event->getRqstrID() == nameID_));
     recordStateEventCount(event->getCmd(), state);
     uint64_t sendTime = 0;
     switch (state) {
@@ -310,7 +310,7 @@ CacheAction L1CoherenceController::handleGetXRequest(MemEvent* event, CacheLine*
  */
 void L1CoherenceController::handleDataResponse(MemEvent* responseEvent, CacheLine* cacheLine, MemEvent* origRequest){
     
-    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstr() == name_));
+    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstrID() == nameID_));
     
     State state = cacheLine->getState();
     recordStateEventCount(responseEvent->getCmd(), state);
@@ -384,11 +384,11 @@ CacheAction L1CoherenceController::handleInv(MemEvent* event, CacheLine* cacheLi
         case IM:
             return IGNORE;  // Our Put raced with the invalidation and will serve as the AckInv when it arrives
         case S:
-            sendAckInv(event->getBaseAddr(), event->getRqstr(), cacheLine);
+            sendAckInv(event->getBaseAddr(), event->getRqstrID(), cacheLine);
             cacheLine->setState(I);
             return DONE;
         case SM:
-            sendAckInv(event->getBaseAddr(), event->getRqstr(), cacheLine);
+            sendAckInv(event->getBaseAddr(), event->getRqstrID(), cacheLine);
             cacheLine->setState(IM);
             return DONE;
         default:
@@ -508,7 +508,7 @@ int L1CoherenceController::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine
     if (cmd == GetSEx) cmd = GetX;  // for our purposes these are equal
 
     if (state == I) return 1;
-    if (event->isPrefetch() && event->getRqstr() == name_) return 0;
+    if (event->isPrefetch() && event->getRqstrID() == nameID_) return 0;
     
     switch (state) {
         case S:
@@ -563,7 +563,7 @@ void L1CoherenceController::sendResponseDown(MemEvent* event, CacheLine* cacheLi
 uint64_t L1CoherenceController::sendResponseUp(MemEvent * event, State grantedState, std::vector<uint8_t>* data, bool replay, uint64_t baseTime, bool finishedAtomically) {
     Command cmd = event->getCmd();
     MemEvent * responseEvent = event->makeResponse(grantedState);
-    responseEvent->setDst(event->getSrc());
+    responseEvent->setDst(event->getSrcID());
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
      
     if (!noncacheable) {
@@ -605,7 +605,7 @@ uint64_t L1CoherenceController::sendResponseUp(MemEvent * event, State grantedSt
  *  Handles: sending writebacks
  *  Latency: cache access + tag to read data that is being written back and update coherence state
  */
-void L1CoherenceController::sendWriteback(Command cmd, CacheLine* cacheLine, string origRqstr) {
+void L1CoherenceController::sendWriteback(Command cmd, CacheLine* cacheLine, NodeID origRqstr) {
     MemEvent* writeback = new MemEvent((SST::Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), cmd);
     writeback->setDst(getDestination(cacheLine->getBaseAddr()));
     writeback->setSize(cacheLine->getSize());
@@ -637,7 +637,7 @@ void L1CoherenceController::sendWriteback(Command cmd, CacheLine* cacheLine, str
  *  Handles: sending AckInv responses
  *  Latency: cache access + tag to update coherence state
  */
-void L1CoherenceController::sendAckInv(Addr baseAddr, string origRqstr, CacheLine * cacheLine) {
+void L1CoherenceController::sendAckInv(Addr baseAddr, NodeID origRqstr, CacheLine * cacheLine) {
     MemEvent* ack = new MemEvent((SST::Component*)owner_, baseAddr, baseAddr, AckInv);
     ack->setDst(getDestination(baseAddr));
     ack->setRqstr(origRqstr);
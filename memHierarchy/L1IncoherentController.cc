@@ -33,7 +33,7 @@ using namespace SST::MemHierarchy;
  *      isRetryNeeded 
  */
   
-CacheAction L1IncoherentController::handleEviction(CacheLine* wbCacheLine, string origRqstr, bool ignoredParam) {
+CacheAction L1IncoherentController::handleEviction(CacheLine* wbCacheLine, NodeID origRqstr, bool ignoredParam) {
     State state = wbCacheLine->getState();
    
     /* L1 specific code */
@@ -151,7 +151,7 @@ CacheAction L1IncoherentController::handleGetSRequest(MemEvent* event, CacheLine
     State state = cacheLine->getState();
     vector<uint8_t>* data = cacheLine->getData();
     
-    bool shouldRespond = !(event->isPrefetch() && (event->getRqstr() == name_));
+    bool shouldRespond = !(event->isPrefetch() && (event->getRqstrID() == nameID_));
     recordStateEventCount(event->getCmd(), state);
     
     uint64_t sendTime = 0;
@@ -236,7 +236,7 @@ CacheAction L1IncoherentController::handleGetXRequest(MemEvent* event, CacheLine
 void L1IncoherentController::handleDataResponse(MemEvent* responseEvent, CacheLine* cacheLine, MemEvent* origRequest){
     
     cacheLine->setData(responseEvent->getPayload(), responseEvent);
-    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstr() == name_));
+    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstrID() == nameID_));
     
     State state = cacheLine->getState();
     recordStateEventCount(responseEvent->getCmd(), state);
@@ -308,7 +308,7 @@ int L1IncoherentController::isCoherenceMiss(MemEvent* event, CacheLine* cacheLin
 uint64_t L1IncoherentController::sendResponseUp(MemEvent * event, State grantedState, std::vector<uint8_t>* data, bool replay, uint64_t baseTime, bool finishedAtomically) {
     Command cmd = event->getCmd();
     MemEvent * responseEvent = event->makeResponse(grantedState);
-    responseEvent->setDst(event->getSrc());
+    responseEvent->setDst(event->getSrcID());
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
     
     if (!noncacheable) {
@@ -344,7 +344,7 @@ uint64_t L1IncoherentController::sendResponseUp(MemEvent * event, State grantedS
  *  Handles: sending writebacks
  *  Latency: cache access + tag to read data that is being written back and update coherence state
  */
-void L1IncoherentController::sendWriteback(Command cmd, CacheLine* cacheLine, string origRqstr){
+void L1IncoherentController::sendWriteback(Command cmd, CacheLine* cacheLine, NodeID origRqstr){
     MemEvent* writeback = new MemEvent((SST::Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), cmd);
     writeback->setDst(getDestination(cacheLine->getBaseAddr()));
     writeback->setSize(cacheLine->getSize());
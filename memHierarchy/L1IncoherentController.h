@@ -43,7 +43,7 @@ public:
     
     /* Event handlers called by cache controller */
     /** Send cache line data to the lower level caches */
-    CacheAction handleEviction(CacheLine* wbCacheLine, string origRqstr, bool ignoredParam=false);
+    CacheAction handleEviction(CacheLine* wbCacheLine, NodeID origRqstr, bool ignoredParam=false);
 
     /** Process new cache request:  GetX, GetS, GetSEx */
     CacheAction handleRequest(MemEvent* event, CacheLine* cacheLine, bool replay);
@@ -82,7 +82,7 @@ private:
     
     /* Methods for sending events */
     /** Send writeback request to lower level caches */
-    void sendWriteback(Command cmd, CacheLine* cacheLine, string origRqstr);
+    void sendWriteback(Command cmd, CacheLine* cacheLine, NodeID origRqstr);
 
 };
 
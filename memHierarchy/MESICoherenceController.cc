@@ -34,7 +34,7 @@ using namespace SST::MemHierarchy;
  *  LLCs and caches writing back to non-inclusive caches wait for AckPuts before sending further events for the evicted address
  *  This prevents races if the writeback is NACKed.
  */
-CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr, bool ignoredParam) {
+CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, NodeID rqstr, bool ignoredParam) {
     State state = wbCacheLine->getState();
     recordEvictionState(state);
 
@@ -59,7 +59,7 @@ CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr,
                 return DONE;
             }
             if (wbCacheLine->numSharers() > 0) {
-                invalidateAllSharers(wbCacheLine, name_, false); 
+                invalidateAllSharers(wbCacheLine, nameID_, false); 
                 wbCacheLine->setState(SI);
 #ifdef __SST_DEBUG_OUTPUT__
                 if (DEBUG_ALL || DEBUG_ADDR == wbBaseAddr) d_->debug(_L7_, "Eviction requires invalidating sharers\n");
@@ -76,7 +76,7 @@ CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr,
                 return DONE;
             }
             if (wbCacheLine->numSharers() > 0) {
-                invalidateAllSharers(wbCacheLine, name_, false); 
+                invalidateAllSharers(wbCacheLine, nameID_, false); 
                 wbCacheLine->setState(EI);
 #ifdef __SST_DEBUG_OUTPUT__
                 if (DEBUG_ALL || DEBUG_ADDR == wbBaseAddr) d_->debug(_L7_, "Eviction requires invalidating sharers\n");
@@ -84,7 +84,7 @@ CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr,
                 return STALL;
             }
             if (wbCacheLine->ownerExists()) {
-                sendFetchInv(wbCacheLine, name_, false);
+                sendFetchInv(wbCacheLine, nameID_, false);
                 mshr_->incrementAcksNeeded(wbBaseAddr);
                 wbCacheLine->setState(EI);
 #ifdef __SST_DEBUG_OUTPUT__
@@ -102,7 +102,7 @@ CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr,
                 return DONE;
             }
             if (wbCacheLine->numSharers() > 0) {
-                invalidateAllSharers(wbCacheLine, name_, false); 
+                invalidateAllSharers(wbCacheLine, nameID_, false); 
                 wbCacheLine->setState(MI);
 #ifdef __SST_DEBUG_OUTPUT__
                 if (DEBUG_ALL || DEBUG_ADDR == wbBaseAddr) d_->debug(_L7_, "Eviction requires invalidating sharers\n");
@@ -110,7 +110,7 @@ CacheAction MESIController::handleEviction(CacheLine* wbCacheLine, string rqstr,
                 return STALL;
             }
             if (wbCacheLine->ownerExists()) {
-                sendFetchInv(wbCacheLine, name_, false);
+                sendFetchInv(wbCacheLine, nameID_, false);
                 mshr_->incrementAcksNeeded(wbBaseAddr);
                 wbCacheLine->setState(MI);
 #ifdef __SST_DEBUG_OUTPUT__
@@ -278,11 +278,11 @@ bool MESIController::isRetryNeeded(MemEvent* event, CacheLine* cacheLine) {
         case FetchInv:
         case FetchInvX:
             if (state == I) return false;   // Already resolved the request, don't resend
-            if (cacheLine->getOwner() != event->getDst()) return false;    // Must have gotten a replacement from this owner
+            if (cacheLine->getOwner() != event->getDstID()) return false;    // Must have gotten a replacement from this owner
             return true;
         case Inv:
             if (state == I) return false;   // Already resolved the request, don't resend
-            if (!cacheLine->isSharer(event->getDst())) return false;    // Must have gotten a replacement from this sharer
+            if (!cacheLine->isSharer(event->getDstID())) return false;    // Must have gotten a replacement from this sharer
             return true;
         default:
             d_->fatal(CALL_INFO,-1,"%s, Error: NACKed event is unrecognized: %s. Addr = 0x%" PRIx64 ", Src = %s. Time = %" PRIu64 "ns\n",
@@ -304,7 +304,7 @@ int MESIController::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine) {
     if (cmd == GetSEx) cmd = GetX;  // for our purposes these are equal
 
     if (state == I) return 1;
-    if (event->isPrefetch() && event->getRqstr() == name_) return 0;
+    if (event->isPrefetch() && event->getRqstrID() == nameID_) return 0;
     
     switch (state) {
         case S:
@@ -315,7 +315,7 @@ int MESIController::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine) {
             if (cacheLine->ownerExists()) return 3;
             if (cmd == GetS) return 0;  // hit
             if (cmd == GetX) {
-                if (cacheLine->isShareless() || (cacheLine->isSharer(event->getSrc()) && cacheLine->numSharers() == 1)) return 0; // Hit
+                if (cacheLine->isShareless() || (cacheLine->isSharer(event->getSrcID()) && cacheLine->numSharers() == 1)) return 0; // Hit
             }
             return 3;
         case IS:
@@ -349,7 +349,7 @@ CacheAction MESIController::handleGetSRequest(MemEvent* event, CacheLine* cacheL
 #endif
     
     uint64_t sendTime = 0;
-    bool shouldRespond = !(event->isPrefetch() && (event->getRqstr() == name_));
+    bool shouldRespond = !(event->isPrefetch() && (event->getRqstrID() == nameID_));
     recordStateEventCount(event->getCmd(), state);
     switch (state) {
         case I:
@@ -361,7 +361,7 @@ CacheAction MESIController::handleGetSRequest(MemEvent* event, CacheLine* cacheL
         case S:
             notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
             if (!shouldRespond) return DONE;
-            cacheLine->addSharer(event->getSrc());
+            cacheLine->addSharer(event->getSrcID());
             sendTime = sendResponseUp(event, S, data, replay, cacheLine->getTimestamp());
             cacheLine->setTimestamp(sendTime);
             return DONE;
@@ -375,7 +375,7 @@ CacheAction MESIController::handleGetSRequest(MemEvent* event, CacheLine* cacheL
             if (!inclusive_) {
                 sendTime = sendResponseUp(event, state, data, replay, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
-                cacheLine->setOwner(event->getSrc());
+                cacheLine->setOwner(event->getSrcID());
                 return DONE;
             }
 
@@ -383,7 +383,7 @@ CacheAction MESIController::handleGetSRequest(MemEvent* event, CacheLine* cacheL
 #ifdef __SST_DEBUG_OUTPUT__
                 if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_, "New owner: %s\n", event->getSrc().c_str());
 #endif
-                cacheLine->setOwner(event->getSrc());
+                cacheLine->setOwner(event->getSrcID());
                 sendTime = sendResponseUp(event, E, data, replay, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
                 return DONE;
@@ -392,13 +392,13 @@ CacheAction MESIController::handleGetSRequest(MemEvent* event, CacheLine* cacheL
 #ifdef __SST_DEBUG_OUTPUT__
                 if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_,"GetS request but exclusive owner exists \n");
 #endif
-                sendFetchInvX(cacheLine, event->getRqstr(), replay);
+                sendFetchInvX(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 if (state == E) cacheLine->setState(E_InvX);
                 else cacheLine->setState(M_InvX);
                 return STALL;
             }
-            cacheLine->addSharer(event->getSrc());
+            cacheLine->addSharer(event->getSrcID());
             sendTime = sendResponseUp(event, S, data, replay, cacheLine->getTimestamp());
             cacheLine->setTimestamp(sendTime);
             return DONE;
@@ -430,7 +430,7 @@ CacheAction MESIController::handleGetXRequest(MemEvent* event, CacheLine* cacheL
         case S:
             notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
             sendTime = forwardMessage(event, cacheLine->getBaseAddr(), cacheLine->getSize(), cacheLine->getTimestamp(), NULL);
-            if (invalidateSharersExceptRequestor(cacheLine, event->getSrc(), event->getRqstr(), replay)) {
+            if (invalidateSharersExceptRequestor(cacheLine, event->getSrcID(), event->getRqstrID(), replay)) {
                 cacheLine->setState(SM_Inv);
             } else {
                 cacheLine->setState(SM);
@@ -443,19 +443,19 @@ CacheAction MESIController::handleGetXRequest(MemEvent* event, CacheLine* cacheL
             notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
 
             if (!cacheLine->isShareless()) {
-                if (invalidateSharersExceptRequestor(cacheLine, event->getSrc(), event->getRqstr(), replay)) {
+                if (invalidateSharersExceptRequestor(cacheLine, event->getSrcID(), event->getRqstrID(), replay)) {
                     cacheLine->setState(M_Inv);
                     return STALL;
                 }
             }
             if (cacheLine->ownerExists()) {
-                sendFetchInv(cacheLine, event->getRqstr(), replay);
+                sendFetchInv(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(M_Inv);
                 return STALL;
             }
-            cacheLine->setOwner(event->getSrc());
-            if (cacheLine->isSharer(event->getSrc())) cacheLine->removeSharer(event->getSrc());
+            cacheLine->setOwner(event->getSrcID());
+            if (cacheLine->isSharer(event->getSrcID())) cacheLine->removeSharer(event->getSrcID());
             sendTime = sendResponseUp(event, M, cacheLine->getData(), replay, cacheLine->getTimestamp());
             cacheLine->setTimestamp(sendTime);
 #ifdef __SST_DEBUG_OUTPUT__
@@ -508,8 +508,8 @@ CacheAction MESIController::handlePutSRequest(MemEvent* event, CacheLine* line,
     } 
     if (mshr_->getAcksNeeded(event->getBaseAddr()) > 0) mshr_->decrementAcksNeeded(event->getBaseAddr());
 
-    if (line->isSharer(event->getSrc())) {
-        line->removeSharer(event->getSrc());
+    if (line->isSharer(event->getSrcID())) {
+        line->removeSharer(event->getSrcID());
     }
     
     bool retry = (mshr_->getAcksNeeded(event->getBaseAddr()) == 0);
@@ -527,17 +527,17 @@ CacheAction MESIController::handlePutSRequest(MemEvent* event, CacheLine* line,
             return DONE;
         /* Races with evictions */
         case SI:
-            sendWriteback(PutS, line, false, name_);
+            sendWriteback(PutS, line, false, nameID_);
             if (expectWritebackAck_) mshr_->insertWriteback(line->getBaseAddr());
             line->setState(I);
             return DONE;
         case EI:
-            sendWriteback(PutE, line, false, name_);
+            sendWriteback(PutE, line, false, nameID_);
             if (expectWritebackAck_) mshr_->insertWriteback(line->getBaseAddr());
             line->setState(I);
             return DONE;
         case MI:
-            sendWriteback(PutM, line, true, name_);
+            sendWriteback(PutM, line, true, nameID_);
             if (expectWritebackAck_) mshr_->insertWriteback(line->getBaseAddr());
             line->setState(I);
             return DONE;
@@ -549,7 +549,7 @@ CacheAction MESIController::handlePutSRequest(MemEvent* event, CacheLine* line,
         /* Races with Invs and FetchInvs from outside our sub-hierarchy; races with GetX from within our sub-hierarchy*/
         case S_Inv:
             if (reqEvent->getCmd() == Inv) {
-                sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstr());
+                sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstrID());
                 line->setState(I);
             } else {
                 sendResponseDown(reqEvent, line, false, true);
@@ -565,8 +565,8 @@ CacheAction MESIController::handlePutSRequest(MemEvent* event, CacheLine* line,
                 sendResponseDown(reqEvent, line, true, true);
                 line->setState(I);
             } else if (reqEvent->getCmd() == GetX || reqEvent->getCmd() == GetSEx) {
-                line->setOwner(reqEvent->getSrc());
-                if (line->isSharer(reqEvent->getSrc())) line->removeSharer(reqEvent->getSrc());
+                line->setOwner(reqEvent->getSrcID());
+                if (line->isSharer(reqEvent->getSrcID())) line->removeSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, M, line->getData(), true, line->getTimestamp());
                 line->setTimestamp(sendTime);
                 line->setState(M);
@@ -578,10 +578,10 @@ CacheAction MESIController::handlePutSRequest(MemEvent* event, CacheLine* line,
         case SM_Inv:
             if (reqEvent->getCmd() == Inv) {
                 if (line->numSharers() > 0) {
-                    invalidateAllSharers(line, reqEvent->getRqstr(), true);
+                    invalidateAllSharers(line, reqEvent->getRqstrID(), true);
                     return IGNORE;
                 } else {
-                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstr());
+                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstrID());
                     line->setState(IM);
                     return DONE;
                 }
@@ -653,15 +653,15 @@ CacheAction MESIController::handlePutMRequest(MemEvent* event, CacheLine* cacheL
         /* Races with evictions */
         case EI:
             if (event->getCmd() == PutM) {
-                sendWriteback(PutM, cacheLine, true, name_);
+                sendWriteback(PutM, cacheLine, true, nameID_);
             } else {
-                sendWriteback(PutE, cacheLine, false, name_);
+                sendWriteback(PutE, cacheLine, false, nameID_);
             }
 	    cacheLine->setState(I);    // wait for ack
             if (expectWritebackAck_) mshr_->insertWriteback(cacheLine->getBaseAddr());
             break;
         case MI:
-            sendWriteback(PutM, cacheLine, true, name_);
+            sendWriteback(PutM, cacheLine, true, nameID_);
 	    cacheLine->setState(I);    // wait for ack
             if (expectWritebackAck_) mshr_->insertWriteback(cacheLine->getBaseAddr());
             break;
@@ -678,7 +678,7 @@ CacheAction MESIController::handlePutMRequest(MemEvent* event, CacheLine* cacheL
             } else {
                 cacheLine->setState(M);
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                cacheLine->setOwner(reqEvent->getSrc());
+                cacheLine->setOwner(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, M, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
 #ifdef __SST_DEBUG_OUTPUT__
@@ -701,16 +701,16 @@ CacheAction MESIController::handlePutMRequest(MemEvent* event, CacheLine* cacheL
             } else if (!inclusive_) {
                 sendTime = sendResponseUp(reqEvent, state, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
-                cacheLine->setOwner(reqEvent->getSrc());
+                cacheLine->setOwner(reqEvent->getSrcID());
             } else if (protocol_) {
 #ifdef __SST_DEBUG_OUTPUT__
                 if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_, "New owner: %s\n", reqEvent->getSrc().c_str());
 #endif
-                cacheLine->setOwner(reqEvent->getSrc());
+                cacheLine->setOwner(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, E, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
             } else {
-                cacheLine->addSharer(reqEvent->getSrc());
+                cacheLine->addSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, S, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
             }
@@ -743,20 +743,20 @@ CacheAction MESIController::handleInv(MemEvent* event, CacheLine* cacheLine, boo
             return DONE;    // Eviction raced with Inv, IS/IM only happen if we don't use AckPuts
         case S:
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(S_Inv);
                 return STALL;
             }
-            sendAckInv(event->getBaseAddr(), event->getRqstr());
+            sendAckInv(event->getBaseAddr(), event->getRqstrID());
             cacheLine->setState(I);
             return DONE;
         case SM:
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(SM_Inv);
                 return STALL;
             }
-            sendAckInv(event->getBaseAddr(), event->getRqstr());
+            sendAckInv(event->getBaseAddr(), event->getRqstrID());
             cacheLine->setState(IM);
             return DONE;
         case S_Inv: // PutS in progress, stall this Inv for that
@@ -790,14 +790,14 @@ CacheAction MESIController::handleFetchInv(MemEvent * event, CacheLine * cacheLi
             return IGNORE;
         case S: // Happens when there is a non-inclusive cache below us
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(S_Inv);
                 return STALL;
             }
             break;  
         case SM:
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(SM_Inv);
                 return STALL;
             }
@@ -806,26 +806,26 @@ CacheAction MESIController::handleFetchInv(MemEvent * event, CacheLine * cacheLi
             return DONE;
         case E:
             if (cacheLine->ownerExists()) {
-                sendFetchInv(cacheLine, event->getRqstr(), replay);
+                sendFetchInv(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(E_Inv);
                 return STALL;
             }
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(E_Inv);
                 return STALL;
             }
             break;
         case M:
             if (cacheLine->ownerExists()) {
-                sendFetchInv(cacheLine, event->getRqstr(), replay);
+                sendFetchInv(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(M_Inv);
                 return STALL;
             }
             if (cacheLine->numSharers() > 0) {
-                invalidateAllSharers(cacheLine, event->getRqstr(), replay);
+                invalidateAllSharers(cacheLine, event->getRqstrID(), replay);
                 cacheLine->setState(M_Inv);
                 return STALL;
             }
@@ -866,7 +866,7 @@ CacheAction MESIController::handleFetchInvX(MemEvent * event, CacheLine * cacheL
             return IGNORE;
         case E:
             if (cacheLine->ownerExists()) {
-                sendFetchInvX(cacheLine, event->getRqstr(), replay);
+                sendFetchInvX(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(E_InvX);
                 return STALL;
@@ -874,7 +874,7 @@ CacheAction MESIController::handleFetchInvX(MemEvent * event, CacheLine * cacheL
             break;
         case M:
             if (cacheLine->ownerExists()) {
-                sendFetchInvX(cacheLine, event->getRqstr(), replay);
+                sendFetchInvX(cacheLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 cacheLine->setState(M_InvX);
                 return STALL;
@@ -946,7 +946,7 @@ CacheAction MESIController::handleDataResponse(MemEvent* responseEvent, CacheLin
     State state = cacheLine->getState();
     recordStateEventCount(responseEvent->getCmd(), state);
     
-    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstr() == name_));
+    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstrID() == nameID_));
     
     uint64_t sendTime = 0;
     
@@ -962,9 +962,9 @@ CacheAction MESIController::handleDataResponse(MemEvent* responseEvent, CacheLin
             notifyListenerOfAccess(origRequest, NotifyAccessType::READ, NotifyResultType::HIT);
             if (!shouldRespond) return DONE;
             if (cacheLine->getState() == E || cacheLine->getState() == M) {
-                cacheLine->setOwner(origRequest->getSrc());
+                cacheLine->setOwner(origRequest->getSrcID());
             } else {
-                cacheLine->addSharer(origRequest->getSrc());
+                cacheLine->addSharer(origRequest->getSrcID());
             }
             sendTime = sendResponseUp(origRequest, cacheLine->getState(), cacheLine->getData(), true, cacheLine->getTimestamp());
             cacheLine->setTimestamp(sendTime);
@@ -979,8 +979,8 @@ CacheAction MESIController::handleDataResponse(MemEvent* responseEvent, CacheLin
 #endif
         case SM:
             cacheLine->setState(M);
-            cacheLine->setOwner(origRequest->getSrc());
-            if (cacheLine->isSharer(origRequest->getSrc())) cacheLine->removeSharer(origRequest->getSrc());
+            cacheLine->setOwner(origRequest->getSrcID());
+            if (cacheLine->isSharer(origRequest->getSrcID())) cacheLine->removeSharer(origRequest->getSrcID());
             notifyListenerOfAccess(origRequest, NotifyAccessType::WRITE, NotifyResultType::HIT);
             sendTime = sendResponseUp(origRequest, M, cacheLine->getData(), true, cacheLine->getTimestamp());
             cacheLine->setTimestamp(sendTime);
@@ -1033,24 +1033,24 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
             sendResponseDownFromMSHR(responseEvent, reqEvent, responseEvent->getDirty());
             break;
         case EI:
-            sendWriteback(responseEvent->getDirty() ? PutM : PutE, cacheLine, responseEvent->getDirty(), name_);
+            sendWriteback(responseEvent->getDirty() ? PutM : PutE, cacheLine, responseEvent->getDirty(), nameID_);
 	    cacheLine->setState(I);    // wait for ack
             if (expectWritebackAck_) mshr_->insertWriteback(cacheLine->getBaseAddr());
             break;
         case MI:
-            sendWriteback(PutM, cacheLine, true, name_);
+            sendWriteback(PutM, cacheLine, true, nameID_);
 	    cacheLine->setState(I);    // wait for ack
             if (expectWritebackAck_) mshr_->insertWriteback(cacheLine->getBaseAddr());
             break;
         case E_InvX:
             cacheLine->clearOwner();
-            cacheLine->addSharer(responseEvent->getSrc());
+            cacheLine->addSharer(responseEvent->getSrcID());
             if (reqEvent->getCmd() == FetchInvX) {
                 sendResponseDownFromMSHR(responseEvent, reqEvent, responseEvent->getDirty());
                 cacheLine->setState(S);
             } else {
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                cacheLine->addSharer(reqEvent->getSrc());
+                cacheLine->addSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, S, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
                 if (responseEvent->getDirty()) cacheLine->setState(M);
@@ -1058,20 +1058,20 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
             }
             break;
         case E_Inv:
-            if (cacheLine->isSharer(responseEvent->getSrc())) cacheLine->removeSharer(responseEvent->getSrc());
-            if (cacheLine->getOwner() == responseEvent->getSrc()) cacheLine->clearOwner();
+            if (cacheLine->isSharer(responseEvent->getSrcID())) cacheLine->removeSharer(responseEvent->getSrcID());
+            if (cacheLine->getOwner() == responseEvent->getSrcID()) cacheLine->clearOwner();
             sendResponseDown(reqEvent, cacheLine, responseEvent->getDirty(), true);
             cacheLine->setState(I);
             break;
         case M_InvX:
             cacheLine->clearOwner();
-            cacheLine->addSharer(responseEvent->getSrc());
+            cacheLine->addSharer(responseEvent->getSrcID());
             if (reqEvent->getCmd() == FetchInvX) {
                 sendResponseDown(reqEvent, cacheLine, true, true);
                 cacheLine->setState(S);
             } else {    // reqEvent->getCmd() == GetS
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                cacheLine->addSharer(reqEvent->getSrc());
+                cacheLine->addSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, S, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
                 cacheLine->setState(M);
@@ -1084,8 +1084,8 @@ CacheAction MESIController::handleFetchResp(MemEvent * responseEvent, CacheLine*
                 cacheLine->setState(I);
             } else {    // reqEvent->getCmd() == GetX
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                cacheLine->setOwner(reqEvent->getSrc());
-                if (cacheLine->isSharer(reqEvent->getSrc())) cacheLine->removeSharer(reqEvent->getSrc());
+                cacheLine->setOwner(reqEvent->getSrcID());
+                if (cacheLine->isSharer(reqEvent->getSrcID())) cacheLine->removeSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, M, cacheLine->getData(), true, cacheLine->getTimestamp());
                 cacheLine->setTimestamp(sendTime);
 #ifdef __SST_DEBUG_OUTPUT__
@@ -1111,8 +1111,8 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
     
     recordStateEventCount(ack->getCmd(), state);
 
-    if (line && line->isSharer(ack->getSrc())) {
-        line->removeSharer(ack->getSrc());
+    if (line && line->isSharer(ack->getSrcID())) {
+        line->removeSharer(ack->getSrcID());
     }
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == ack->getBaseAddr()) d_->debug(_L6_, "Received AckInv for 0x%" PRIx64 ", acks needed: %d\n", ack->getBaseAddr(), mshr_->getAcksNeeded(ack->getBaseAddr()));
@@ -1125,7 +1125,7 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
     switch (state) {
         case I:
             if (action == DONE) {
-                sendAckInv(ack->getBaseAddr(), ack->getRqstr());
+                sendAckInv(ack->getBaseAddr(), ack->getRqstrID());
             }
             return action;
         case S_Inv:
@@ -1134,7 +1134,7 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
                     sendResponseDown(reqEvent, line, false, true);
                     line->setState(I);
                 } else {
-                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstr());
+                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstrID());
                     line->setState(I);
                 }
             }
@@ -1143,10 +1143,10 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
             if (action == DONE) {
                 if (reqEvent->getCmd() == Inv) {
                     if (line->numSharers() > 0) {
-                        invalidateAllSharers(line, reqEvent->getRqstr(), true);
+                        invalidateAllSharers(line, reqEvent->getRqstrID(), true);
                         return IGNORE;
                     } else {
-                        sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstr());
+                        sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstrID());
                         line->setState(IM);
                     }
                 } else if (reqEvent->getCmd() == FetchInv) {
@@ -1161,21 +1161,21 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
 
         case SI:
             if (action == DONE) {
-                sendWriteback(PutS, line, false, name_);
+                sendWriteback(PutS, line, false, nameID_);
                 if (expectWritebackAck_) mshr_->insertWriteback(line->getBaseAddr());
                 line->setState(I);
             }
             return action;
         case EI:
             if (action == DONE) {
-                sendWriteback(PutE, line, false, name_);
+                sendWriteback(PutE, line, false, nameID_);
                 if (expectWritebackAck_) mshr_->insertWriteback(line->getBaseAddr());
                 line->setState(I);
             }
             return action;
         case MI:
             if (action == DONE) {
-                sendWriteback(PutM, line, true, name_);
+                sendWriteback(PutM, line, true, nameID_);
                 if (expectWritebackAck_) mshr_->insertWriteback(line->getBaseAddr());
                 line->setState(I);
             }
@@ -1193,8 +1193,8 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
                     line->setState(I);
                 } else { // reqEvent->getCmd() == GetX/GetSEx
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    line->setOwner(reqEvent->getSrc());
-                    if (line->isSharer(reqEvent->getSrc())) line->removeSharer(reqEvent->getSrc());
+                    line->setOwner(reqEvent->getSrcID());
+                    if (line->isSharer(reqEvent->getSrcID())) line->removeSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, M, line->getData(), true, line->getTimestamp());
                     line->setTimestamp(sendTime);
 #ifdef __SST_DEBUG_OUTPUT__
@@ -1221,10 +1221,11 @@ CacheAction MESIController::handleAckInv(MemEvent * ack, CacheLine * line, MemEv
 /**
  *  Send an Inv to all sharers of the block. Used for evictions or Inv/FetchInv requests from lower level caches
  */
-void MESIController::invalidateAllSharers(CacheLine * cacheLine, string rqstr, bool replay) {
-    set<std::string> * sharers = cacheLine->getSharers();
+void MESIController::invalidateAllSharers(CacheLine * cacheLine, NodeID rqstr, bool replay) {
+    vector<NodeID> sharers;
+    cacheLine->getSharers(sharers);
     uint64_t deliveryTime = 0;
-    for (set<std::string>::iterator it = sharers->begin(); it != sharers->end(); it++) {
+    for (vector<NodeID>::iterator it = sharers.begin(); it != sharers.end(); it++) {
         MemEvent * inv = new MemEvent((Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Inv);
         inv->setDst(*it);
         inv->setRqstr(rqstr);
@@ -1239,7 +1240,7 @@ void MESIController::invalidateAllSharers(CacheLine * cacheLine, string rqstr, b
 
 #ifdef __SST_DEBUG_OUTPUT__
         if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_,"Sending inv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                cacheLine->getBaseAddr(), (*it).c_str(), deliveryTime);
+                cacheLine->getBaseAddr(), NodeIDMap::getName(*it).c_str(), deliveryTime);
 #endif
     }
     if (deliveryTime != 0) cacheLine->setTimestamp(deliveryTime);
@@ -1250,11 +1251,12 @@ void MESIController::invalidateAllSharers(CacheLine * cacheLine, string rqstr, b
  *  Send an Inv to all sharers unless the cache requesting exclusive permission is a sharer; then send Inv to all sharers except requestor. 
  *  Used for GetX/GetSEx requests.
  */
-bool MESIController::invalidateSharersExceptRequestor(CacheLine * cacheLine, string rqstr, string origRqstr, bool replay) {
+bool MESIController::invalidateSharersExceptRequestor(CacheLine * cacheLine, NodeID rqstr, NodeID origRqstr, bool replay) {
     bool sentInv = false;
-    set<std::string> * sharers = cacheLine->getSharers();
+    vector<NodeID> sharers;
+    cacheLine->getSharers(sharers);
     uint64_t deliveryTime = 0;
-    for (set<std::string>::iterator it = sharers->begin(); it != sharers->end(); it++) {
+    for (vector<NodeID>::iterator it = sharers.begin(); it != sharers.end(); it++) {
         if (*it == rqstr) continue;
 
         MemEvent * inv = new MemEvent((Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Inv);
@@ -1272,7 +1274,7 @@ bool MESIController::invalidateSharersExceptRequestor(CacheLine * cacheLine, str
         
 #ifdef __SST_DEBUG_OUTPUT__
         if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_,"Sending inv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                cacheLine->getBaseAddr(), (*it).c_str(), deliveryTime);
+                cacheLine->getBaseAddr(), NodeIDMap::getName(*it).c_str(), deliveryTime);
 #endif
     }
     if (deliveryTime != 0) cacheLine->setTimestamp(deliveryTime);
@@ -1283,7 +1285,7 @@ bool MESIController::invalidateSharersExceptRequestor(CacheLine * cacheLine, str
 /**
  *  Send FetchInv to owner of a block
  */
-void MESIController::sendFetchInv(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIController::sendFetchInv(CacheLine * cacheLine, NodeID rqstr, bool replay) {
     MemEvent * fetch = new MemEvent((Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), FetchInv);
     fetch->setDst(cacheLine->getOwner());
     fetch->setRqstr(rqstr);
@@ -1297,7 +1299,7 @@ void MESIController::sendFetchInv(CacheLine * cacheLine, string rqstr, bool repl
    
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_, "Sending FetchInv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-            cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+            cacheLine->getBaseAddr(), NodeIDMap::getName(cacheLine->getOwner()).c_str(), deliveryTime);
 #endif
 }
 
@@ -1305,7 +1307,7 @@ void MESIController::sendFetchInv(CacheLine * cacheLine, string rqstr, bool repl
 /** 
  *  Send FetchInv to owner of a block
  */
-void MESIController::sendFetchInvX(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIController::sendFetchInvX(CacheLine * cacheLine, NodeID rqstr, bool replay) {
     MemEvent * fetch = new MemEvent((Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), FetchInvX);
     fetch->setDst(cacheLine->getOwner());
     fetch->setRqstr(rqstr);
@@ -1319,7 +1321,7 @@ void MESIController::sendFetchInvX(CacheLine * cacheLine, string rqstr, bool rep
     
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_, "Sending FetchInvX: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-            cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+            cacheLine->getBaseAddr(), NodeIDMap::getName(cacheLine->getOwner()).c_str(), deliveryTime);
 #endif
 }
 
@@ -1330,8 +1332,8 @@ void MESIController::sendFetchInvX(CacheLine * cacheLine, string rqstr, bool rep
  */
 void MESIController::forwardMessageUp(MemEvent* event) {
     MemEvent * forwardEvent = new MemEvent(*event);
-    forwardEvent->setSrc(name_);
-    forwardEvent->setDst(upperLevelCacheNames_[0]);
+    forwardEvent->setSrc(nameID_);
+    forwardEvent->setDst(upperLevelCacheIDs_[0]);
     
     uint64_t deliveryTime = timestamp_ + tagLatency_;
     Response fwdReq = {forwardEvent, deliveryTime, false};
@@ -1393,7 +1395,7 @@ void MESIController::sendResponseDownFromMSHR(MemEvent * respEvent, MemEvent * r
  *  Handles: sending writebacks
  *  Latency: cache access + tag to read data that is being written back and update coherence state
  */
-void MESIController::sendWriteback(Command cmd, CacheLine* cacheLine, bool dirty, string rqstr) {
+void MESIController::sendWriteback(Command cmd, CacheLine* cacheLine, bool dirty, NodeID rqstr) {
     MemEvent* newCommandEvent = new MemEvent((SST::Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), cmd);
     newCommandEvent->setDst(getDestination(cacheLine->getBaseAddr()));
     newCommandEvent->setSize(cacheLine->getSize());
@@ -1424,8 +1426,8 @@ void MESIController::sendWriteback(Command cmd, CacheLine* cacheLine, bool dirty
  */
 void MESIController::sendWritebackAck(MemEvent * event) {
     MemEvent * ack = new MemEvent((SST::Component*)owner_, event->getBaseAddr(), event->getBaseAddr(), AckPut);
-    ack->setDst(event->getSrc());
-    ack->setRqstr(event->getSrc());
+    ack->setDst(event->getSrcID());
+    ack->setRqstr(event->getSrcID());
     ack->setSize(event->getSize());
 
     uint64_t deliveryTime = timestamp_ + tagLatency_;
@@ -1441,7 +1443,7 @@ void MESIController::sendWritebackAck(MemEvent * event) {
 /**
  *  Send an AckInv as a response to an Inv
  */
-void MESIController::sendAckInv(Addr baseAddr, string origRqstr) {
+void MESIController::sendAckInv(Addr baseAddr, NodeID origRqstr) {
     MemEvent * ack = new MemEvent((SST::Component*)owner_, baseAddr, baseAddr, AckInv);
     ack->setDst(getDestination(baseAddr));
     ack->setRqstr(origRqstr);
@@ -44,7 +44,7 @@ public:
 
 /* Event handlers */
     /** Send cacheline data to the lower level caches */
-    CacheAction handleEviction(CacheLine* wbCacheLine, string origRqstr, bool ignoredParam=false);
+    CacheAction handleEviction(CacheLine* wbCacheLine, NodeID origRqstr, bool ignoredParam=false);
 
     /** Process cache request:  GetX, GetS, GetSEx */
     CacheAction handleRequest(MemEvent* event, CacheLine* cacheLine, bool replay);
@@ -117,25 +117,25 @@ private:
     void sendResponseDownFromMSHR(MemEvent* response, MemEvent * request, bool dirty);
 
     /** Send writeback request to lower level caches */
-    void sendWriteback(Command cmd, CacheLine* cacheLine, bool dirty, string origRqstr);
+    void sendWriteback(Command cmd, CacheLine* cacheLine, bool dirty, NodeID origRqstr);
     
     /** Send AckPut to upper level cache */
     void sendWritebackAck(MemEvent * event);
 
     /** Send AckInv to lower level cache */
-    void sendAckInv(Addr baseAddr, string origRqstr);
+    void sendAckInv(Addr baseAddr, NodeID origRqstr);
 
     /** Fetch data from owner and invalidate their copy of the line */
-    void sendFetchInv(CacheLine * cacheLine, string rqstr, bool replay);
+    void sendFetchInv(CacheLine * cacheLine, NodeID rqstr, bool replay);
     
     /** Fetch data from owner and downgrade owner to sharer */
-    void sendFetchInvX(CacheLine * cacheLine, string rqstr, bool replay);
+    void sendFetchInvX(CacheLine * cacheLine, NodeID rqstr, bool replay);
 
     /** Invalidate all sharers of a block. Used for invalidations and evictions */
-    void invalidateAllSharers(CacheLine * cacheLine, string rqstr, bool replay);
+    void invalidateAllSharers(CacheLine * cacheLine, NodeID rqstr, bool replay);
     
     /** Invalidate all sharers of a block except the requestor (rqstr). Used for upgrade requests. */
-    bool invalidateSharersExceptRequestor(CacheLine * cacheLine, string rqstr, string origRqstr, bool replay);
+    bool invalidateSharersExceptRequestor(CacheLine * cacheLine, NodeID rqstr, NodeID origRqstr, bool replay);
 
 
 /* Helper methods */
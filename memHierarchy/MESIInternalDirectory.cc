@@ -31,7 +31,7 @@ using namespace SST::MemHierarchy;
  *  Directory evictions will also trigger a cache eviction if the block is locally cached
  *  Return whether the eviction is complete (DONE) or not (STALL)
  */
-CacheAction MESIInternalDirectory::handleEviction(CacheLine* replacementLine, string origRqstr, bool fromDataCache) {
+CacheAction MESIInternalDirectory::handleEviction(CacheLine* replacementLine, NodeID origRqstr, bool fromDataCache) {
     State state = replacementLine->getState();
     
     recordEvictionState(state);
@@ -46,7 +46,7 @@ CacheAction MESIInternalDirectory::handleEviction(CacheLine* replacementLine, st
     bool collision = (waitingEvent != NULL && (waitingEvent->getCmd() == PutS || waitingEvent->getCmd() == PutE || waitingEvent->getCmd() == PutM));
     if (collision) {    // Note that 'collision' and 'fromDataCache' cannot both be true, don't need to handle that case
         if (state == E && waitingEvent->getDirty()) replacementLine->setState(M);
-        if (replacementLine->isSharer(waitingEvent->getSrc())) replacementLine->removeSharer(waitingEvent->getSrc());
+        if (replacementLine->isSharer(waitingEvent->getSrcID())) replacementLine->removeSharer(waitingEvent->getSrcID());
         else if (replacementLine->ownerExists()) replacementLine->clearOwner();
         mshr_->setTempData(waitingEvent->getBaseAddr(), waitingEvent->getPayload());
         mshr_->removeFront(waitingEvent->getBaseAddr());
@@ -57,8 +57,8 @@ CacheAction MESIInternalDirectory::handleEviction(CacheLine* replacementLine, st
             return DONE;
         case S:
             if (replacementLine->numSharers() > 0 && !fromDataCache) {
-                if (isCached || collision) invalidateAllSharers(replacementLine, name_, false);
-                else invalidateAllSharersAndFetch(replacementLine, name_, false);    // Fetch needed for PutS
+                if (isCached || collision) invalidateAllSharers(replacementLine, nameID_, false);
+                else invalidateAllSharersAndFetch(replacementLine, nameID_, false);    // Fetch needed for PutS
                 replacementLine->setState(SI);
                 return STALL;
             }
@@ -71,12 +71,12 @@ CacheAction MESIInternalDirectory::handleEviction(CacheLine* replacementLine, st
             return DONE;
         case E:
             if (replacementLine->numSharers() > 0 && !fromDataCache) { // May or may not be cached
-                if (isCached || collision) invalidateAllSharers(replacementLine, name_, false);
-                else invalidateAllSharersAndFetch(replacementLine, name_, false);
+                if (isCached || collision) invalidateAllSharers(replacementLine, nameID_, false);
+                else invalidateAllSharersAndFetch(replacementLine, nameID_, false);
                 replacementLine->setState(EI);
                 return STALL;
             } else if (replacementLine->ownerExists() && !fromDataCache) { // Not cached
-                sendFetchInv(replacementLine, name_, false);
+                sendFetchInv(replacementLine, nameID_, false);
                 mshr_->incrementAcksNeeded(wbBaseAddr);
                 replacementLine->setState(EI);
                 return STALL;
@@ -92,12 +92,12 @@ CacheAction MESIInternalDirectory::handleEviction(CacheLine* replacementLine, st
             }
         case M:
             if (replacementLine->numSharers() > 0 && !fromDataCache) {
-                if (isCached || collision) invalidateAllSharers(replacementLine, name_, false);
-                else invalidateAllSharersAndFetch(replacementLine, name_, false);
+                if (isCached || collision) invalidateAllSharers(replacementLine, nameID_, false);
+                else invalidateAllSharersAndFetch(replacementLine, nameID_, false);
                 replacementLine->setState(MI);
                 return STALL;
             } else if (replacementLine->ownerExists() && !fromDataCache) {
-                sendFetchInv(replacementLine, name_, false);
+                sendFetchInv(replacementLine, nameID_, false);
                 mshr_->incrementAcksNeeded(wbBaseAddr);
                 replacementLine->setState(MI);
                 return STALL;
@@ -244,16 +244,16 @@ bool MESIInternalDirectory::isRetryNeeded(MemEvent * event, CacheLine * dirLine)
             return true;
         case FetchInvX:
             if (state == I) return false;
-            if (dirLine->getOwner() != event->getDst()) return false;
+            if (dirLine->getOwner() != event->getDstID()) return false;
             return true;
         case FetchInv:
             if (state == I) return false;
-            if ((dirLine->getOwner() != event->getDst()) && !dirLine->isSharer(event->getDst())) return false;
+            if ((dirLine->getOwner() != event->getDstID()) && !dirLine->isSharer(event->getDstID())) return false;
             return true;
         case Fetch:
         case Inv:
             if (state == I) return false;
-            if (!dirLine->isSharer(event->getDst())) return false;
+            if (!dirLine->isSharer(event->getDstID())) return false;
             return true;
         default:
             d_->fatal(CALL_INFO, -1, "%s (dir), Error: Received NACK for unrecognized event: %s. Addr = 0x%" PRIx64 ", Src = %s. Time = %" PRIu64 "ns\n",
@@ -276,7 +276,7 @@ int MESIInternalDirectory::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine
     if (cmd == GetSEx) cmd = GetX;  // for our purposes these are equal
 
     if (state == I) return 1;
-    if (event->isPrefetch() && event->getRqstr() == name_) return 0;
+    if (event->isPrefetch() && event->getRqstrID() == nameID_) return 0;
     
     switch (state) {
         case S:
@@ -287,7 +287,7 @@ int MESIInternalDirectory::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine
             if (cacheLine->ownerExists()) return 3;
             if (cmd == GetS) return 0; 
             if (cmd == GetX) {
-                if (cacheLine->isShareless() || (cacheLine->isSharer(event->getSrc()) && cacheLine->numSharers() == 1)) return 0; // Hit
+                if (cacheLine->isShareless() || (cacheLine->isSharer(event->getSrcID()) && cacheLine->numSharers() == 1)) return 0; // Hit
             }
             return 3;
         case IS:
@@ -318,7 +318,7 @@ int MESIInternalDirectory::isCoherenceMiss(MemEvent* event, CacheLine* cacheLine
 CacheAction MESIInternalDirectory::handleGetSRequest(MemEvent* event, CacheLine* dirLine, bool replay) {
     State state = dirLine->getState();
     
-    bool shouldRespond = !(event->isPrefetch() && (event->getRqstr() == name_));
+    bool shouldRespond = !(event->isPrefetch() && (event->getRqstrID() == nameID_));
     recordStateEventCount(event->getCmd(), state);    
     bool isCached = dirLine->getDataLine() != NULL;
     uint64_t sendTime = 0;
@@ -333,12 +333,12 @@ CacheAction MESIInternalDirectory::handleGetSRequest(MemEvent* event, CacheLine*
             notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
             if (!shouldRespond) return DONE;
             if (isCached) {
-                dirLine->addSharer(event->getSrc());
+                dirLine->addSharer(event->getSrcID());
                 sendTime = sendResponseUp(event, S, dirLine->getDataLine()->getData(), replay, dirLine->getTimestamp());
                 dirLine->setTimestamp(sendTime);
                 return DONE;
             } 
-            sendFetch(dirLine, event->getRqstr(), replay);
+            sendFetch(dirLine, event->getRqstrID(), replay);
             mshr_->incrementAcksNeeded(event->getBaseAddr());
             dirLine->setState(S_D);     // Fetch in progress, block incoming invalidates/fetches/etc.
             return STALL;
@@ -347,7 +347,7 @@ CacheAction MESIInternalDirectory::handleGetSRequest(MemEvent* event, CacheLine*
             notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
             if (!shouldRespond) return DONE;
             if (dirLine->ownerExists()) {
-                sendFetchInvX(dirLine, event->getRqstr(), replay);
+                sendFetchInvX(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 if (state == E) dirLine->setState(E_InvX);
                 else dirLine->setState(M_InvX);
@@ -355,16 +355,16 @@ CacheAction MESIInternalDirectory::handleGetSRequest(MemEvent* event, CacheLine*
             } else if (isCached) {
                 if (protocol_ && dirLine->numSharers() == 0) {
                     sendTime = sendResponseUp(event, E, dirLine->getDataLine()->getData(), replay, dirLine->getTimestamp());
-                    dirLine->setOwner(event->getSrc());
+                    dirLine->setOwner(event->getSrcID());
                     dirLine->setTimestamp(sendTime);
                 } else {
                     sendTime = sendResponseUp(event, S, dirLine->getDataLine()->getData(), replay, dirLine->getTimestamp());
-                    dirLine->addSharer(event->getSrc());
+                    dirLine->addSharer(event->getSrcID());
                     dirLine->setTimestamp(sendTime);
                 }
                 return DONE;
             } else {
-                sendFetch(dirLine, event->getRqstr(), replay);
+                sendFetch(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 if (state == E) dirLine->setState(E_D);
                 else dirLine->setState(M_D);
@@ -401,7 +401,7 @@ CacheAction MESIInternalDirectory::handleGetXRequest(MemEvent* event, CacheLine*
         case S:
             notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
             sendTime = forwardMessage(event, dirLine->getBaseAddr(), lineSize_, dirLine->getTimestamp(), &event->getPayload());
-            if (invalidateSharersExceptRequestor(dirLine, event->getSrc(), event->getRqstr(), replay, false)) {
+            if (invalidateSharersExceptRequestor(dirLine, event->getSrcID(), event->getRqstrID(), replay, false)) {
                 dirLine->setState(SM_Inv);
             } else {
                 dirLine->setState(SM);
@@ -413,18 +413,18 @@ CacheAction MESIInternalDirectory::handleGetXRequest(MemEvent* event, CacheLine*
         case M:
             notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
 
-            if (invalidateSharersExceptRequestor(dirLine, event->getSrc(), event->getRqstr(), replay, !isCached)) {
+            if (invalidateSharersExceptRequestor(dirLine, event->getSrcID(), event->getRqstrID(), replay, !isCached)) {
                 dirLine->setState(M_Inv);
                 return STALL;
             }
             if (dirLine->ownerExists()) {
-                sendFetchInv(dirLine, event->getRqstr(), replay);
+                sendFetchInv(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 dirLine->setState(M_Inv);
                 return STALL;
             }
-            dirLine->setOwner(event->getSrc());
-            if (dirLine->isSharer(event->getSrc())) dirLine->removeSharer(event->getSrc());
+            dirLine->setOwner(event->getSrcID());
+            if (dirLine->isSharer(event->getSrcID())) dirLine->removeSharer(event->getSrcID());
             if (isCached) sendTime = sendResponseUp(event, M, dirLine->getDataLine()->getData(), replay, dirLine->getTimestamp());  // is an upgrade request, requestor has data already
             else sendTime = sendResponseUp(event, M, NULL, replay, dirLine->getTimestamp());
             dirLine->setTimestamp(sendTime);
@@ -448,13 +448,13 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
     recordStateEventCount(event->getCmd(), state);
 
     if (state == S_D || state == E_D || state == SM_D || state == M_D) {
-        if (*(dirLine->getSharers()->begin()) == event->getSrc()) {    // Put raced with Fetch
+        if (dirLine->getFirstSharer() == event->getSrcID()) {    // Put raced with Fetch
             mshr_->decrementAcksNeeded(event->getBaseAddr());
         }
     } else if (mshr_->getAcksNeeded(event->getBaseAddr()) > 0) mshr_->decrementAcksNeeded(event->getBaseAddr());
 
-    if (dirLine->isSharer(event->getSrc())) {
-        dirLine->removeSharer(event->getSrc());
+    if (dirLine->isSharer(event->getSrcID())) {
+        dirLine->removeSharer(event->getSrcID());
     }
     // Set data, either to cache or to MSHR
     if (dirLine->getDataLine() != NULL) {
@@ -474,21 +474,21 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
             return action;
         case SI:
             if (action == DONE) {
-                sendWritebackFromMSHR(PutS, dirLine, reqEvent->getRqstr(), &event->getPayload());
+                sendWritebackFromMSHR(PutS, dirLine, reqEvent->getRqstrID(), &event->getPayload());
                 if (expectWritebackAck_) mshr_->insertWriteback(event->getBaseAddr());
                 dirLine->setState(I);
             }
             return action;
         case EI:
             if (action == DONE) {
-                sendWritebackFromMSHR(PutE, dirLine, reqEvent->getRqstr(), &event->getPayload());
+                sendWritebackFromMSHR(PutE, dirLine, reqEvent->getRqstrID(), &event->getPayload());
                 if (expectWritebackAck_) mshr_->insertWriteback(event->getBaseAddr());
                 dirLine->setState(I);
             }
             return action;
         case MI:
             if (action == DONE) {
-                sendWritebackFromMSHR(PutM, dirLine, reqEvent->getRqstr(), &event->getPayload());
+                sendWritebackFromMSHR(PutM, dirLine, reqEvent->getRqstrID(), &event->getPayload());
                 if (expectWritebackAck_) mshr_->insertWriteback(event->getBaseAddr());
                 dirLine->setState(I);
             }
@@ -496,7 +496,7 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
         case S_Inv: // PutS raced with Inv request
             if (action == DONE) {
                 if (reqEvent->getCmd() == Inv) {
-                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstr());
+                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstrID());
                 } else {
                     sendResponseDownFromMSHR(event, false);
                 }
@@ -508,14 +508,14 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
                 dirLine->setState(S);
                 if (reqEvent->getCmd() == Fetch) {
                     if (dirLine->getDataLine() == NULL && dirLine->numSharers() == 0) {
-                        sendWritebackFromMSHR(PutS, dirLine, reqEvent->getRqstr(), &event->getPayload());
+                        sendWritebackFromMSHR(PutS, dirLine, reqEvent->getRqstrID(), &event->getPayload());
                         dirLine->setState(I);
                     } else {
                         sendResponseDownFromMSHR(event, false);
                     }
                 } else if (reqEvent->getCmd() == GetS) {    // GetS
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                    dirLine->addSharer(reqEvent->getSrc());
+                    dirLine->addSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, S, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                     if (DEBUG_ALL || DEBUG_ADDR == event->getBaseAddr()) printData(&event->getPayload(), false);
@@ -538,7 +538,7 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
                 dirLine->setState(E);
                 if (reqEvent->getCmd() == Fetch) {
                     if (dirLine->getDataLine() == NULL && dirLine->numSharers() == 0) {
-                        sendWritebackFromMSHR(PutE, dirLine, reqEvent->getRqstr(), &event->getPayload());
+                        sendWritebackFromMSHR(PutE, dirLine, reqEvent->getRqstrID(), &event->getPayload());
                         dirLine->setState(I);
                     } else {
                         sendResponseDownFromMSHR(event, false);
@@ -546,11 +546,11 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
                 } else if (reqEvent->getCmd() == GetS) {
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
                     if (dirLine->numSharers() == 0) {
-                        dirLine->setOwner(reqEvent->getSrc());
+                        dirLine->setOwner(reqEvent->getSrcID());
                         sendTime = sendResponseUp(reqEvent, E, &event->getPayload(), true, dirLine->getTimestamp());
                         dirLine->setTimestamp(sendTime);
                     } else {
-                        dirLine->addSharer(reqEvent->getSrc());
+                        dirLine->addSharer(reqEvent->getSrcID());
                         sendTime = sendResponseUp(reqEvent, S, &event->getPayload(), true, dirLine->getTimestamp());
                         dirLine->setTimestamp(sendTime);
                     }
@@ -566,7 +566,7 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
                 dirLine->setState(S);
                 if (reqEvent->getCmd() == FetchInvX) {
                     if (dirLine->getDataLine() == NULL && dirLine->numSharers() == 0) {
-                        sendWritebackFromMSHR(PutE, dirLine, reqEvent->getRqstr(), &event->getPayload());
+                        sendWritebackFromMSHR(PutE, dirLine, reqEvent->getRqstrID(), &event->getPayload());
                         dirLine->setState(I);
                     } else {
                         sendResponseDownFromMSHR(event, false);
@@ -584,8 +584,8 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
                     dirLine->setState(I);
                 } else {
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    dirLine->setOwner(reqEvent->getSrc());
-                    if (dirLine->isSharer(reqEvent->getSrc())) dirLine->removeSharer(reqEvent->getSrc());
+                    dirLine->setOwner(reqEvent->getSrcID());
+                    if (dirLine->isSharer(reqEvent->getSrcID())) dirLine->removeSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, M, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                     if (DEBUG_ALL || DEBUG_ADDR == reqEvent->getBaseAddr()) printData(&event->getPayload(), false);
@@ -598,7 +598,7 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
                 dirLine->setState(M);
                 if (reqEvent->getCmd() == Fetch) {
                     if (dirLine->getDataLine() == NULL && dirLine->numSharers() == 0) {
-                        sendWritebackFromMSHR(PutM, dirLine, reqEvent->getRqstr(), &event->getPayload());
+                        sendWritebackFromMSHR(PutM, dirLine, reqEvent->getRqstrID(), &event->getPayload());
                         dirLine->setState(I);
                     } else {
                         sendResponseDownFromMSHR(event, false);
@@ -606,11 +606,11 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
                 } else if (reqEvent->getCmd() == GetS) {
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
                     if (dirLine->numSharers() == 0) {
-                        dirLine->setOwner(reqEvent->getSrc());
+                        dirLine->setOwner(reqEvent->getSrcID());
                         sendTime = sendResponseUp(reqEvent, E, &event->getPayload(), true, dirLine->getTimestamp());
                         dirLine->setTimestamp(sendTime);
                     } else {
-                        dirLine->addSharer(reqEvent->getSrc());
+                        dirLine->addSharer(reqEvent->getSrcID());
                         sendTime = sendResponseUp(reqEvent, S, &event->getPayload(), true, dirLine->getTimestamp());
                         dirLine->setTimestamp(sendTime);
                     }
@@ -625,14 +625,14 @@ CacheAction MESIInternalDirectory::handlePutSRequest(MemEvent * event, CacheLine
             if (action == DONE) {
                 if (reqEvent->getCmd() == Inv) {    // Completed Inv so handle
                     if (dirLine->numSharers() > 0) {
-                        invalidateAllSharers(dirLine, event->getRqstr(), true);
+                        invalidateAllSharers(dirLine, event->getRqstrID(), true);
                         return IGNORE;
                     }
-                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstr());
+                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstrID());
                     dirLine->setState(IM);
                 } else if (reqEvent->getCmd() == FetchInv) {
                     if (dirLine->numSharers() > 0) {
-                        invalidateAllSharers(dirLine, event->getRqstr(), true);
+                        invalidateAllSharers(dirLine, event->getRqstrID(), true);
                         return IGNORE;
                     }
                     sendResponseDownFromMSHR(event, false);
@@ -678,7 +678,7 @@ CacheAction MESIInternalDirectory::handlePutMRequest(MemEvent * event, CacheLine
             dirLine->clearOwner();
             sendWritebackAck(event);
             if (!isCached) {
-                sendWritebackFromMSHR(((dirLine->getState() == E) ? PutE : PutM), dirLine, event->getRqstr(), &event->getPayload());
+                sendWritebackFromMSHR(((dirLine->getState() == E) ? PutE : PutM), dirLine, event->getRqstrID(), &event->getPayload());
                 if (expectWritebackAck_) mshr_->insertWriteback(dirLine->getBaseAddr());
                 dirLine->setState(I);
             }
@@ -687,7 +687,7 @@ CacheAction MESIInternalDirectory::handlePutMRequest(MemEvent * event, CacheLine
             if (event->getDirty()) dirLine->setState(MI);
         case MI:
             dirLine->clearOwner();
-            sendWritebackFromMSHR(((dirLine->getState() == EI) ? PutE : PutM), dirLine, name_, &event->getPayload());
+            sendWritebackFromMSHR(((dirLine->getState() == EI) ? PutE : PutM), dirLine, nameID_, &event->getPayload());
             if (expectWritebackAck_) mshr_->insertWriteback(dirLine->getBaseAddr());
             dirLine->setState(I);
             break;
@@ -695,7 +695,7 @@ CacheAction MESIInternalDirectory::handlePutMRequest(MemEvent * event, CacheLine
             dirLine->clearOwner();
             if (reqEvent->getCmd() == FetchInvX) {
                 if (!isCached) {
-                    sendWritebackFromMSHR(event->getDirty() ? PutM : PutE, dirLine, event->getRqstr(), &event->getPayload());
+                    sendWritebackFromMSHR(event->getDirty() ? PutM : PutE, dirLine, event->getRqstrID(), &event->getPayload());
                     dirLine->setState(I);
                     if (expectWritebackAck_) mshr_->insertWriteback(event->getBaseAddr());
                 } else {
@@ -707,11 +707,11 @@ CacheAction MESIInternalDirectory::handlePutMRequest(MemEvent * event, CacheLine
                 if (protocol_) {
                     sendTime = sendResponseUp(reqEvent, E, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
-                    dirLine->setOwner(reqEvent->getSrc());
+                    dirLine->setOwner(reqEvent->getSrcID());
                 } else {
                     sendTime = sendResponseUp(reqEvent, S, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
-                    dirLine->addSharer(reqEvent->getSrc());
+                    dirLine->addSharer(reqEvent->getSrcID());
                 }
                 if (DEBUG_ALL || DEBUG_ADDR == event->getBaseAddr()) printData(&event->getPayload(), false);
                 if (event->getDirty()) dirLine->setState(M);
@@ -722,7 +722,7 @@ CacheAction MESIInternalDirectory::handlePutMRequest(MemEvent * event, CacheLine
             dirLine->clearOwner();
             if (reqEvent->getCmd() == FetchInvX) {
                 if (!isCached) {
-                    sendWritebackFromMSHR(PutM, dirLine, event->getRqstr(), &event->getPayload());
+                    sendWritebackFromMSHR(PutM, dirLine, event->getRqstrID(), &event->getPayload());
                     dirLine->setState(I);
                     if (expectWritebackAck_) mshr_->insertWriteback(event->getBaseAddr());
                 } else {
@@ -735,11 +735,11 @@ CacheAction MESIInternalDirectory::handlePutMRequest(MemEvent * event, CacheLine
                 if (protocol_) {
                     sendTime = sendResponseUp(reqEvent, E, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
-                    dirLine->setOwner(reqEvent->getSrc());
+                    dirLine->setOwner(reqEvent->getSrcID());
                 } else {
                     sendTime = sendResponseUp(reqEvent, S, &event->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
-                    dirLine->addSharer(reqEvent->getSrc());
+                    dirLine->addSharer(reqEvent->getSrcID());
                 }
                 if (DEBUG_ALL || DEBUG_ADDR == event->getBaseAddr()) printData(&event->getPayload(), false);
             }
@@ -753,7 +753,7 @@ CacheAction MESIInternalDirectory::handlePutMRequest(MemEvent * event, CacheLine
                 dirLine->setState(M);
                 sendTime = sendResponseUp(reqEvent, M, &event->getPayload(), true, dirLine->getTimestamp());
                 dirLine->setTimestamp(sendTime);
-                dirLine->setOwner(reqEvent->getSrc());
+                dirLine->setOwner(reqEvent->getSrcID());
                 if (DEBUG_ALL || DEBUG_ADDR == event->getBaseAddr()) printData(&event->getPayload(), false);
             } else { /* Cmd == Fetch */
                 sendResponseDownFromMSHR(event, (dirLine->getState() == M_Inv));
@@ -781,7 +781,7 @@ CacheAction MESIInternalDirectory::handleInv(MemEvent* event, CacheLine* dirLine
     switch(state) {
         case S:
             if (dirLine->numSharers() > 0) {
-                invalidateAllSharers(dirLine, event->getRqstr(), replay);
+                invalidateAllSharers(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(S_Inv);
                 while (collisionEvent != NULL) {
                     mshr_->removeFront(event->getBaseAddr());   // We've sent an inv to them so no need for AckPut
@@ -792,12 +792,12 @@ CacheAction MESIInternalDirectory::handleInv(MemEvent* event, CacheLine* dirLine
                 }
                 if (mshr_->getAcksNeeded(event->getBaseAddr()) > 0) return STALL;
             }
-            sendAckInv(event->getBaseAddr(), event->getRqstr());
+            sendAckInv(event->getBaseAddr(), event->getRqstrID());
             dirLine->setState(I);
             return DONE;
         case SM:
             if (dirLine->numSharers() > 0) {
-                invalidateAllSharers(dirLine, event->getRqstr(), replay);
+                invalidateAllSharers(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(SM_Inv);
                 while (collisionEvent != NULL) {
                     mshr_->removeFront(event->getBaseAddr());   // We've sent an inv to them so no need for AckPut
@@ -808,7 +808,7 @@ CacheAction MESIInternalDirectory::handleInv(MemEvent* event, CacheLine* dirLine
                 }
                 if (mshr_->getAcksNeeded(event->getBaseAddr())) return STALL;
             }
-            sendAckInv(event->getBaseAddr(), event->getRqstr());
+            sendAckInv(event->getBaseAddr(), event->getRqstrID());
             dirLine->setState(IM);
             return DONE;
         case SI:
@@ -848,7 +848,7 @@ CacheAction MESIInternalDirectory::handleFetch(MemEvent * event, CacheLine * dir
                 sendResponseDown(event, dirLine, &collisionEvent->getPayload(), false, replay);
                 return DONE;
             }
-            sendFetch(dirLine, event->getRqstr(), replay);
+            sendFetch(dirLine, event->getRqstrID(), replay);
             mshr_->incrementAcksNeeded(event->getBaseAddr());
             if (state == S) dirLine->setState(S_D);
             else dirLine->setState(SM_D);
@@ -877,7 +877,7 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
     bool isCached = dirLine->getDataLine() != NULL;
     bool collision = collisionEvent != NULL;
     if (collision) {   // Treat the replacement as if it had already occured/raced with an earlier FetchInv
-        if (dirLine->isSharer(collisionEvent->getSrc())) dirLine->removeSharer(collisionEvent->getSrc());
+        if (dirLine->isSharer(collisionEvent->getSrcID())) dirLine->removeSharer(collisionEvent->getSrcID());
         if (dirLine->ownerExists()) dirLine->clearOwner();
         mshr_->setTempData(collisionEvent->getBaseAddr(), collisionEvent->getPayload());
         if (state == E && collisionEvent->getDirty()) dirLine->setState(M);
@@ -893,8 +893,8 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
             return IGNORE;
         case S:
             if (dirLine->numSharers() > 0) {
-                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstr(), replay);
-                else invalidateAllSharersAndFetch(dirLine, event->getRqstr(), replay);
+                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstrID(), replay);
+                else invalidateAllSharersAndFetch(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(S_Inv);
                 return STALL;
             }
@@ -905,8 +905,8 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
             return DONE;
         case SM:
             if (dirLine->numSharers() > 0) {
-                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstr(), replay);
-                else invalidateAllSharersAndFetch(dirLine, event->getRqstr(), replay);
+                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstrID(), replay);
+                else invalidateAllSharersAndFetch(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(SM_Inv);
                 return STALL;
             }
@@ -917,14 +917,14 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
             return DONE;
         case E:
             if (dirLine->ownerExists()) {
-                sendFetchInv(dirLine, event->getRqstr(), replay);
+                sendFetchInv(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 dirLine->setState(E_Inv);
                 return STALL;
             }
             if (dirLine->numSharers() > 0) {
-                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstr(), replay);
-                else invalidateAllSharersAndFetch(dirLine, event->getRqstr(), replay);
+                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstrID(), replay);
+                else invalidateAllSharersAndFetch(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(E_Inv);
                 return STALL;
             }
@@ -935,14 +935,14 @@ CacheAction MESIInternalDirectory::handleFetchInv(MemEvent * event, CacheLine *
             return DONE;
         case M:
             if (dirLine->ownerExists()) {
-                sendFetchInv(dirLine, event->getRqstr(), replay);
+                sendFetchInv(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 dirLine->setState(M_Inv);
                 return STALL;
             }
             if (dirLine->numSharers() > 0) {
-                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstr(), replay);
-                else invalidateAllSharersAndFetch(dirLine, event->getRqstr(), replay);
+                if (isCached || collision) invalidateAllSharers(dirLine, event->getRqstrID(), replay);
+                else invalidateAllSharersAndFetch(dirLine, event->getRqstrID(), replay);
                 dirLine->setState(M_Inv);
                 return STALL;
             }
@@ -998,7 +998,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
             if (collision) {
                 if (dirLine->ownerExists()) {
                     dirLine->clearOwner();
-                    dirLine->addSharer(collisionEvent->getSrc());
+                    dirLine->addSharer(collisionEvent->getSrcID());
                     collisionEvent->setCmd(PutS);   // TODO there's probably a cleaner way to do this...and a safer/better way!
                 }
                 dirLine->setState(S);
@@ -1006,7 +1006,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
                 return DONE;
             }
             if (dirLine->ownerExists()) {
-                sendFetchInvX(dirLine, event->getRqstr(), replay);
+                sendFetchInvX(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 dirLine->setState(E_InvX);
                 return STALL;
@@ -1017,7 +1017,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
                 return DONE;
             }
             // Otherwise shared and not cached
-            sendFetch(dirLine, event->getRqstr(), replay);
+            sendFetch(dirLine, event->getRqstrID(), replay);
             mshr_->incrementAcksNeeded(event->getBaseAddr());
             dirLine->setState(E_InvX);
             return STALL;
@@ -1025,7 +1025,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
            if (collision) {
                 if (dirLine->ownerExists()) {
                     dirLine->clearOwner();
-                    dirLine->addSharer(collisionEvent->getSrc());
+                    dirLine->addSharer(collisionEvent->getSrcID());
                     collisionEvent->setCmd(PutS);   // TODO there's probably a cleaner way to do this...and a safer/better way!
                 }
                 dirLine->setState(S);
@@ -1033,7 +1033,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
                 return DONE;
             }
             if (dirLine->ownerExists()) {
-                sendFetchInvX(dirLine, event->getRqstr(), replay);
+                sendFetchInvX(dirLine, event->getRqstrID(), replay);
                 mshr_->incrementAcksNeeded(event->getBaseAddr());
                 dirLine->setState(M_InvX);
                 return STALL;
@@ -1044,7 +1044,7 @@ CacheAction MESIInternalDirectory::handleFetchInvX(MemEvent * event, CacheLine *
                 return DONE;
             }
             // Otherwise shared and not cached
-            sendFetch(dirLine, event->getRqstr(), replay);
+            sendFetch(dirLine, event->getRqstrID(), replay);
             mshr_->incrementAcksNeeded(event->getBaseAddr());
             dirLine->setState(M_InvX);
             return STALL;
@@ -1077,7 +1077,7 @@ CacheAction MESIInternalDirectory::handleDataResponse(MemEvent* responseEvent, C
     
     origRequest->setMemFlags(responseEvent->getMemFlags());
 
-    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstr() == name_));
+    bool shouldRespond = !(origRequest->isPrefetch() && (origRequest->getRqstrID() == nameID_));
     bool isCached = dirLine->getDataLine() != NULL;
     uint64_t sendTime = 0;
     switch (state) {
@@ -1087,8 +1087,8 @@ CacheAction MESIInternalDirectory::handleDataResponse(MemEvent* responseEvent, C
             notifyListenerOfAccess(origRequest, NotifyAccessType::READ, NotifyResultType::HIT);
             if (isCached) dirLine->getDataLine()->setData(responseEvent->getPayload(), responseEvent);
             if (!shouldRespond) return DONE;
-            if (dirLine->getState() == E) dirLine->setOwner(origRequest->getSrc());
-            else dirLine->addSharer(origRequest->getSrc());
+            if (dirLine->getState() == E) dirLine->setOwner(origRequest->getSrcID());
+            else dirLine->addSharer(origRequest->getSrcID());
             sendTime = sendResponseUp(origRequest, dirLine->getState(), &responseEvent->getPayload(), true, dirLine->getTimestamp());
             dirLine->setTimestamp(sendTime);
             if (DEBUG_ALL || DEBUG_ADDR == responseEvent->getBaseAddr()) printData(&responseEvent->getPayload(), false);
@@ -1097,8 +1097,8 @@ CacheAction MESIInternalDirectory::handleDataResponse(MemEvent* responseEvent, C
             if (isCached) dirLine->getDataLine()->setData(responseEvent->getPayload(), responseEvent);
         case SM:
             dirLine->setState(M);
-            dirLine->setOwner(origRequest->getSrc());
-            if (dirLine->isSharer(origRequest->getSrc())) dirLine->removeSharer(origRequest->getSrc());
+            dirLine->setOwner(origRequest->getSrcID());
+            if (dirLine->isSharer(origRequest->getSrcID())) dirLine->removeSharer(origRequest->getSrcID());
             notifyListenerOfAccess(origRequest, NotifyAccessType::WRITE, NotifyResultType::HIT);
             sendTime = sendResponseUp(origRequest, M, (isCached ? dirLine->getDataLine()->getData() : &responseEvent->getPayload()), true, dirLine->getTimestamp());
             dirLine->setTimestamp(sendTime);
@@ -1140,7 +1140,7 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
                 sendResponseDownFromMSHR(responseEvent, (state == M));
             } else if (reqEvent->getCmd() == GetS) {    // GetS
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                dirLine->addSharer(reqEvent->getSrc());
+                dirLine->addSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, S, &responseEvent->getPayload(), true, dirLine->getTimestamp());
                 dirLine->setTimestamp(sendTime);
                 if (DEBUG_ALL || DEBUG_ADDR == responseEvent->getBaseAddr()) printData(&responseEvent->getPayload(), false);
@@ -1150,10 +1150,10 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
             }
             break;
         case SI:
-            dirLine->removeSharer(responseEvent->getSrc());
+            dirLine->removeSharer(responseEvent->getSrcID());
             mshr_->setTempData(responseEvent->getBaseAddr(), responseEvent->getPayload());
             if (action == DONE) {
-                sendWritebackFromMSHR(PutS, dirLine, reqEvent->getRqstr(), &responseEvent->getPayload());
+                sendWritebackFromMSHR(PutS, dirLine, reqEvent->getRqstrID(), &responseEvent->getPayload());
                 if (expectWritebackAck_) mshr_->insertWriteback(dirLine->getBaseAddr());
                 dirLine->setState(I);
             }
@@ -1161,26 +1161,26 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
         case EI:
             if (responseEvent->getDirty()) dirLine->setState(MI);
         case MI:
-            if (dirLine->getOwner() == responseEvent->getSrc()) dirLine->clearOwner();
-            if (dirLine->isSharer(responseEvent->getSrc())) dirLine->removeSharer(responseEvent->getSrc());
+            if (dirLine->getOwner() == responseEvent->getSrcID()) dirLine->clearOwner();
+            if (dirLine->isSharer(responseEvent->getSrcID())) dirLine->removeSharer(responseEvent->getSrcID());
             if (action == DONE) {
-                sendWritebackFromMSHR(((dirLine->getState() == EI) ? PutE : PutM), dirLine, name_, &responseEvent->getPayload());
+                sendWritebackFromMSHR(((dirLine->getState() == EI) ? PutE : PutM), dirLine, nameID_, &responseEvent->getPayload());
                 if (expectWritebackAck_) mshr_->insertWriteback(dirLine->getBaseAddr());
                 dirLine->setState(I);
             }
             break;
         case E_InvX:    // FetchXResp for a GetS or FetchInvX
         case M_InvX:    // FetchXResp for FetchInvX or GetS
-            if (dirLine->getOwner() == responseEvent->getSrc()) {
+            if (dirLine->getOwner() == responseEvent->getSrcID()) {
                 dirLine->clearOwner();
-                dirLine->addSharer(responseEvent->getSrc());
+                dirLine->addSharer(responseEvent->getSrcID());
             }
             if (reqEvent->getCmd() == FetchInvX) {
                 sendResponseDownFromMSHR(responseEvent, (state == M_InvX || responseEvent->getDirty()));
                 dirLine->setState(S);
             } else {
                 notifyListenerOfAccess(reqEvent, NotifyAccessType::READ, NotifyResultType::HIT);
-                dirLine->addSharer(reqEvent->getSrc());
+                dirLine->addSharer(reqEvent->getSrcID());
                 sendTime = sendResponseUp(reqEvent, S, &responseEvent->getPayload(), true, dirLine->getTimestamp());
                 dirLine->setTimestamp(sendTime);
                 if (DEBUG_ALL || DEBUG_ADDR == responseEvent->getBaseAddr()) printData(&responseEvent->getPayload(), false);
@@ -1190,16 +1190,16 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
             break;
         case E_Inv: // FetchResp for FetchInv, may also be waiting for acks
         case M_Inv: // FetchResp for FetchInv or GetX, may also be waiting for acks
-            if (dirLine->isSharer(responseEvent->getSrc())) dirLine->removeSharer(responseEvent->getSrc());
-            if (dirLine->getOwner() == responseEvent->getSrc()) dirLine->clearOwner();
+            if (dirLine->isSharer(responseEvent->getSrcID())) dirLine->removeSharer(responseEvent->getSrcID());
+            if (dirLine->getOwner() == responseEvent->getSrcID()) dirLine->clearOwner();
             if (action != DONE) {
                 if (responseEvent->getDirty()) dirLine->setState(M_Inv);
                 mshr_->setTempData(responseEvent->getBaseAddr(), responseEvent->getPayload());
             } else {
                 if (reqEvent->getCmd() == GetX || reqEvent->getCmd() == GetSEx) {
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    if (dirLine->isSharer(reqEvent->getSrc())) dirLine->removeSharer(reqEvent->getSrc());
-                    dirLine->setOwner(reqEvent->getSrc());
+                    if (dirLine->isSharer(reqEvent->getSrcID())) dirLine->removeSharer(reqEvent->getSrcID());
+                    dirLine->setOwner(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, M, &responseEvent->getPayload(), true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                     dirLine->setState(M);
@@ -1211,7 +1211,7 @@ CacheAction MESIInternalDirectory::handleFetchResp(MemEvent * responseEvent, Cac
             break;
         case S_Inv:     // Received a FetchInv in S state
         case SM_Inv:    // Received a FetchInv in SM state
-            if (dirLine->isSharer(responseEvent->getSrc())) dirLine->removeSharer(responseEvent->getSrc());
+            if (dirLine->isSharer(responseEvent->getSrcID())) dirLine->removeSharer(responseEvent->getSrcID());
             if (action != DONE) {
                 mshr_->setTempData(responseEvent->getBaseAddr(), responseEvent->getPayload());
             } else {
@@ -1233,8 +1233,8 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
     State state = dirLine->getState();
     recordStateEventCount(ack->getCmd(), state);
 
-    if (dirLine->isSharer(ack->getSrc())) {
-        dirLine->removeSharer(ack->getSrc());
+    if (dirLine->isSharer(ack->getSrcID())) {
+        dirLine->removeSharer(ack->getSrcID());
     }
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == ack->getBaseAddr()) d_->debug(_L6_, "Received AckInv for 0x%" PRIx64 ", acks needed: %d\n", ack->getBaseAddr(), mshr_->getAcksNeeded(ack->getBaseAddr()));
@@ -1250,7 +1250,7 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
                 if (reqEvent->getCmd() == FetchInv) {
                     sendResponseDown(reqEvent, dirLine, data, false, true);
                 } else {
-                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstr());
+                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstrID());
                 }
                 dirLine->setState(I);
             }
@@ -1263,8 +1263,8 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
                     dirLine->setState(I);
                 } else {
                     notifyListenerOfAccess(reqEvent, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    dirLine->setOwner(reqEvent->getSrc());
-                    if (dirLine->isSharer(reqEvent->getSrc())) dirLine->removeSharer(reqEvent->getSrc());
+                    dirLine->setOwner(reqEvent->getSrcID());
+                    if (dirLine->isSharer(reqEvent->getSrcID())) dirLine->removeSharer(reqEvent->getSrcID());
                     sendTime = sendResponseUp(reqEvent, M, data, true, dirLine->getTimestamp());
                     dirLine->setTimestamp(sendTime);
                     if (DEBUG_ALL || DEBUG_ADDR == reqEvent->getBaseAddr()) printData(data, false);
@@ -1277,10 +1277,10 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
             if (action == DONE) {
                 if (reqEvent->getCmd() == Inv) {    // Completed Inv so handle
                     if (dirLine->numSharers() > 0) {
-                        invalidateAllSharers(dirLine, reqEvent->getRqstr(), true);
+                        invalidateAllSharers(dirLine, reqEvent->getRqstrID(), true);
                         return STALL;
                     }
-                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstr());
+                    sendAckInv(reqEvent->getBaseAddr(), reqEvent->getRqstrID());
                     dirLine->setState(IM);
                 } else if (reqEvent->getCmd() == FetchInv) {
                     sendResponseDown(reqEvent, dirLine, data, false, true);
@@ -1293,19 +1293,19 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
             return action;  
         case SI:
             if (action == DONE) {
-                sendWritebackFromMSHR(PutS, dirLine, reqEvent->getRqstr(), data);
+                sendWritebackFromMSHR(PutS, dirLine, reqEvent->getRqstrID(), data);
                 if (expectWritebackAck_) mshr_->insertWriteback(ack->getBaseAddr());
                 dirLine->setState(I);
             }
         case EI:
             if (action == DONE) {
-                sendWritebackFromMSHR(PutE, dirLine, reqEvent->getRqstr(), data);
+                sendWritebackFromMSHR(PutE, dirLine, reqEvent->getRqstrID(), data);
                 if (expectWritebackAck_) mshr_->insertWriteback(ack->getBaseAddr());
                 dirLine->setState(I);
             }
         case MI:
             if (action == DONE) {
-                sendWritebackFromMSHR(PutM, dirLine, reqEvent->getRqstr(), data);
+                sendWritebackFromMSHR(PutM, dirLine, reqEvent->getRqstrID(), data);
                 if (expectWritebackAck_) mshr_->insertWriteback(ack->getBaseAddr());
                 dirLine->setState(I);
             }
@@ -1324,13 +1324,14 @@ CacheAction MESIInternalDirectory::handleAckInv(MemEvent * ack, CacheLine * dirL
  *---------------------------------------------------------------------------------------------------------------------*/
 
 
-void MESIInternalDirectory::invalidateAllSharers(CacheLine * dirLine, string rqstr, bool replay) {
-    set<std::string> * sharers = dirLine->getSharers();
+void MESIInternalDirectory::invalidateAllSharers(CacheLine * dirLine, NodeID rqstr, bool replay) {
+    vector<NodeID> sharers;
+    dirLine->getSharers(sharers);
     
     uint64_t baseTime = (timestamp_ > dirLine->getTimestamp()) ? timestamp_ : dirLine->getTimestamp();
     uint64_t deliveryTime = (replay) ? baseTime + mshrLatency_ : baseTime + tagLatency_;
     bool invSent = false;
-    for (set<std::string>::iterator it = sharers->begin(); it != sharers->end(); it++) {
+    for (vector<NodeID>::iterator it = sharers.begin(); it != sharers.end(); it++) {
         MemEvent * inv = new MemEvent((Component*)owner_, dirLine->getBaseAddr(), dirLine->getBaseAddr(), Inv);
         inv->setDst(*it);
         inv->setRqstr(rqstr);
@@ -1342,22 +1343,23 @@ void MESIInternalDirectory::invalidateAllSharers(CacheLine * dirLine, string rqs
         invSent = true;
 #ifdef __SST_DEBUG_OUTPUT__
         if (DEBUG_ALL || DEBUG_ADDR == dirLine->getBaseAddr()) d_->debug(_L7_,"Sending inv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                dirLine->getBaseAddr(), (*it).c_str(), deliveryTime);
+                dirLine->getBaseAddr(), NodeIDMap::getName(*it).c_str(), deliveryTime);
 #endif
     }
     if (invSent) dirLine->setTimestamp(deliveryTime);
 }
 
 
-void MESIInternalDirectory::invalidateAllSharersAndFetch(CacheLine * cacheLine, string rqstr, bool replay) {
-    set<std::string> * sharers = cacheLine->getSharers();
+void MESIInternalDirectory::invalidateAllSharersAndFetch(CacheLine * cacheLine, NodeID rqstr, bool replay) {
+    vector<NodeID> sharers;
+    cacheLine->getSharers(sharers);
     bool fetched = false;
     
     uint64_t baseTime = (timestamp_ > cacheLine->getTimestamp()) ? timestamp_ : cacheLine->getTimestamp();
     uint64_t deliveryTime = (replay) ? timestamp_ + mshrLatency_ : timestamp_ + tagLatency_;
     bool invSent = false;
 
-    for (set<std::string>::iterator it = sharers->begin(); it != sharers->end(); it++) {
+    for (vector<NodeID>::iterator it = sharers.begin(); it != sharers.end(); it++) {
         MemEvent * inv;
         if (fetched) inv = new MemEvent((Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Inv);
         else {
@@ -1376,7 +1378,7 @@ void MESIInternalDirectory::invalidateAllSharersAndFetch(CacheLine * cacheLine,
 
 #ifdef __SST_DEBUG_OUTPUT__
         if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_,"Sending inv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                cacheLine->getBaseAddr(), (*it).c_str(), deliveryTime);
+                cacheLine->getBaseAddr(), NodeIDMap::getName(*it).c_str(), deliveryTime);
 #endif
     }
     
@@ -1388,15 +1390,16 @@ void MESIInternalDirectory::invalidateAllSharersAndFetch(CacheLine * cacheLine,
  * If checkFetch is true -> block is not cached
  * Then, if requestor is not already a sharer, we need data!
  */
-bool MESIInternalDirectory::invalidateSharersExceptRequestor(CacheLine * cacheLine, string rqstr, string origRqstr, bool replay, bool uncached) {
+bool MESIInternalDirectory::invalidateSharersExceptRequestor(CacheLine * cacheLine, NodeID rqstr, NodeID origRqstr, bool replay, bool uncached) {
     bool sentInv = false;
-    set<std::string> * sharers = cacheLine->getSharers();
-    bool needFetch = uncached && (sharers->find(rqstr) == sharers->end());
+    vector<NodeID> sharers;
+    cacheLine->getSharers(sharers);
+    bool needFetch = uncached && !cacheLine->isSharer(rqstr);
     
     uint64_t baseTime = (timestamp_ > cacheLine->getTimestamp()) ? timestamp_ : cacheLine->getTimestamp();
     uint64_t deliveryTime = (replay) ? baseTime + mshrLatency_ : baseTime + tagLatency_;
     
-    for (set<std::string>::iterator it = sharers->begin(); it != sharers->end(); it++) {
+    for (vector<NodeID>::iterator it = sharers.begin(); it != sharers.end(); it++) {
         if (*it == rqstr) continue;
         MemEvent * inv;
         if (needFetch) {
@@ -1418,7 +1421,7 @@ bool MESIInternalDirectory::invalidateSharersExceptRequestor(CacheLine * cacheLi
         
 #ifdef __SST_DEBUG_OUTPUT__
         if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_,"Sending inv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-                cacheLine->getBaseAddr(), (*it).c_str(), deliveryTime);
+                cacheLine->getBaseAddr(), NodeIDMap::getName(*it).c_str(), deliveryTime);
 #endif
     }
     if (sentInv) cacheLine->setTimestamp(deliveryTime);
@@ -1426,10 +1429,10 @@ bool MESIInternalDirectory::invalidateSharersExceptRequestor(CacheLine * cacheLi
 }
 
 
-void MESIInternalDirectory::sendFetchInv(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIInternalDirectory::sendFetchInv(CacheLine * cacheLine, NodeID rqstr, bool replay) {
     MemEvent * fetch = new MemEvent((Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), FetchInv);
-    if (!(cacheLine->getOwner()).empty()) fetch->setDst(cacheLine->getOwner());
-    else fetch->setDst(*(cacheLine->getSharers()->begin()));
+    if (cacheLine->ownerExists()) fetch->setDst(cacheLine->getOwner());
+    else fetch->setDst(cacheLine->getFirstSharer());
     fetch->setRqstr(rqstr);
     fetch->setSize(cacheLine->getSize());
     
@@ -1441,12 +1444,12 @@ void MESIInternalDirectory::sendFetchInv(CacheLine * cacheLine, string rqstr, bo
    
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_, "Sending FetchInv: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-            cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+            cacheLine->getBaseAddr(), NodeIDMap::getName(cacheLine->getOwner()).c_str(), deliveryTime);
 #endif
 }
 
 
-void MESIInternalDirectory::sendFetchInvX(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIInternalDirectory::sendFetchInvX(CacheLine * cacheLine, NodeID rqstr, bool replay) {
     MemEvent * fetch = new MemEvent((Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), FetchInvX);
     fetch->setDst(cacheLine->getOwner());
     fetch->setRqstr(rqstr);
@@ -1460,14 +1463,14 @@ void MESIInternalDirectory::sendFetchInvX(CacheLine * cacheLine, string rqstr, b
     
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_, "Sending FetchInvX: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-            cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+            cacheLine->getBaseAddr(), NodeIDMap::getName(cacheLine->getOwner()).c_str(), deliveryTime);
 #endif
 }
 
 
-void MESIInternalDirectory::sendFetch(CacheLine * cacheLine, string rqstr, bool replay) {
+void MESIInternalDirectory::sendFetch(CacheLine * cacheLine, NodeID rqstr, bool replay) {
     MemEvent * fetch = new MemEvent((Component*)owner_, cacheLine->getBaseAddr(), cacheLine->getBaseAddr(), Fetch);
-    fetch->setDst(*((cacheLine->getSharers())->begin()));
+    fetch->setDst(cacheLine->getFirstSharer());
     fetch->setRqstr(rqstr);
     
     uint64_t baseTime = (timestamp_ > cacheLine->getTimestamp()) ? timestamp_ : cacheLine->getTimestamp();
@@ -1478,7 +1481,7 @@ void MESIInternalDirectory::sendFetch(CacheLine * cacheLine, string rqstr, bool
     
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == cacheLine->getBaseAddr()) d_->debug(_L7_, "Sending Fetch: Addr = 0x%" PRIx64 ", Dst = %s @ cycles = %" PRIu64 ".\n", 
-            cacheLine->getBaseAddr(), cacheLine->getOwner().c_str(), deliveryTime);
+            cacheLine->getBaseAddr(), NodeIDMap::getName(cacheLine->getOwner()).c_str(), deliveryTime);
 #endif
 }
 
@@ -1527,7 +1530,7 @@ void MESIInternalDirectory::sendResponseDownFromMSHR(MemEvent * event, bool dirt
 #endif
 }
 
-void MESIInternalDirectory::sendAckInv(Addr baseAddr, string origRqstr) {
+void MESIInternalDirectory::sendAckInv(Addr baseAddr, NodeID origRqstr) {
     MemEvent * ack = new MemEvent((SST::Component*)owner_, baseAddr, baseAddr, AckInv);
     ack->setDst(getDestination(baseAddr));
     ack->setRqstr(origRqstr);
@@ -1543,8 +1546,8 @@ void MESIInternalDirectory::sendAckInv(Addr baseAddr, string origRqstr) {
 
 void MESIInternalDirectory::sendWritebackAck(MemEvent * event) {
     MemEvent * ack = new MemEvent((SST::Component*)owner_, event->getBaseAddr(), event->getBaseAddr(), AckPut);
-    ack->setDst(event->getSrc());
-    ack->setRqstr(event->getSrc());
+    ack->setDst(event->getSrcID());
+    ack->setRqstr(event->getSrcID());
     ack->setSize(event->getSize());
 
     uint64_t deliveryTime = timestamp_ + tagLatency_;
@@ -1555,7 +1558,7 @@ void MESIInternalDirectory::sendWritebackAck(MemEvent * event) {
 #endif
 }
 
-void MESIInternalDirectory::sendWritebackFromCache(Command cmd, CacheLine * dirLine, string rqstr) {
+void MESIInternalDirectory::sendWritebackFromCache(Command cmd, CacheLine * dirLine, NodeID rqstr) {
     MemEvent * writeback = new MemEvent((SST::Component*)owner_, dirLine->getBaseAddr(), dirLine->getBaseAddr(), cmd);
     writeback->setDst(getDestination(dirLine->getBaseAddr()));
     writeback->setSize(dirLine->getSize());
@@ -1575,7 +1578,7 @@ void MESIInternalDirectory::sendWritebackFromCache(Command cmd, CacheLine * dirL
 #endif
 }
 
-void MESIInternalDirectory::sendWritebackFromMSHR(Command cmd, CacheLine * dirLine, string rqstr, vector<uint8_t> * data) {
+void MESIInternalDirectory::sendWritebackFromMSHR(Command cmd, CacheLine * dirLine, NodeID rqstr, vector<uint8_t> * data) {
     MemEvent * writeback = new MemEvent((SST::Component*)owner_, dirLine->getBaseAddr(), dirLine->getBaseAddr(), cmd);
     writeback->setDst(getDestination(dirLine->getBaseAddr()));
     writeback->setSize(dirLine->getSize());
@@ -44,7 +44,7 @@ public:
 
 /* Event handlers */
     /** Send cache line data to the lower level caches */
-    CacheAction handleEviction(CacheLine* replacementLine, string origRqstr, bool fromDataCache);
+    CacheAction handleEviction(CacheLine* replacementLine, NodeID origRqstr, bool fromDataCache);
 
     /** Process cache request:  GetX, GetS, GetSEx */
     CacheAction handleRequest(MemEvent* event, CacheLine* dirLine, bool replay);
@@ -112,37 +112,37 @@ private:
     void sendResponseDownFromMSHR(MemEvent* event, bool dirty);
 
     /** Send writeback request to lower level caches */
-    void sendWriteback(Command cmd, CacheLine* dirLine, string origRqstr);
+    void sendWriteback(Command cmd, CacheLine* dirLine, NodeID origRqstr);
     
     /** Send writeback request to lower level cache using data from cache */
-    void sendWritebackFromCache(Command cmd, CacheLine* dirLine, string origRqstr);
+    void sendWritebackFromCache(Command cmd, CacheLine* dirLine, NodeID origRqstr);
 
     /** Send writeback request to lower level cache using data from MSHR */
-    void sendWritebackFromMSHR(Command cmd, CacheLine* dirLine, string origRqstr, std::vector<uint8_t>* data);
+    void sendWritebackFromMSHR(Command cmd, CacheLine* dirLine, NodeID origRqstr, std::vector<uint8_t>* data);
     
     /** Send writeback ack */
     void sendWritebackAck(MemEvent * event);
 
     /** Send AckInv to lower level cache */
-    void sendAckInv(Addr baseAddr, string origRqstr);
+    void sendAckInv(Addr baseAddr, NodeID origRqstr);
 
     /** Fetch data from owner and invalidate their copy of the line */
-    void sendFetchInv(CacheLine * dirLine, string rqstr, bool replay);
+    void sendFetchInv(CacheLine * dirLine, NodeID rqstr, bool replay);
     
     /** Fetch data from owner and downgrade owner to sharer */
-    void sendFetchInvX(CacheLine * dirLine, string rqstr, bool replay);
+    void sendFetchInvX(CacheLine * dirLine, NodeID rqstr, bool replay);
 
     /** Fetch data from sharer */
-    void sendFetch(CacheLine * dirLine, string rqstr, bool replay);
+    void sendFetch(CacheLine * dirLine, NodeID rqstr, bool replay);
 
     /** Invalidate all sharers of a block. Used for invalidations and evictions */
-    void invalidateAllSharers(CacheLine * dirLine, string rqstr, bool replay);
+    void invalidateAllSharers(CacheLine * dirLine, NodeID rqstr, bool replay);
     
     /** Invalidate all sharers of a block and fetch block from one of them. Used for invalidations and evictions */
-    void invalidateAllSharersAndFetch(CacheLine * dirLine, string rqstr, bool replay);
+    void invalidateAllSharersAndFetch(CacheLine * dirLine, NodeID rqstr, bool replay);
     
     /** Invalidate all sharers of a block except the requestor (rqstr). If requestor is not a sharer, may fetch data from a sharer. Used for upgrade requests. */
-    bool invalidateSharersExceptRequestor(CacheLine * dirLine, string rqstr, string origRqstr, bool replay, bool checkFetch);
+    bool invalidateSharersExceptRequestor(CacheLine * dirLine, NodeID rqstr, NodeID origRqstr, bool replay, bool checkFetch);
 
 
 /* Miscellaneous */
@@ -141,7 +141,7 @@ void Sieve::processEvent(SST::Event* ev) {
     // Currently, Ariel does not care about the payload.  Therefore,
     // there is no need to construct the payload.
     
-    responseEvent->setDst(event->getSrc());
+    responseEvent->setDst(event->getSrcID());
     SST::Link * link = event->getDeliveryLink();
     link->send(responseEvent);
     
@@ -18,6 +18,8 @@
 #include <sst_config.h>
 #include "cacheArray.h"
 #include <vector>
+#include <new>
+#include <algorithm>
 
 namespace SST { namespace MemHierarchy {
 
@@ -82,6 +84,82 @@ void SetAssociativeArray::deallocate(unsigned int index) {
     lines_[index]->reset();
 }
 
+/* Flat Set Associative Array Class */
+FlatSetAssociativeArray::FlatSetAssociativeArray(Output* dbg, unsigned int numLines, unsigned int lineSize, unsigned int associativity, ReplacementMgr* rm, HashFunction* hf, bool sharersAware) :
+    CacheArray(dbg, numLines, associativity, lineSize, rm, hf, sharersAware, true, false) 
+    {
+        dbg_->debug(_INFO_, "Array layout: flat\n");
+        tags_ = new Addr[numLines_];
+        lineBlock_ = static_cast<char*>(::operator new(numLines_ * sizeof(CacheLine)));
+        for (unsigned int i = 0; i < numLines_; i++) {
+            tags_[i] = 0;
+            lines_[i] = new (lineBlock_ + i * sizeof(CacheLine)) CacheLine(lineSize_, i, dbg_, true, this);
+        }
+        
+        setStates = new State[associativity];
+        setSharers = new unsigned int[associativity];
+        setOwned = new bool[associativity];
+    }
+
+
+FlatSetAssociativeArray::~FlatSetAssociativeArray() {
+    /* Lines live in lineBlock_, so destroy them here and keep ~CacheArray from deleting them */
+    for (unsigned int i = 0; i < lines_.size(); i++)
+        lines_[i]->~CacheLine();
+    lines_.clear();
+    ::operator delete(lineBlock_);
+    delete [] tags_;
+    delete [] setStates;
+    delete [] setSharers;
+    delete [] setOwned;
+}
+
+int FlatSetAssociativeArray::find(const Addr baseAddr, bool update) {
+    Addr lineAddr = toLineAddr(baseAddr);
+    int set = hash_->hash(0, lineAddr) & setMask_;
+    int setBegin = set * associativity_;
+    int setEnd = setBegin + associativity_;
+   
+    for (int i = setBegin; i < setEnd; i++) {
+        if (tags_[i] == baseAddr) {
+            if (update) replacementMgr_->update(i);
+            return i;
+        }
+    }
+    return -1;
+}
+
+CacheArray::CacheLine* FlatSetAssociativeArray::findReplacementCandidate(const Addr baseAddr, bool cache) {
+    int index = preReplace(baseAddr);
+    return lines_[index];
+}
+
+unsigned int FlatSetAssociativeArray::preReplace(const Addr baseAddr) {
+    Addr lineAddr   = toLineAddr(baseAddr);
+    int set         = hash_->hash(0, lineAddr) & setMask_;
+    int setBegin    = set * associativity_;
+    
+    for (unsigned int id = 0; id < associativity_; id++) {
+        setStates[id] = lines_[id+setBegin]->getState();
+        setSharers[id] = lines_[id+setBegin]->numSharers();
+        setOwned[id] = lines_[id+setBegin]->ownerExists();
+    }
+    return replacementMgr_->findBestCandidate(setBegin, setStates, setSharers, setOwned, sharersAware_? true: false);
+}
+
+void FlatSetAssociativeArray::replace(const Addr baseAddr, unsigned int candidate_id, bool ignoreParam1, unsigned int ignoreParam2) {
+    replacementMgr_->replaced(candidate_id);
+    lines_[candidate_id]->reset();
+    lines_[candidate_id]->setBaseAddr(baseAddr);
+    tags_[candidate_id] = baseAddr;
+    replacementMgr_->update(candidate_id);
+}
+
+void FlatSetAssociativeArray::deallocate(unsigned int index) {
+    replacementMgr_->replaced(index);
+    lines_[index]->reset();
+}
+
 /* Dual Set Associative Array Class */
 DualSetAssociativeArray::DualSetAssociativeArray(Output* dbg, unsigned int lineSize, HashFunction * hf, bool sharersAware, unsigned int dirNumLines, 
         unsigned int dirAssociativity, ReplacementMgr * dirRp, unsigned int cacheNumLines, unsigned int cacheAssociativity, ReplacementMgr * cacheRp) :
@@ -205,6 +283,34 @@ void DualSetAssociativeArray::deallocateCache(unsigned int index) {
 
 
 /* Cache Array Class */
+void CacheArray::setSharerNames(vector<std::string> names) {
+    std::sort(names.begin(), names.end());
+    for (unsigned int i = 0; i < names.size(); i++) {
+        if (!names[i].empty()) localId(NodeIDMap::getID(names[i]));
+    }
+}
+
+int CacheArray::addNode(NodeID node) {
+    int id = localToNode_.size();
+    if (node >= nodeToLocal_.size()) nodeToLocal_.resize(node + 1, -1);
+    nodeToLocal_[node] = id;
+    localToNode_.push_back(node);
+    
+    /* Grow the sharer slab by a word per line when we run out of bits */
+    if ((unsigned int)id >= sharerWordsPerLine_ * 64) {
+        unsigned int newWords = sharerWordsPerLine_ + 1;
+        vector<uint64_t> newSlab(numLines_ * newWords, 0);
+        for (unsigned int line = 0; line < numLines_; line++) {
+            for (unsigned int word = 0; word < sharerWordsPerLine_; word++) {
+                newSlab[line * newWords + word] = sharerSlab_[line * sharerWordsPerLine_ + word];
+            }
+        }
+        sharerSlab_.swap(newSlab);
+        sharerWordsPerLine_ = newWords;
+    }
+    return id;
+}
+
 void CacheArray::printConfiguration() {
     dbg_->debug(_INFO_, "Sets: %d \n", numSets_);
     dbg_->debug(_INFO_, "Lines: %d \n", numLines_);
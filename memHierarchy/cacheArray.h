@@ -19,6 +19,7 @@
 #define CACHEARRAY_H
 
 #include <vector>
+#include <string>
 #include <cstdlib>
 #include <bitset>
 #include "hash.h"
@@ -73,17 +74,19 @@ public:
     };
 
 
-    /* Cache line type - didn't bother splitting into different types (L1/lower-level/dir) because space overhead is small */
+    /* Cache line type - didn't bother splitting into different types (L1/lower-level/dir) because space overhead is small 
+     * Sharers and owner are tracked by NodeID. Sharer bits are indexed by the owning array's local ID for the node
+     * and live in the array's sharer slab so a line carries no per-line heap state for them */
     class CacheLine {
     protected:
         const uint32_t      size_;
         const int           index_;
         Output *            dbg_;
+        CacheArray *        array_;
         
         Addr                baseAddr_;
         State               state_;
-        set<std::string>    sharers_;
-        std::string         owner_;
+        NodeID              owner_;
         
         uint64_t            lastSendTimestamp_; // Use to force sequential timing for subsequent accesses to the line
 
@@ -98,8 +101,10 @@ public:
         /* Cache specific */
         vector<uint8_t> data_;
 
+        uint64_t * sharerWords() { return array_->sharerWords(index_); }
+
     public:
-        CacheLine (unsigned int size, int index, Output * dbg, bool cache) : size_(size), index_(index), dbg_(dbg), baseAddr_(0), state_(I) {
+        CacheLine (unsigned int size, int index, Output * dbg, bool cache, CacheArray * array) : size_(size), index_(index), dbg_(dbg), array_(array), baseAddr_(0), state_(I) {
             reset();
             if (cache) data_.resize(size_/sizeof(uint8_t));
         }
@@ -108,8 +113,8 @@ public:
 
         void reset() {
             state_ = I;
-            sharers_.clear();
-            owner_.clear();
+            clearSharers();
+            owner_ = NO_NODE;
             
             lastSendTimestamp_      = 0;
 
@@ -138,8 +143,8 @@ public:
             state_ = state; 
             if (state == I) {
                 clearAtomics();
-                sharers_.clear();
-                owner_.clear();
+                clearSharers();
+                owner_ = NO_NODE;
             }
         }
 
@@ -151,40 +156,83 @@ public:
         bool valid() { return state_ != I; }
 
         /** Getter for sharer field - return whether sharer field is empty */
-        bool isShareless() { return sharers_.empty(); }
-        /** Getter for sharer field */
-        set<std::string>* getSharers() { return &sharers_; }
+        bool isShareless() { 
+            uint64_t * words = sharerWords();
+            for (unsigned int i = 0; i < array_->sharerWordsPerLine_; i++) 
+                if (words[i] != 0) return false;
+            return true;
+        }
+        
+        /** Getter for sharer field - fill 'sharers' with the IDs of the current sharers */
+        void getSharers(vector<NodeID> &sharers) {
+            sharers.clear();
+            uint64_t * words = sharerWords();
+            for (unsigned int i = 0; i < array_->sharerWordsPerLine_; i++) {
+                uint64_t word = words[i];
+                while (word != 0) {
+                    int bit = __builtin_ctzll(word);
+                    sharers.push_back(array_->localToNode_[i * 64 + bit]);
+                    word &= word - 1;
+                }
+            }
+        }
+        
+        /** Getter for sharer field - return the ID of the first sharer in the set */
+        NodeID getFirstSharer() {
+            uint64_t * words = sharerWords();
+            for (unsigned int i = 0; i < array_->sharerWordsPerLine_; i++) {
+                if (words[i] != 0) return array_->localToNode_[i * 64 + __builtin_ctzll(words[i])];
+            }
+            return NO_NODE;
+        }
+
         /** Getter for sharer field - return number of sharers in set*/
-        unsigned int numSharers() { return sharers_.size(); }
+        unsigned int numSharers() { 
+            unsigned int count = 0;
+            uint64_t * words = sharerWords();
+            for (unsigned int i = 0; i < array_->sharerWordsPerLine_; i++) 
+                count += __builtin_popcountll(words[i]);
+            return count;
+        }
         
         /** Getter for sharer field - return whether a particular sharer exists in the set*/
-        bool isSharer(std::string name) { 
-            if (name.empty()) return false; 
-            return sharers_.find(name) != sharers_.end(); 
+        bool isSharer(NodeID node) { 
+            if (node == NO_NODE) return false; 
+            int bit = array_->findLocalId(node);
+            if (bit == -1) return false;
+            return (sharerWords()[bit / 64] >> (bit % 64)) & 1;
         }
         
         /** Setter for sharer field - remove a specific sharer */
-        void removeSharer(std::string name) {
-            if(name.empty()) return;
-            if (sharers_.find(name) == sharers_.end()) 
-                dbg_->fatal(CALL_INFO, -1, "Error: cannot remove sharer '%s', not a current sharer. Addr = 0x%" PRIx64 "\n", name.c_str(), baseAddr_);
-            sharers_.erase(name);        
+        void removeSharer(NodeID node) {
+            if (node == NO_NODE) return;
+            if (!isSharer(node))
+                dbg_->fatal(CALL_INFO, -1, "Error: cannot remove sharer '%s', not a current sharer. Addr = 0x%" PRIx64 "\n", NodeIDMap::getName(node).c_str(), baseAddr_);
+            int bit = array_->findLocalId(node);
+            sharerWords()[bit / 64] &= ~(1ULL << (bit % 64));
         }
     
         /** Setter for sharer field - add a specific sharer */
-        void addSharer(std::string name) {
-            if (name.empty()) return;
-            sharers_.insert(name);
+        void addSharer(NodeID node) {
+            if (node == NO_NODE) return;
+            int bit = array_->localId(node);   // May grow the sharer slab, so look up words afterwards
+            sharerWords()[bit / 64] |= (1ULL << (bit % 64));
+        }
+
+        /** Setter for sharer field - remove all sharers */
+        void clearSharers() {
+            uint64_t * words = sharerWords();
+            for (unsigned int i = 0; i < array_->sharerWordsPerLine_; i++) words[i] = 0;
         }
 
         /** Setter for owner field */
-        void setOwner(std::string owner) { owner_ = owner; }
+        void setOwner(NodeID owner) { owner_ = owner; }
         /** Getter for owner field */
-        std::string getOwner() { return owner_; }
+        NodeID getOwner() { return owner_; }
         /** Setter for owner field - clear field */
-        void clearOwner() { owner_.clear(); }
+        void clearOwner() { owner_ = NO_NODE; }
         /** Getter for owner field - return whether field is set */
-        bool ownerExists() { return !owner_.empty(); }
+        bool ownerExists() { return owner_ != NO_NODE; }
 
         /** Setter for timestamp field */
         void setTimestamp(uint64_t timestamp) { lastSendTimestamp_ = timestamp; }
@@ -276,10 +324,37 @@ public:
         slices_ = numSlices;
     }
 
+    /** Seed the local sharer IDs with the names of the components that can hold this array's lines (i.e., upper level caches). 
+     *  Names are assigned local IDs in sorted order so sharer iteration order matches name order. 
+     *  Nodes not seeded here are assigned local IDs on first use. */
+    void setSharerNames(vector<std::string> names);
+
 private:
     void printConfiguration();
     void errorChecking();
+    
+    /** Return the local (sharer bit) ID for a node, assigning one (and growing the sharer slab) if needed */
+    int localId(NodeID node) {
+        if (node < nodeToLocal_.size() && nodeToLocal_[node] != -1) return nodeToLocal_[node];
+        return addNode(node);
+    }
+    
+    /** Return the local ID for a node or -1 if the node has never been a sharer */
+    int findLocalId(NodeID node) {
+        return (node < nodeToLocal_.size()) ? nodeToLocal_[node] : -1;
+    }
+    
+    int addNode(NodeID node);
 
+    /* Local IDs - NodeIDs are process-wide, sharer bits are indexed by a dense per-array ID */
+    vector<int>                 nodeToLocal_;
+    vector<NodeID>              localToNode_;
+
+    /* Sharer slab - sharerWordsPerLine_ 64-bit words of sharer bits per line, indexed by line index */
+    vector<uint64_t>            sharerSlab_;
+    unsigned int                sharerWordsPerLine_;
+    
+    uint64_t * sharerWords(int index) { return &sharerSlab_[index * sharerWordsPerLine_]; }
 
 protected:
     Output*         dbg_;
@@ -294,8 +369,9 @@ protected:
     bool            sharersAware_;
     unsigned int    slices_;
 
+    /* If allocateLines is false, the derived array is responsible for filling lines_ */
     CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, unsigned int lineSize,
-               ReplacementMgr* replacementMgr, HashFunction* hash, bool sharersAware, bool cache) : dbg_(dbg), 
+               ReplacementMgr* replacementMgr, HashFunction* hash, bool sharersAware, bool cache, bool allocateLines = true) : dbg_(dbg), 
                numLines_(numLines), associativity_(associativity), lineSize_(lineSize),
                replacementMgr_(replacementMgr), hash_(hash) {
         dbg_->debug(_INFO_,"--------------------------- Initializing [Set Associative Cache Array]... \n");
@@ -304,9 +380,14 @@ protected:
         lineOffset_ = log2Of(lineSize_);
         lines_.resize(numLines_);
         slices_ = 1;
+        
+        sharerWordsPerLine_ = 1;
+        sharerSlab_.resize(numLines_, 0);
 
-        for (unsigned int i = 0; i < numLines_; i++) {
-            lines_[i] = new CacheLine(lineSize_, i, dbg_, cache);
+        if (allocateLines) {
+            for (unsigned int i = 0; i < numLines_; i++) {
+                lines_[i] = new CacheLine(lineSize_, i, dbg_, cache, this);
+            }
         }
 
         printConfiguration();
@@ -338,6 +419,35 @@ public:
     bool * setOwned;
 };
 
+/*
+ *  Flat set-associative cache array
+ *  Same policy as SetAssociativeArray but laid out for large arrays (LLCs, directories with millions of lines):
+ *  tags are kept in a contiguous per-set array so lookups do not touch the line objects, and all line
+ *  objects are carved out of a single allocation instead of one heap object per line.
+ *  Select with the cache parameter 'array_layout = flat'.
+ */
+class FlatSetAssociativeArray : public CacheArray {
+public:
+
+    FlatSetAssociativeArray(Output* dbg, unsigned int numLines, unsigned int lineSize, unsigned int associativity,
+                        ReplacementMgr* rp, HashFunction* hf, bool sharersAware);
+    
+    ~FlatSetAssociativeArray();
+
+    int find(Addr baseAddr, bool updateReplacement);
+    CacheLine * findReplacementCandidate(Addr baseAddr, bool cache);
+    void replace(Addr baseAddr, unsigned int candidate_id, bool cache, unsigned int newLinkID);
+    unsigned int preReplace(Addr baseAddr);
+    void deallocate(unsigned int index);
+
+private:
+    Addr *          tags_;          // numLines_ tags, set-major so a set's tags are contiguous
+    char *          lineBlock_;     // Backing storage for all CacheLine objects
+    State *         setStates;
+    unsigned int *  setSharers;
+    bool *          setOwned;
+};
+
 /*
  *  Dual set-associative cache array
  *  Implements an array for coherence state and an array for data
@@ -115,7 +115,7 @@ void Cache::processCacheRequest(MemEvent* event, Command cmd, Addr baseAddr, boo
     line = getLine(baseAddr);
 
     // Special case -> allocate line for prefetches to non-inclusive caches
-    bool localPrefetch = event->isPrefetch() && event->getRqstr() == getName();
+    bool localPrefetch = event->isPrefetch() && event->getRqstrID() == NodeIDMap::getID(this);
     if (cf_.type_ == "noninclusive_with_directory" && localPrefetch && line->getDataLine() == NULL && line->getState() == I) {
         if (!allocateDirCacheLine(event, baseAddr, line, false)) {
 #ifdef __SST_DEBUG_OUTPUT__
@@ -308,7 +308,7 @@ bool Cache::allocateLine(MemEvent * event, Addr baseAddr) {
             return false;
         }
         
-        CacheAction action = coherenceMgr->handleEviction(replacementLine, this->getName(), false);
+        CacheAction action = coherenceMgr->handleEviction(replacementLine, NodeIDMap::getID(this), false);
         if (action == STALL) {
             mshr_->insertPointer(replacementLine->getBaseAddr(), event->getBaseAddr());
             return false;
@@ -337,7 +337,7 @@ bool Cache::allocateCacheLine(MemEvent* event, Addr baseAddr) {
             return false;
         }
         
-        CacheAction action = coherenceMgr->handleEviction(replacementLine, this->getName(), false);
+        CacheAction action = coherenceMgr->handleEviction(replacementLine, NodeIDMap::getID(this), false);
         if (action == STALL) {
             mshr_->insertPointer(replacementLine->getBaseAddr(), event->getBaseAddr());
             return false;
@@ -369,7 +369,7 @@ bool Cache::allocateDirLine(MemEvent* event, Addr baseAddr) {
             return false;
         }
 
-        CacheAction action = coherenceMgr->handleEviction(replacementLine, this->getName(), false);
+        CacheAction action = coherenceMgr->handleEviction(replacementLine, NodeIDMap::getID(this), false);
         if (action == STALL) {
             mshr_->insertPointer(replacementLine->getBaseAddr(), baseAddr);
             return false;
@@ -401,7 +401,7 @@ bool Cache::allocateDirCacheLine(MemEvent * event, Addr baseAddr, CacheLine * di
             mshr_->insertPointer(replacementDirLine->getBaseAddr(), baseAddr);
             return false;
         }
-        coherenceMgr->handleEviction(replacementDirLine, this->getName(), true);
+        coherenceMgr->handleEviction(replacementDirLine, NodeIDMap::getID(this), true);
     }
 
     cf_.cacheArray_->replace(baseAddr, replacementDataLine->getIndex(), false, dirLine->getIndex());
@@ -636,7 +636,7 @@ bool Cache::isCacheMiss(int lineIndex) {
 /* ---------------------------------------
    Extras
    --------------------------------------- */
-MemEvent* Cache::getOrigReq(const vector<mshrType> entries) {
+MemEvent* Cache::getOrigReq(const vector<mshrType>& entries) {
     if (entries.front().elem.type() != typeid(MemEvent*)) {
         d_->fatal(CALL_INFO, -1, "%s, Error: Request at front of the mshr is not of type MemEvent. Time = %" PRIu64 "\n",
                 this->getName().c_str(), getCurrentSimTimeNano());
@@ -767,7 +767,7 @@ void Cache::printLine(Addr addr) {
         State state = (line == NULL) ? NP : line->getState();
         bool isCached = (line == NULL) ? false : (line->getDataLine() != NULL);
         unsigned int sharers = (line == NULL) ? 0 : line->numSharers();
-        string owner = (line == NULL) ? "" : line->getOwner();
+        const string& owner = NodeIDMap::getName((line == NULL) ? NO_NODE : line->getOwner());
         d_->debug(_L8_, "0x%" PRIx64 ": %s, %u, \"%s\" %d\n", 
                 addr, StateString[state], sharers, owner.c_str(), isCached); 
     } else if (cf_.L1_) {
@@ -778,7 +778,7 @@ void Cache::printLine(Addr addr) {
         CacheLine * line = getLine(addr);
         State state = (line == NULL) ? NP : line->getState();
         unsigned int sharers = (line == NULL) ? 0 : line->numSharers();
-        string owner = (line == NULL) ? "" : line->getOwner();
+        const string& owner = NodeIDMap::getName((line == NULL) ? NO_NODE : line->getOwner());
         d_->debug(_L8_, "0x%" PRIx64 ": %s, %u, \"%s\"\n", addr, StateString[state], sharers, owner.c_str());
     }
 }
@@ -175,7 +175,7 @@ private:
     void recordLatency(MemEvent * event);
 
     /** Get the front element of a MSHR entry */
-    MemEvent* getOrigReq(const vector<mshrType> entries);
+    MemEvent* getOrigReq(const vector<mshrType>& entries);
    
     /** Print cache line for debugging */
     void printLine(Addr addr);
@@ -193,6 +193,7 @@ private:
     /**  Clock Handler.  Every cycle events are executed (if any).  If clock is idle long enough, 
          the clock gets deregistered from TimeVortx and reregistered only when an event is received */
     bool clockTick(Cycle_t time) {
+        MemEventPool::StatScope poolScope(eventPoolHits_, eventPoolMisses_);
         timestamp_++;
         bool queuesEmpty = coherenceMgr->sendOutgoingCommands(getCurrentSimTimeNano());
         
@@ -357,6 +358,10 @@ private:
     Statistic<uint64_t>* statInvStalledByLockedLine;
 
     Statistic<uint64_t>* statMSHROccupancy;
+    Statistic<uint64_t>* statEventPoolHits;
+    Statistic<uint64_t>* statEventPoolMisses;
+    uint64_t             eventPoolHits_;        // MemEventPool hits/misses while handling this cache's events
+    uint64_t             eventPoolMisses_;
 #ifdef USE_VAULTSIM_HMC
     Statistic<uint64_t>* statCacheHits_hmc;
     Statistic<uint64_t>* statCacheHits_nonhmc;
@@ -244,7 +244,7 @@ void Cache::processEvent(MemEvent* event, bool replay) {
     MemEvent* origEvent;
 
     /* Set requestor field if this is the first cache that's seen this event */
-    if (event->getRqstr() == "None") { event->setRqstr(this->getName()); }
+    if (event->getRqstrID() == NONE_NODE) { event->setRqstr(NodeIDMap::getID(this)); }
 
 
     if (!replay) {
@@ -398,6 +398,7 @@ void Cache::handlePrefetchEvent(SST::Event* ev) {
 
 /* Handler for self events, namely prefetches */
 void Cache::processPrefetchEvent(SST::Event* ev) {
+    MemEventPool::StatScope poolScope(eventPoolHits_, eventPoolMisses_);
     MemEvent* event = static_cast<MemEvent*>(ev);
     event->setBaseAddr(toBaseAddr(event->getAddr()));
 
@@ -494,12 +495,15 @@ void Cache::init(unsigned int phase) {
 void Cache::setup() {
     if (lowerLevelCacheNames_.size() == 0) lowerLevelCacheNames_.push_back(""); // avoid segfault on accessing this
     if (upperLevelCacheNames_.size() == 0) upperLevelCacheNames_.push_back(""); // avoid segfault on accessing this
+    cf_.cacheArray_->setSharerNames(upperLevelCacheNames_);
     coherenceMgr->setLowerLevelCache(&lowerLevelCacheNames_);
     coherenceMgr->setUpperLevelCache(&upperLevelCacheNames_);
 }
 
 
 void Cache::finish() {
+    statEventPoolHits->addData(eventPoolHits_);
+    statEventPoolMisses->addData(eventPoolMisses_);
     listener_->printStats(*d_);
     delete cf_.cacheArray_;
     delete d_;
@@ -509,6 +513,7 @@ void Cache::finish() {
 
 /* Main handler for links to upper and lower caches/cores/buses/etc */
 void Cache::processIncomingEvent(SST::Event* ev) {
+    MemEventPool::StatScope poolScope(eventPoolHits_, eventPoolMisses_);
     MemEvent* event = static_cast<MemEvent*>(ev);
     if (!clockIsOn_) {
         Cycle_t time = reregisterClock(defaultTimeBase_, clockHandler_);
@@ -91,12 +91,14 @@ Cache* Cache::cacheFactory(ComponentId_t id, Params &params) {
     int dirNumEntries           = params.find<int>("noninclusive_directory_entries", 0);
     bool L2                     = params.find<bool>("L2", false);
     bool L3                     = params.find<bool>("L3", false);
+    string arrayLayout          = params.find<std::string>("array_layout", "object");
 
     /* Convert all strings to lower case */
     boost::algorithm::to_lower(coherenceProtocol);
     boost::algorithm::to_lower(replacement);
     boost::algorithm::to_lower(dirReplacement);
     boost::algorithm::to_lower(cacheType);
+    boost::algorithm::to_lower(arrayLayout);
 
     /* Check user specified all required fields */
     if (frequency.empty())           dbg->fatal(CALL_INFO, -1, "Param not specified: frequency - cache frequency.\n");
@@ -114,6 +116,11 @@ Cache* Cache::cacheFactory(ComponentId_t id, Params &params) {
         if (dirNumEntries <= 0)     dbg->fatal(CALL_INFO, -1, "Invalid param: noninlusive_directory_entries - must be at least 1 if cache_type is noninclusive_with_directory. You specified %d\n", dirNumEntries);
     }
     
+    if (arrayLayout != "object" && arrayLayout != "flat")
+        dbg->fatal(CALL_INFO, -1, "Invalid param: array_layout - valid options are 'object' or 'flat'. You specified '%s'.\n", arrayLayout.c_str());
+    if (arrayLayout == "flat" && cacheType == "noninclusive_with_directory")
+        dbg->fatal(CALL_INFO, -1, "Invalid param combo: array_layout and cache_type - 'flat' layout is not supported for 'noninclusive_with_directory' caches.\n");
+
     if (L1) {
         if (cacheType != "inclusive")
             dbg->fatal(CALL_INFO, -1, "Invalid param: cache_type - must be 'inclusive' for an L1. You specified '%s'.\n", cacheType.c_str());
@@ -165,7 +172,8 @@ Cache* Cache::cacheFactory(ComponentId_t id, Params &params) {
         else if (boost::iequals(replacement, "mru"))    replManager = new MRUReplacementMgr(dbg, numLines, associativity, true);
         else if (boost::iequals(replacement, "nmru"))   replManager = new NMRUReplacementMgr(dbg, numLines, associativity);
         else dbg->fatal(CALL_INFO, -1, "Invalid param: replacement_policy - supported policies are 'lru', 'lfu', 'random', 'mru', and 'nmru'. You specified %s.\n", replacement.c_str());
-        cacheArray = new SetAssociativeArray(dbg, numLines, lineSize, associativity, replManager, ht, !L1);
+        if (arrayLayout == "flat")  cacheArray = new FlatSetAssociativeArray(dbg, numLines, lineSize, associativity, replManager, ht, !L1);
+        else                        cacheArray = new SetAssociativeArray(dbg, numLines, lineSize, associativity, replManager, ht, !L1);
     } else if (cacheType == "noninclusive_with_directory") {
         if (boost::iequals(replacement, "lru")) replManager = new LRUReplacementMgr(dbg, numLines, associativity, true);
         else if (boost::iequals(replacement, "lfu"))    replManager = new LFUReplacementMgr(dbg, numLines, associativity);
@@ -319,6 +327,10 @@ Cache::Cache(ComponentId_t id, Params &params, CacheConfig config) : Component(i
     statInv_recv                = registerStatistic<uint64_t>("Inv_recv");
     statNACK_recv               = registerStatistic<uint64_t>("NACK_recv");
     statMSHROccupancy           = registerStatistic<uint64_t>("MSHR_occupancy");
+    statEventPoolHits           = registerStatistic<uint64_t>("MemEventPool_hits");
+    statEventPoolMisses         = registerStatistic<uint64_t>("MemEventPool_misses");
+    eventPoolHits_              = 0;
+    eventPoolMisses_            = 0;
 #ifdef USE_VAULTSIM_HMC
     statCacheHits_hmc           = registerStatistic<uint64_t>("hmcCacheHits");
     statCacheHits_nonhmc        = registerStatistic<uint64_t>("nonhmcCacheHits");
@@ -70,6 +70,7 @@ public:
     uint64_t    tagLatency_;        // Cache tag access latency
     uint64_t    mshrLatency_;       // MSHR lookup latency
     string      name_;              // Name of cache we are associated with
+    NodeID      nameID_;            // NodeID of name_
     MSHR *      mshr_;              // Pointer to cache's MSHR, coherence controllers are responsible for managing writeback acks
 
     list<Response> outgoingEventQueue_;
@@ -84,7 +85,7 @@ public:
     virtual CacheAction handleRequest(MemEvent * event, CacheLine * line, bool replay) =0;
     virtual CacheAction handleReplacement(MemEvent * event, CacheLine * line, MemEvent * reqEvent, bool replay) =0;
     virtual CacheAction handleInvalidationRequest(MemEvent * event, CacheLine * line, bool replay) =0;
-    virtual CacheAction handleEviction(CacheLine * line, string rqstr, bool fromDataCache=false) =0;
+    virtual CacheAction handleEviction(CacheLine * line, NodeID rqstr, bool fromDataCache=false) =0;
     virtual CacheAction handleResponse(MemEvent * event, CacheLine * line, MemEvent * request) =0;
     
     virtual bool isRetryNeeded(MemEvent * event, CacheLine * line) =0;
@@ -112,7 +113,7 @@ public:
     // Non-L1s can inherit this version, L1s should implement a different version to split out the requested block
     virtual uint64_t sendResponseUp(MemEvent * event, State grantedState, vector<uint8_t>* data, bool replay, uint64_t baseTime, bool atomic=false) {
         MemEvent * responseEvent = event->makeResponse(grantedState);
-        responseEvent->setDst(event->getSrc());
+        responseEvent->setDst(event->getSrcID());
         responseEvent->setSize(event->getSize());
         if (data != NULL) responseEvent->setPayload(*data);
     
@@ -152,7 +153,7 @@ public:
         /* Create event to be forwarded */
         MemEvent* forwardEvent;
         forwardEvent = new MemEvent(*event);
-        forwardEvent->setSrc(name_);
+        forwardEvent->setSrc(nameID_);
         forwardEvent->setDst(getDestination(baseAddr));
         forwardEvent->setSize(requestSize);
     
@@ -176,13 +177,18 @@ public:
     
 
     // Set upper and lower level cache names for addressing
+    // Names are resolved to NodeIDs here, once, so that events can be addressed without a name lookup
     void setLowerLevelCache(vector<string>* nlc) {
         lowerLevelCacheNames_ = *(nlc);   
+        lowerLevelCacheIDs_.clear();
+        for (vector<string>::iterator it = nlc->begin(); it != nlc->end(); it++) lowerLevelCacheIDs_.push_back(NodeIDMap::getID(*it));
     }
     
     
     void setUpperLevelCache(vector<string>* nlc) {
         upperLevelCacheNames_ = *(nlc);    
+        upperLevelCacheIDs_.clear();
+        for (vector<string>::iterator it = nlc->begin(); it != nlc->end(); it++) upperLevelCacheIDs_.push_back(NodeIDMap::getID(*it));
     }
     
 
@@ -291,6 +297,7 @@ protected:
             bool debugAll, Addr debugAddr):
                         timestamp_(0), accessLatency_(1), tagLatency_(1), owner_(cache), d_(dbg), lineSize_(lineSize), sentEvents_(0) {
         name_                   = name;
+        nameID_                 = NodeIDMap::getID(name);
         accessLatency_          = accessLatency;
         tagLatency_             = tagLatency;
         mshrLatency_            = mshrLatency;
@@ -494,6 +501,8 @@ protected:
     Link*           highNetPort_;
     vector<string>  lowerLevelCacheNames_;
     vector<string>  upperLevelCacheNames_;
+    vector<NodeID>  lowerLevelCacheIDs_;
+    vector<NodeID>  upperLevelCacheIDs_;
 
 
     // Statistics //
@@ -677,15 +686,15 @@ protected:
     // General protected methods
 
     // For distributed caches, return which cache is home for a particular address
-    string getDestination(Addr baseAddr) {
-        if (lowerLevelCacheNames_.size() == 1) {
-            return lowerLevelCacheNames_.front();
-        } else if (lowerLevelCacheNames_.size() > 1) {
+    NodeID getDestination(Addr baseAddr) {
+        if (lowerLevelCacheIDs_.size() == 1) {
+            return lowerLevelCacheIDs_.front();
+        } else if (lowerLevelCacheIDs_.size() > 1) {
             // round robin for now
-            int index = (baseAddr/lineSize_) % lowerLevelCacheNames_.size();
-            return lowerLevelCacheNames_[index];
+            int index = (baseAddr/lineSize_) % lowerLevelCacheIDs_.size();
+            return lowerLevelCacheIDs_[index];
         } else {
-            return "";
+            return NO_NODE;
         }
     }
 
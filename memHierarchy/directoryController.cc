@@ -75,6 +75,9 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     
     entryCacheMaxSize = params.find<size_t>("entry_cache_size", 32768);
     entryCacheSize = 0;
+    entrySpill = params.find<bool>("entry_cache_spill", false);
+    if (entrySpill && entryCacheMaxSize == 0) dbg.fatal(CALL_INFO, -1, "Invalid param(%s): entry_cache_spill - requires entry_cache_size > 0\n", getName().c_str());
+    spillRecordWords = 0;
     std::string net_bw = params.find<std::string>("network_bw", "80GiB/s");
 
     addrRangeStart  = params.find<uint64_t>("addr_range_start", 0);
@@ -170,6 +173,7 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
         
         memLink = NULL;
     }
+    memoryID = NodeIDMap::getID(memoryName);
     
     clockHandler = new Clock::Handler<DirectoryController>(this, &DirectoryController::clock);
     defaultTimeBase = registerClock(params.find<std::string>("clock", "1GHz"), clockHandler);
@@ -215,10 +219,14 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
 
 
 DirectoryController::~DirectoryController(){
-    for(std::map<Addr, DirEntry*>::iterator i = directory.begin(); i != directory.end() ; ++i){
+    for(std::unordered_map<Addr, DirEntry*>::iterator i = directory.begin(); i != directory.end() ; ++i){
         delete i->second;
     }
     directory.clear();
+    for(std::vector<DirEntry*>::iterator i = entryPool.begin(); i != entryPool.end(); ++i){
+        delete *i;
+    }
+    entryPool.clear();
     
     while(workQueue.size()){
         MemEvent *front = workQueue.front();
@@ -266,7 +274,7 @@ void DirectoryController::handlePacket(SST::Event *event){
         if (memLink) {
             memLink->send(ev);
         } else {
-            ev->setDst(memoryName);
+            ev->setDst(memoryID);
             network->send(ev);
         }
     } else {
@@ -408,11 +416,11 @@ bool DirectoryController::clock(SST::Cycle_t cycle){
 #ifdef __SST_DEBUG_OUTPUT__
         if (DEBUG_ALL || DEBUG_ADDR == ev->getBaseAddr()) {
             Addr baseAddr = ev->getBaseAddr();
-            if (ev->getDst() == memoryName) {
+            if (ev->getDstID() == memoryID) {
                 if (memReqs.find(ev->getID()) != memReqs.end()) baseAddr = memReqs[ev->getID()];
             }
             dbg.debug(_L3_, "SEND: %s %sCmd = %s, BaseAddr = 0x%" PRIx64 ",  Dst = %s, Size = %u, Time = %" PRIu64 "\n", 
-                    getName().c_str(), (ev->getDst() == memoryName ? "MemReq " : ""), CommandString[ev->getCmd()], ev->getBaseAddr(), ev->getDst().c_str(), ev->getSize(), getCurrentSimTimeNano());
+                    getName().c_str(), (ev->getDstID() == memoryID ? "MemReq " : ""), CommandString[ev->getCmd()], ev->getBaseAddr(), ev->getDst().c_str(), ev->getSize(), getCurrentSimTimeNano());
         }
 #endif
         network->send(ev);
@@ -650,7 +658,7 @@ void DirectoryController::issueInvalidates(MemEvent * ev, DirEntry * entry) {
 /* Send Fetch to owner */
 void DirectoryController::issueFetch(MemEvent * ev, DirEntry * entry, Command cmd) {
     MemEvent * fetch = new MemEvent(this, ev->getAddr(), ev->getBaseAddr(), cmd, cacheLineSize);
-    fetch->setDst(nodeid_to_name[entry->getOwner()]);
+    fetch->setDst(nodeid_to_endpoint[entry->getOwner()]);
     entry->lastRequest = fetch->getID();
     profileRequestSent(fetch);
     sendEventToCaches(fetch, timestamp + accessLatency);
@@ -661,7 +669,7 @@ void DirectoryController::issueMemoryRequest(MemEvent * ev, DirEntry * entry) {
     Addr localAddr          = convertAddressToLocalAddress(ev->getAddr());
     Addr localBaseAddr      = convertAddressToLocalAddress(ev->getBaseAddr());
     MemEvent *reqEv         = new MemEvent(this, localAddr, localBaseAddr, ev->getCmd(), cacheLineSize);
-    reqEv->setRqstr(ev->getRqstr());
+    reqEv->setRqstr(ev->getRqstrID());
     reqEv->setVirtualAddress(ev->getVirtualAddress());
     reqEv->setInstructionPointer(ev->getInstructionPointer());
     reqEv->setMemFlags(ev->getMemFlags());
@@ -674,7 +682,7 @@ void DirectoryController::issueMemoryRequest(MemEvent * ev, DirEntry * entry) {
     if (memLink) {
         memMsgQueue.insert(std::pair<uint64_t,MemEvent*>(deliveryTime, reqEv));
     } else {
-        reqEv->setDst(memoryName);
+        reqEv->setDst(memoryID);
         netMsgQueue.insert(std::pair<uint64_t,MemEvent*>(deliveryTime, reqEv));
     }
 #ifdef __SST_DEBUG_OUTPUT__
@@ -1154,8 +1162,10 @@ void DirectoryController::handleDirEntryMemoryResponse(MemEvent * ev) {
             break;
         case S_d:
             entry->setState(S);
+            break;
         case M_d:
             entry->setState(M);
+            break;
         default:
             dbg.fatal(CALL_INFO, -1, "Directory Controller %s: DirEntry response received for addr 0x%" PRIx64 " but state is %s\n", getName().c_str(), entry->getBaseAddr(), StateString[st]);
     }
@@ -1172,8 +1182,10 @@ void DirectoryController::getDirEntryFromMemory(DirEntry * entry) {
             break;
         case S:
             entry->setState(S_d);
+            break;
         case M:
             entry->setState(M_d);
+            break;
         default:
             dbg.fatal(CALL_INFO,-1,"Direcctory Controller %s: cache miss for addr 0x%" PRIx64 " but state is %s\n",getName().c_str(),entry->getBaseAddr(), StateString[st]);
     }
@@ -1188,7 +1200,7 @@ void DirectoryController::getDirEntryFromMemory(DirEntry * entry) {
     if (memLink) {
         memMsgQueue.insert(std::pair<uint64_t,MemEvent*>(deliveryTime, me));
     } else {
-        me->setDst(memoryName);
+        me->setDst(memoryID);
         netMsgQueue.insert(std::pair<uint64_t,MemEvent*>(deliveryTime, me));
     }
 #ifdef __SST_DEBUG_OUTPUT__
@@ -1207,6 +1219,7 @@ void DirectoryController::mshrNACKRequest(MemEvent* ev) {
 void DirectoryController::printStatus(Output &out){
     out.output("MemHierarchy::DirectoryController %s\n", getName().c_str());
     out.output("\t# Entries in cache:  %zu\n", entryCacheSize);
+    if (entrySpill) out.output("\t# Entries spilled:  %zu\n", spillIndex.size());
     out.output("\t# Requests in queue:  %zu\n", workQueue.size());
     for(std::list<MemEvent*>::iterator i = workQueue.begin() ; i != workQueue.end() ; ++i){
         out.output("\t\t(%" PRIu64 ", %d)\n", (*i)->getID().first, (*i)->getID().second);
@@ -1216,8 +1229,8 @@ void DirectoryController::printStatus(Output &out){
 
 
 DirectoryController::DirEntry* DirectoryController::getDirEntry(Addr baseAddr){
-	std::map<Addr, DirEntry*>::iterator i = directory.find(baseAddr);
-	if(directory.end() == i) return NULL;
+	std::unordered_map<Addr, DirEntry*>::iterator i = directory.find(baseAddr);
+	if(directory.end() == i) return entrySpill ? fillDirEntry(baseAddr) : NULL;
 	return i->second;
 }
 
@@ -1227,17 +1240,80 @@ DirectoryController::DirEntry* DirectoryController::createDirEntry(Addr baseAddr
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == baseAddr) dbg.debug(_L10_, "Creating Directory Entry for 0x%" PRIx64 "\n", baseAddr);
 #endif
-    DirEntry *entry = new DirEntry(baseAddr, addr, numTargets, &dbg);
+    DirEntry *entry;
+    if (entryPool.empty()) {
+        entry = new DirEntry(baseAddr, addr, numTargets, &dbg);
+    } else {
+        entry = entryPool.back();
+        entryPool.pop_back();
+        entry->reset(baseAddr, addr);
+    }
     entry->cacheIter = entryCache.end();
     directory[baseAddr] = entry;
     return entry;
 }
 
 
+void DirectoryController::releaseDirEntry(DirEntry * entry){
+    directory.erase(entry->getBaseAddr());
+    entryPool.push_back(entry);
+}
+
+
+/* Record layout: word 0 = state | (owner+1) << 32, word 1 = addr, words 2..n+1 = sharer bits */
+void DirectoryController::spillDirEntry(DirEntry * entry){
+    if (spillRecordWords == 0) spillRecordWords = 2 + entry->sharers.size();
+    
+    uint32_t record;
+    if (spillFree.empty()) {
+        record = spillRegion.size() / spillRecordWords;
+        spillRegion.resize(spillRegion.size() + spillRecordWords);
+    } else {
+        record = spillFree.back();
+        spillFree.pop_back();
+    }
+    uint64_t * words = &spillRegion[record * spillRecordWords];
+    words[0] = (uint64_t)entry->getState() | ((uint64_t)(uint32_t)(entry->getOwner() + 1) << 32);
+    words[1] = entry->addr;
+    for (uint32_t i = 0; i < entry->sharers.size(); i++) words[i + 2] = entry->sharers[i];
+    spillIndex[entry->getBaseAddr()] = record;
+#ifdef __SST_DEBUG_OUTPUT__
+    if (DEBUG_ALL || DEBUG_ADDR == entry->getBaseAddr()) dbg.debug(_L10_, "Spilling entry for 0x%" PRIx64 " to record %u\n", entry->getBaseAddr(), record);
+#endif
+    releaseDirEntry(entry);
+}
+
+
+DirectoryController::DirEntry* DirectoryController::fillDirEntry(Addr baseAddr){
+    std::unordered_map<Addr, uint32_t>::iterator it = spillIndex.find(baseAddr);
+    if (it == spillIndex.end()) return NULL;
+    
+    uint32_t record = it->second;
+    spillIndex.erase(it);
+    spillFree.push_back(record);
+    
+    uint64_t * words = &spillRegion[record * spillRecordWords];
+    DirEntry * entry = createDirEntry(baseAddr, words[1], 0);
+    entry->setState((State)(words[0] & 0xFFFFFFFF));
+    int owner = (int)(words[0] >> 32) - 1;
+    if (owner != -1) entry->setOwner(owner);
+    for (uint32_t i = 0; i < entry->sharers.size(); i++) {
+        for (uint64_t bits = words[i + 2]; bits != 0; bits &= bits - 1) {
+            entry->addSharer(i * 64 + __builtin_ctzll(bits));
+        }
+    }
+    entry->setCached(false);    // Must be read back from memory before use
+#ifdef __SST_DEBUG_OUTPUT__
+    if (DEBUG_ALL || DEBUG_ADDR == baseAddr) dbg.debug(_L10_, "Refilling entry for 0x%" PRIx64 " from record %u\n", baseAddr, record);
+#endif
+    return entry;
+}
+
+
 void DirectoryController::sendInvalidate(int target, MemEvent * reqEv, DirEntry* entry){
     MemEvent *me = new MemEvent(this, entry->getBaseAddr(), entry->getBaseAddr(), Inv, cacheLineSize);
-    me->setDst(nodeid_to_name[target]);
-    me->setRqstr(reqEv->getRqstr());
+    me->setDst(nodeid_to_endpoint[target]);
+    me->setRqstr(reqEv->getRqstrID());
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == reqEv->getBaseAddr()) dbg.debug(_L4_, "Sending Invalidate.  Dst: %s\n", nodeid_to_name[target].c_str());
 #endif
@@ -1249,8 +1325,8 @@ void DirectoryController::sendInvalidate(int target, MemEvent * reqEv, DirEntry*
 
 void DirectoryController::sendAckPut(MemEvent * event) {
     MemEvent * me = new MemEvent(this, event->getBaseAddr(), event->getBaseAddr(), AckPut);
-    me->setDst(event->getSrc());
-    me->setRqstr(event->getRqstr());
+    me->setDst(event->getSrcID());
+    me->setRqstr(event->getRqstrID());
 
     profileResponseSent(me);
     
@@ -1267,6 +1343,7 @@ uint32_t DirectoryController::node_id(const std::string &name){
 		node_lookup[name] = id = targetCount++;
         nodeid_to_name.resize(targetCount);
         nodeid_to_name[id] = name;
+        nodeid_to_endpoint.push_back(NodeIDMap::getID(name));
 	}
     else id = i->second;
     
@@ -1303,8 +1380,7 @@ void DirectoryController::updateCache(DirEntry *entry){
 #ifdef __SST_DEBUG_OUTPUT__
             if (DEBUG_ALL || DEBUG_ADDR == entry->getBaseAddr()) dbg.debug(_L10_, "Entry for 0x%" PRIx64 " has no references - purging\n", entry->getBaseAddr());
 #endif
-            directory.erase(entry->getBaseAddr());
-            delete entry;
+            releaseDirEntry(entry);
             return;
         } else {
             entryCache.push_front(entry);
@@ -1324,6 +1400,8 @@ void DirectoryController::updateCache(DirEntry *entry){
                 oldEntry->cacheIter = entryCache.end();
                 oldEntry->setCached(false);
                 sendEntryToMemory(oldEntry);
+                if (entrySpill && oldEntry->getWaitingAcks() == 0 && 
+                        (oldEntry->getState() == S || oldEntry->getState() == M)) spillDirEntry(oldEntry);
             }
         }
     }
@@ -1342,7 +1420,7 @@ void DirectoryController::sendEntryToMemory(DirEntry *entry){
     if (memLink) {
         memMsgQueue.insert(std::pair<uint64_t,MemEvent*>(deliveryTime, me));
     } else {
-        me->setDst(memoryName);
+        me->setDst(memoryID);
         netMsgQueue.insert(std::pair<uint64_t,MemEvent*>(deliveryTime, me));
     }
 }
@@ -1366,7 +1444,7 @@ MemEvent::id_type DirectoryController::writebackData(MemEvent *data_event){
     if (memLink) {
         memMsgQueue.insert(std::pair<uint64_t,MemEvent*>(deliveryTime, ev));
     } else {
-        ev->setDst(memoryName);
+        ev->setDst(memoryID);
         netMsgQueue.insert(std::pair<uint64_t,MemEvent*>(deliveryTime, ev));
     }
 #ifdef __SST_DEBUG_OUTPUT__
@@ -1490,7 +1568,7 @@ void DirectoryController::init(unsigned int phase){
             if (memLink) {
                 memLink->sendInitData(ev);
             } else {
-                ev->setDst(memoryName);
+                ev->setDst(memoryID);
                 network->sendInitData(ev);
             }
         }
@@ -19,6 +19,7 @@
 #define _MEMHIERARCHY_DIRCONTROLLER_H_
 
 #include <map>
+#include <unordered_map>
 #include <set>
 #include <list>
 #include <vector>
@@ -68,6 +69,7 @@ class DirectoryController : public Component {
     /* Directory cache */
     size_t      entryCacheMaxSize;
     size_t      entryCacheSize;
+    bool        entrySpill;         // Whether entries evicted from the directory cache are packed into spillRegion
     
     /* Timestamp & latencies */
     uint64_t    timestamp;
@@ -115,9 +117,18 @@ class DirectoryController : public Component {
 
     /* Directory structures */
     std::list<DirEntry*>                    entryCache;
-    std::map<Addr, DirEntry*>               directory;
+    std::unordered_map<Addr, DirEntry*>     directory;
+    std::vector<DirEntry*>                  entryPool;      // Released entries for reuse
+
+    /* Backing region for entries evicted from the directory cache (entry_cache_spill) 
+     * Each record is one word of state/owner, one of the entry's address, then the sharer bitvector */
+    std::unordered_map<Addr, uint32_t>      spillIndex;     // Address -> record number
+    std::vector<uint64_t>                   spillRegion;
+    std::vector<uint32_t>                   spillFree;      // Unused record numbers
+    uint32_t                                spillRecordWords;
     std::map<std::string, uint32_t>         node_lookup;
     std::vector<std::string>                nodeid_to_name;
+    std::vector<NodeID>                     nodeid_to_endpoint; // Directory node id -> event endpoint NodeID
     
     /* Queue of packets to work on */
     std::list<MemEvent*>                    workQueue;
@@ -129,6 +140,7 @@ class DirectoryController : public Component {
     SST::Link*  memLink;
     MemNIC*     network;
     string      memoryName; // if connected to mem via network, this should be the name of the memory we own - param is memory_name
+    NodeID      memoryID;   // NodeID of memoryName
     
     std::multimap<uint64_t,MemEvent*>   netMsgQueue;
     std::multimap<uint64_t,MemEvent*>   memMsgQueue;
@@ -139,6 +151,15 @@ class DirectoryController : public Component {
     /** Create directory entrye */
     DirEntry* createDirEntry(Addr baseTarget, Addr target, uint32_t reqSize);
 
+    /** Return a directory entry to the pool */
+    void releaseDirEntry(DirEntry * entry);
+
+    /** Pack an evicted entry into the backing region and release it */
+    void spillDirEntry(DirEntry * entry);
+
+    /** Recreate an entry from the backing region, NULL if the address was not spilled */
+    DirEntry* fillDirEntry(Addr baseAddr);
+
     /** Handle incoming GetS request */
     void handleGetS(MemEvent * ev);
     
@@ -250,16 +271,22 @@ class DirectoryController : public Component {
         State               state;          // state
         MemEvent::id_type   lastRequest;    // ID of message we're wanting a response to  - used to track whether a NACK needs to be retried
         std::list<DirEntry*>::iterator cacheIter;
-	std::vector<bool>   sharers;        // set of sharers for block
+        std::vector<uint64_t> sharers;      // bitvector of sharers for block
+        uint32_t            sharerCount;
         int                 owner;          // owner of block
         Output * dbg;
 	
         DirEntry(Addr _baseAddress, Addr _address, uint32_t _bitlength, Output * d){
+            sharers.resize((_bitlength + 63) / 64);
+            reset(_baseAddress, _address);
+            dbg          = d;
+        }
+
+        /* Reinitialize a pooled entry for a new address */
+        void reset(Addr _baseAddress, Addr _address) {
             clearEntry();
             baseAddr     = _baseAddress;
             addr         = _address;
-            sharers.resize(_bitlength);
-            dbg          = d;
             state        = I;
             cached       = false;
         }
@@ -291,31 +318,31 @@ class DirectoryController : public Component {
         }
         
         uint32_t getSharerCount(void) {
-            uint32_t count = 0;
-            for (uint32_t i = 0; i < sharers.size(); i++) {
-                if (sharers[i]) count++;
-            }
-            return count;
+            return sharerCount;
         }
 
         void clearSharers(void){
             for (uint32_t i = 0; i < sharers.size(); i++)
-                sharers[i] = false;
+                sharers[i] = 0;
+            sharerCount = 0;
         }
         
         void addSharer(int _id){
-            sharers[_id]= true;
+            uint64_t bit = 1ULL << (_id % 64);
+            if (!(sharers[_id / 64] & bit)) sharerCount++;
+            sharers[_id / 64] |= bit;
         }
         
         bool isSharer(int id) {
-            return sharers[id];
+            return sharers[id / 64] & (1ULL << (id % 64));
         }
 
         void removeSharer(int _id){
-            if (!sharers[_id]) {
+            if (!isSharer(_id)) {
                 dbg->fatal(CALL_INFO,-1,"Removing a sharer which does not exist\n");
             }
-            sharers[_id]= false;
+            sharers[_id / 64] &= ~(1ULL << (_id % 64));
+            sharerCount--;
         }
         
         int getOwner(void) {
@@ -29,6 +29,7 @@
 #include "membackend/memBackend.h"
 #include "membackend/simpleMemBackend.h"
 #include "membackend/simpleDRAMBackend.h"
+#include "membackend/frfcfsDRAMBackend.h"
 #include "membackend/vaultSimBackend.h"
 #include "membackend/requestReorderSimple.h"
 #include "membackend/requestReorderByRow.h"
@@ -83,6 +84,7 @@ static const ElementInfoParam cache_params[] = {
     {"replacement_policy",      "Optional, string - Replacement policy of the cache array. Options:  LRU[least-recently-used], LFU[least-frequently-used], Random, MRU[most-recently-used], or NMRU[not-most-recently-used]. ", "lru"},
     {"cache_type",              "Optional, string - Cache type. Options: inclusive cache ('inclusive', required for L1s), non-inclusive cache ('noninclusive') or non-inclusive cache with a directory ('noninclusive_with_directory', required for non-inclusive caches with multiple upper level caches directly above them),", "inclusive"},
     {"max_requests_per_cycle",  "Maximum number of requests to accept per cycle. 0 or negative is unlimited.", "-1"},
+    {"array_layout",            "Optional, string - Layout of the cache array. 'object' allocates one object per line, 'flat' keeps tags contiguous per set and allocates all lines in one block (faster lookups and less memory for large arrays). 'flat' is not supported with 'noninclusive_with_directory'.", "object"},
     {"noninclusive_directory_repl",    "Optional, string - If non-inclusive directory exists, its replacement policy. LRU, LFU, MRU, NMRU, or RANDOM. (not case-sensitive).", "LRU"},
     {"noninclusive_directory_entries", "Optional, int - Number of entries in the directory. Must be at least 1 if the non-inclusive directory exists.", "0"},
     {"noninclusive_directory_associativity", "Optional, int - For a set-associative directory, number of ways.", "1"},
@@ -329,6 +331,8 @@ static const ElementInfoStatistic cache_statistics[] = {
     {"latency_GetSEx_M",        "Latency for read-exclusive misses that find the block owned by another cache in M state", "cycles", 1},
     /* Miscellaneous */
     {"EventStalledForLockedCacheline",  "Number of times an event (FetchInv, FetchInvX, eviction, Fetch, etc.) was stalled because a cache line was locked", "instances", 1},
+    {"MemEventPool_hits",   "MemEvent and payload allocations served from the recycling pool while this component handled events", "count", 1},
+    {"MemEventPool_misses", "MemEvent and payload allocations that fell through to the heap while this component handled events", "count", 1},
 #ifdef USE_VAULTSIM_HMC    
     /* hmc counters */
     {"hmcCacheHits", "cache hit number for hmc instructions", "count", 1},
@@ -479,6 +483,8 @@ static const ElementInfoStatistic memctrl_statistics[] = {
     { "requests_received_GetX",             "Number of GetX (read) requests received",          "requests", 1},
     { "requests_received_PutM",             "Number of PutM (write) requests received",         "requests", 1},
     { "outstanding_requests",               "Total number of outstanding requests each cycle",  "requests", 1},
+    { "MemEventPool_hits",                  "MemEvent and payload allocations served from the recycling pool while this component handled events", "count", 1},
+    { "MemEventPool_misses",                "MemEvent and payload allocations that fell through to the heap while this component handled events", "count", 1},
     { NULL, NULL, NULL, 0 }
 };
 
@@ -525,6 +531,52 @@ static const ElementInfoStatistic simpleDRAM_stats[] = {
 };
 
 
+static SubComponent* create_Mem_FRFCFSDRAM(Component* comp, Params& params) {
+    return new FRFCFSDRAM(comp, params);
+}
+
+static const ElementInfoParam frfcfsDRAM_params[] = {
+    {"verbose",     "Sets the verbosity of the backend output", "0" },
+    {"cycle_time",  "Latency of a cycle or clock frequency (e.g., '4ns' and '250MHz' are both accepted)", "1.25ns"},
+    {"channels",    "Number of channels. Must be a power of 2.", "1"},
+    {"ranks",       "Number of ranks per channel. Must be a power of 2.", "1"},
+    {"banks",       "Number of banks per rank. Must be a power of 2.", "8"},
+    {"bank_interleave_granularity", "Granularity of interleaving in bytes (B), generally a cache line. Must be a power of 2.", "64B"},
+    {"row_size",    "Size of a row in bytes (B). Must be a power of 2.", "8KiB"},
+    {"address_mapping", "Order of address fields from most to least significant, separated by ':'. Must contain row (first), rank, bank, col and channel.", "row:col:rank:bank:channel"},
+    {"bank_xor_hash",   "XOR the bank index with the low row bits to spread row conflicts across banks", "0"},
+    {"row_policy",  "Policy for managing the row buffer - open or closed.", "open"},
+    {"tCAS",        "Column access latency in cycles (i.e., access time if correct row is already open)", "11"},
+    {"tRCD",        "Row access latency in cycles (i.e., time to open a row)", "11"},
+    {"tRP",         "Precharge delay in cycles (i.e., time to close a row)", "11"},
+    {"tBURST",      "Cycles a transfer occupies the channel data bus", "4"},
+    {"tWTR",        "Write-to-read turnaround in cycles", "6"},
+    {"tRTW",        "Read-to-write turnaround in cycles", "2"},
+    {"tREFI",       "Refresh interval per rank in cycles. 0 disables refresh.", "6240"},
+    {"tRFC",        "Refresh duration in cycles", "208"},
+    {"max_queue_depth",         "Maximum number of requests queued per channel. Further requests are rejected until one issues.", "64"},
+    {"write_high_watermark",    "Enter write drain mode when this many writes are queued on a channel. 0 disables drain mode.", "32"},
+    {"write_low_watermark",     "Leave write drain mode when queued writes fall to this number", "16"},
+    {"starvation_limit",        "Requests waiting this many cycles are issued ahead of row hits", "1000"},
+    {"max_row_hits",            "Maximum consecutive row hits to prioritize on a bank before falling back to oldest-first", "16"},
+    {"max_write_age",           "Outside write drain mode, issue a write ahead of waiting reads once it has waited this many cycles. 0 disables.", "2000"},
+    {NULL, NULL, NULL}
+};
+
+static const ElementInfoStatistic frfcfsDRAM_stats[] = {
+    {"row_hit",             "Requests issued to an open row, per bank (subid = bank index)", "count", 1},
+    {"row_miss",            "Requests issued with no row open, per bank (subid = bank index)", "count", 1},
+    {"row_conflict",        "Requests issued with the wrong row open, per bank (subid = bank index)", "count", 1},
+    {"queue_depth",         "Bank queue depth seen by each arriving request, per bank (subid = bank index)", "requests", 1},
+    {"refreshes",           "Number of rank refreshes", "count", 1},
+    {"write_drains",        "Number of times a channel entered write drain mode", "count", 1},
+    {"starvation_overrides","Number of times an old request was issued ahead of a row hit", "count", 1},
+    {"write_age_overrides", "Number of times an old write was issued ahead of waiting reads outside write drain mode", "count", 1},
+    {"requests_rejected",   "Number of requests rejected because the channel queue was full", "count", 1},
+    { NULL, NULL, NULL, 0 }
+};
+
+
 static SubComponent* create_Mem_RequestReorderSimple(Component * comp, Params& params) {
     return new RequestReorderSimple(comp, params);
 }
@@ -699,6 +751,7 @@ static const ElementInfoParam dirctrl_params[] = {
     {"interleave_step",         "Distance between sucessive interleaved chunks on this controller in bytes. Note: This definition has CHANGED (used to be specified in KiB)", "0B"},
     {"clock",                   "Clock rate of controller.", "1GHz"},
     {"entry_cache_size",        "Size (in # of entries) the controller will cache.", "0"},
+    {"entry_cache_spill",       "Optional, bool - Pack entries evicted from the entry cache into a compact backing region instead of keeping them resident. They are read back from memory on the next access.", "0"},
     {"debug",                   "0 (default): No debugging, 1: STDOUT, 2: STDERR, 3: FILE.", "0"},
     {"debug_level",             "Debugging level: 0 to 10", "0"},
     {"debug_addr",              "Address (in decimal) to be debugged, if not specified or specified as -1, debug output for all addresses will be printed","-1"},
@@ -809,6 +862,15 @@ static const ElementInfoSubComponent subcomponents[] = {
         simpleDRAM_stats,
         "SST::MemHierarchy::MemBackend"
     },
+    {
+        "frfcfsDRAM",
+        "Bank/rank-aware DRAM timing model with an FR-FCFS scheduler, write draining and refresh",
+        NULL,
+        create_Mem_FRFCFSDRAM,
+        frfcfsDRAM_params,
+        frfcfsDRAM_stats,
+        "SST::MemHierarchy::MemBackend"
+    },
     {
         "reorderSimple",
         "Simple request re-orderer, issues the first N requests that are accepted by the backend",
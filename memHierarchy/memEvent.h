@@ -16,6 +16,9 @@
 #include <sst/core/component.h>
 #include <sst/core/event.h>
 #include "sst/core/element.h"
+#include <sst/core/threadsafe.h>
+
+#include "sizeClassPool.h"
 
 
 namespace SST { namespace MemHierarchy {
@@ -131,6 +134,151 @@ static const char* StateString[] __attribute__((unused)) = {
 
 static const std::string NONE = "None";
 
+/*
+ *  Compact integer IDs for endpoint names (event sources, destinations and requestors)
+ *  Names are assigned an ID the first time they are seen, normally when a component 
+ *  creates its first event during init. IDs are local to this process; serialized events 
+ *  carry names and are re-mapped on arrival. Names only need to be resolved for debug
+ *  output and for routing components that key on names.
+ *  getID(string) takes a lock, so components resolve the names they address once, at
+ *  construction or init, and store the IDs; events are then addressed by ID.
+ */
+typedef uint32_t NodeID;
+static const NodeID NO_NODE   = 0;  /* "" */
+static const NodeID NONE_NODE = 1;  /* NONE */
+
+class NodeIDMap {
+public:
+    /** Return the ID for a name, assigning a new ID if the name has not been seen */
+    static NodeID getID(const std::string &name) {
+        Table &t = table();
+        t.lock.lock();
+        std::map<std::string, NodeID>::iterator it = t.lookup.find(name);
+        NodeID id = (it != t.lookup.end()) ? it->second : t.add(name);
+        t.lock.unlock();
+        return id;
+    }
+
+    /** Return the ID for a component's name. 
+     *  Cached per thread so that creating an event does not take the table lock */
+    static NodeID getID(const Component *comp) {
+        static __thread const Component * keys[COMP_CACHE_SIZE];
+        static __thread NodeID ids[COMP_CACHE_SIZE];
+        size_t slot = (reinterpret_cast<uintptr_t>(comp) >> 4) % COMP_CACHE_SIZE;
+        if (keys[slot] != comp) {
+            ids[slot] = getID(comp->getName());
+            keys[slot] = comp;
+        }
+        return ids[slot];
+    }
+
+    /** Return the name for an ID. Lock-free; entries never move once assigned */
+    static const std::string& getName(NodeID id) { 
+        return table().chunks[id / CHUNK_SIZE][id % CHUNK_SIZE]; 
+    }
+
+    /** Number of IDs assigned so far */
+    static NodeID size() { return table().next; }
+
+private:
+    static const size_t COMP_CACHE_SIZE = 64;
+    static const size_t CHUNK_SIZE = 1024;
+    static const size_t MAX_CHUNKS = 1024;
+
+    struct Table {
+        SST::Core::ThreadSafe::Spinlock     lock;
+        std::map<std::string, NodeID>       lookup;
+        std::string *                       chunks[MAX_CHUNKS];
+        NodeID                              next;
+
+        Table() : next(0) {
+            for (size_t i = 0; i < MAX_CHUNKS; i++) chunks[i] = NULL;
+            add("");
+            add(NONE);
+        }
+
+        NodeID add(const std::string &name) {
+            if (next / CHUNK_SIZE >= MAX_CHUNKS) {
+                Output::getDefaultObject().fatal(CALL_INFO, -1, "NodeIDMap: too many endpoint names (%zu)\n", CHUNK_SIZE * MAX_CHUNKS);
+            }
+            if (chunks[next / CHUNK_SIZE] == NULL) chunks[next / CHUNK_SIZE] = new std::string[CHUNK_SIZE];
+            chunks[next / CHUNK_SIZE][next % CHUNK_SIZE] = name;
+            lookup[name] = next;
+            return next++;
+        }
+    };
+
+    static Table& table() {
+        static Table t;
+        return t;
+    }
+};
+
+/*
+ *  Recycling allocator for MemEvents and their payload buffers
+ *  Event storage comes from the size class free lists. Payload vectors are handed back when an 
+ *  event is destroyed and swapped into the next event that needs a payload so their capacity 
+ *  is reused. Caches and memory controllers charge the hits/misses made while they handle an 
+ *  event or clock tick to their own statistics with a StatScope.
+ */
+class MemEventPool : public SizeClassPool<MemEventPool, 8192> {
+public:
+    /** Give an empty payload vector a recycled buffer, if one is available */
+    static void takePayload(std::vector<uint8_t> &payload) {
+        std::vector<std::vector<uint8_t> > * free = payloads();
+        if (free != NULL && !free->empty()) {
+            payload.swap(free->back());
+            free->pop_back();
+            countHit();
+        } else {
+            countMiss();
+        }
+    }
+
+    /** Keep a payload vector's buffer for reuse */
+    static void returnPayload(std::vector<uint8_t> &payload) {
+        if (payload.capacity() == 0) return;
+        std::vector<std::vector<uint8_t> > *& free = payloads();
+        if (free == NULL) {
+            free = new std::vector<std::vector<uint8_t> >();
+            free->reserve(MAX_FREE_PAYLOADS);
+        }
+        if (free->size() >= MAX_FREE_PAYLOADS) return;
+        payload.clear();
+        free->push_back(std::vector<uint8_t>());
+        free->back().swap(payload);
+    }
+
+private:
+    static const size_t MAX_FREE_PAYLOADS = 4096;
+
+    static std::vector<std::vector<uint8_t> > *& payloads() {
+        static __thread std::vector<std::vector<uint8_t> > * p;
+        return p;
+    }
+};
+
+/* Payload vector whose buffer is taken from and returned to MemEventPool */
+class PooledPayload : public std::vector<uint8_t> {
+public:
+    PooledPayload() {}
+    PooledPayload(const PooledPayload &other) : std::vector<uint8_t>() {
+        prepare(other.size());
+        assign(other.begin(), other.end());
+    }
+    PooledPayload& operator=(const PooledPayload &other) {
+        if (this != &other) {
+            prepare(other.size());
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+    ~PooledPayload() { MemEventPool::returnPayload(*this); }
+
+    /** Pick up a recycled buffer before the first allocation */
+    void prepare(size_t size) { if (size > 0 && capacity() == 0) MemEventPool::takePayload(*this); }
+};
+
 /**
  * Interface Event used to represent Memory-based communication.
  *
@@ -163,6 +311,10 @@ public:
         initialize(src, addr, baseAddr, cmd, data);
     }
 
+    /** MemEvents are allocated from MemEventPool */
+    static void* operator new(std::size_t size) { return MemEventPool::allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { MemEventPool::release(ptr, size); }
+
     /** Create a new MemEvent instance, pre-configured to act as a NACK response */
     MemEvent* makeNACKResponse(const Component *source, MemEvent* NACKedEvent) {
         MemEvent *me      = new MemEvent(*this);
@@ -201,7 +353,7 @@ public:
 
     void initialize(const Component *src, Addr addr, Addr baseAddr, Command cmd) {
         initialize();
-        src_  = src->getName();
+        src_  = NodeIDMap::getID(src);
         addr_ = addr;
         baseAddr_ = baseAddr;
         cmd_  = cmd;
@@ -210,7 +362,7 @@ public:
 
      void initialize(const Component *src, Addr addr, Addr baseAddr, Command cmd, uint32_t size) {
         initialize();
-        src_      = src->getName();
+        src_      = NodeIDMap::getID(src);
         addr_     = addr;
         baseAddr_ = baseAddr;
         cmd_      = cmd;
@@ -220,7 +372,7 @@ public:
 
     void initialize(const Component *src, Addr addr, Addr baseAddr, Command cmd, std::vector<uint8_t>& data) {
         initialize();
-        src_         = src->getName();
+        src_         = NodeIDMap::getID(src);
         addr_        = addr;
         baseAddr_    = baseAddr;
         cmd_         = cmd;
@@ -234,9 +386,9 @@ public:
         eventID_            = generateUniqueId();
         responseToID_       = NO_ID;
         baseAddr_           = 0;
-        dst_                = NONE;
-        src_                = NONE;
-        rqstr_              = NONE;
+        dst_                = NONE_NODE;
+        src_                = NONE_NODE;
+        rqstr_              = NONE_NODE;
         size_               = 0;
         flags_              = 0;
         memFlags_           = 0;
@@ -344,7 +496,10 @@ public:
     /** @return  the data payload. */
     dataVec& getPayload(void) {
         /* Lazily allocate space for payload */
-        if ( payload_.size() < size_ )  payload_.resize(size_);
+        if ( payload_.size() < size_ ) {
+            payload_.prepare(size_);
+            payload_.resize(size_);
+        }
         return payload_;
     }
 
@@ -354,7 +509,8 @@ public:
      */
     void setPayload(std::vector<uint8_t>& data) {
         setSize(data.size());
-        payload_ = data;
+        payload_.prepare(data.size());
+        payload_.assign(data.begin(), data.end());
     }
 
     /** Sets the data payload and payload size.
@@ -363,6 +519,7 @@ public:
      */
     void setPayload(uint32_t size, uint8_t* data) {
         setSize(size);
+        payload_.prepare(size);
         payload_.resize(size);
         for ( uint32_t i = 0 ; i < size ; i++ ) {
             payload_[i] = data[i];
@@ -407,17 +564,29 @@ public:
     bool getDirty() { return dirty_; }
 
     /** @return the source string - who sent this MemEvent */
-    const std::string& getSrc(void) const { return src_; }
-    /** Sets the source string - who sent this MemEvent */
-    void setSrc(const std::string& src) { src_ = src; }
+    const std::string& getSrc(void) const { return NodeIDMap::getName(src_); }
+    /** @return the source ID - who sent this MemEvent */
+    NodeID getSrcID(void) const { return src_; }
+    /** Sets the source string - who sent this MemEvent. Looks the name up; use the ID setter per event */
+    void setSrc(const std::string& src) { src_ = NodeIDMap::getID(src); }
+    /** Sets the source ID - who sent this MemEvent */
+    void setSrc(NodeID src) { src_ = src; }
     /** @return the destination string - who receives this MemEvent */
-    const std::string& getDst(void) const { return dst_; }
-    /** Sets the destination string - who received this MemEvent */
-    void setDst(const std::string& dst) { dst_ = dst; }
+    const std::string& getDst(void) const { return NodeIDMap::getName(dst_); }
+    /** @return the destination ID - who receives this MemEvent */
+    NodeID getDstID(void) const { return dst_; }
+    /** Sets the destination string - who received this MemEvent. Looks the name up; use the ID setter per event */
+    void setDst(const std::string& dst) { dst_ = NodeIDMap::getID(dst); }
+    /** Sets the destination ID - who receives this MemEvent */
+    void setDst(NodeID dst) { dst_ = dst; }
     /** @return the requestor string - whose original request caused this MemEvent */
-    const std::string& getRqstr(void) const { return rqstr_; }
-    /** Sets the requestor string - whose original request caused this MemEvent */
-    void setRqstr(const std::string& rqstr) { rqstr_ = rqstr; }
+    const std::string& getRqstr(void) const { return NodeIDMap::getName(rqstr_); }
+    /** @return the requestor ID - whose original request caused this MemEvent */
+    NodeID getRqstrID(void) const { return rqstr_; }
+    /** Sets the requestor string - whose original request caused this MemEvent. Looks the name up; use the ID setter per event */
+    void setRqstr(const std::string& rqstr) { rqstr_ = NodeIDMap::getID(rqstr); }
+    /** Sets the requestor ID - whose original request caused this MemEvent */
+    void setRqstr(NodeID rqstr) { rqstr_ = rqstr; }
 
     /** @returns the state of all flags for this MemEvent */
     uint32_t getFlags(void) const { return flags_; }
@@ -473,13 +642,13 @@ private:
     uint32_t        groupID_;           // ???
     Addr            addr_;              // Address
     Addr            baseAddr_;          // Base (line) address
-    string          src_;               // Source ID
-    string          dst_;               // Destination ID
-    string          rqstr_;             // Cache that originated this request
+    NodeID          src_;               // Source ID
+    NodeID          dst_;               // Destination ID
+    NodeID          rqstr_;             // Cache that originated this request
     Command         cmd_;               // Command
     MemEvent*       NACKedEvent_;       // For a NACK, pointer to the NACKed event
     int             retries_;           // For NACKed events, how many times a retry has been sent
-    dataVec         payload_;           // Data
+    PooledPayload   payload_;           // Data
     State           grantedState_;      // For data responses, the cohrence state that the request is granted in
     bool            prefetch_;          // Whether this request came from a prefetcher
     bool            atomic_;            // Whether this request is atomic
@@ -492,7 +661,7 @@ private:
     Addr 	    vAddr_;             // Virtual address associated with the request
     bool            inProgress_;        // Whether this request is currently being handled, if in MSHR
 
-    MemEvent() {} // For serialization only
+    MemEvent() : src_(NONE_NODE), dst_(NONE_NODE), rqstr_(NONE_NODE) {} // For serialization only
 
 public:
     void serialize_order(SST::Core::Serialization::serializer &ser) {
@@ -505,13 +674,25 @@ public:
         ser & groupID_;
         ser & addr_;
         ser & baseAddr_;
-        ser & src_;
-        ser & dst_;
-        ser & rqstr_;
+        /* NodeIDs are process-local so serialize the names */
+        std::string src, dst, rqstr;
+        if (ser.mode() != SST::Core::Serialization::serializer::UNPACK) {
+            src = getSrc();
+            dst = getDst();
+            rqstr = getRqstr();
+        }
+        ser & src;
+        ser & dst;
+        ser & rqstr;
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            src_ = NodeIDMap::getID(src);
+            dst_ = NodeIDMap::getID(dst);
+            rqstr_ = NodeIDMap::getID(rqstr);
+        }
         ser & cmd_;
         ser & NACKedEvent_;
         ser & retries_;
-        ser & payload_;
+        ser & static_cast<dataVec&>(payload_);
         ser & grantedState_;
         ser & prefetch_;
         ser & atomic_;
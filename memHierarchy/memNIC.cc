@@ -134,11 +134,11 @@ void MemNIC::init(unsigned int phase)
 
             // save a copy for lookups later if we should be sending requests to this entity
             if ((ci.type == MemNIC::TypeCache || ci.type == MemNIC::TypeNetworkCache) && (peerCI.type == MemNIC::TypeDirectoryCtrl || peerCI.type == MemNIC::TypeNetworkDirectory)) { // cache -> dir
-                destinations[imre->compInfo] = imre->name;
+                destinations[imre->compInfo] = NodeIDMap::getID(imre->name);
             } else if (ci.type == MemNIC::TypeCacheToCache && peerCI.type == MemNIC::TypeNetworkCache) { // higher cache -> lower cache
-                destinations[imre->compInfo] = imre->name;
+                destinations[imre->compInfo] = NodeIDMap::getID(imre->name);
             } else if (ci.type == MemNIC::TypeSmartMemory && (peerCI.type == MemNIC::TypeSmartMemory || peerCI.type == MemNIC::TypeDirectoryCtrl || peerCI.type == MemNIC::TypeNetworkDirectory ) ) {
-                destinations[imre->compInfo] = imre->name;
+                destinations[imre->compInfo] = NodeIDMap::getID(imre->name);
             }
         } else {
             initQueue.push_back(static_cast<MemRtrEvent*>(payload));
@@ -181,14 +181,14 @@ bool MemNIC::initDataReady() {
     return (initQueue.size() > 0);
 }
 
-std::string MemNIC::findTargetDestination(Addr addr)
+NodeID MemNIC::findTargetDestination(Addr addr)
 {
-    for ( std::map<MemNIC::ComponentTypeInfo, std::string>::const_iterator i = destinations.begin() ;
+    for ( std::map<MemNIC::ComponentTypeInfo, NodeID>::const_iterator i = destinations.begin() ;
             i != destinations.end() ; ++i ) {
         if ( i->first.contains(addr) ) return i->second;
     }
     dbg->fatal(CALL_INFO,-1,"MemNIC %s cannot find a target for address 0x%" PRIx64 "\n",comp->getName().c_str(),addr);
-    return "";
+    return NO_NODE;
 }
 
 
@@ -270,9 +270,9 @@ MemEvent* MemNIC::recv(void)
 
                 // Save any new address ranges.
                 if ((ci.type == MemNIC::TypeCache || ci.type == MemNIC::TypeNetworkCache) && (peerCI.type == MemNIC::TypeDirectoryCtrl || peerCI.type == MemNIC::TypeNetworkDirectory)) { // cache -> dir
-                    destinations[imre->compInfo] = imre->name;
+                    destinations[imre->compInfo] = NodeIDMap::getID(imre->name);
                 } else if (ci.type == MemNIC::TypeCacheToCache && peerCI.type == MemNIC::TypeNetworkCache) { // higher cache -> lower cache
-                    destinations[imre->compInfo] = imre->name;
+                    destinations[imre->compInfo] = NodeIDMap::getID(imre->name);
                 }
             }
         }
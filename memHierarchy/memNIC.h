@@ -186,8 +186,8 @@ private:
     std::map<std::string, int> addrMap;
     /* Built during init -> available in Setup and later */
     std::vector<PeerInfo_t> peers;
-    /* Built during init -> available for lookups later */
-    std::map<MemNIC::ComponentTypeInfo, std::string> destinations;
+    /* Built during init -> available for lookups later. Names are resolved to NodeIDs when the entry is added */
+    std::map<MemNIC::ComponentTypeInfo, NodeID> destinations;
 
 
     /* Translates a MemEvent string destination to an network address
@@ -223,6 +223,7 @@ public:
     void init(unsigned int phase);
     void finish(void);
     bool clock(void);
+    bool isIdle(void) const { return sendQueue.empty(); }
     bool isValidDestination(std::string target);
 
     void send(MemEvent *ev);
@@ -231,8 +232,8 @@ public:
     MemEvent* recvInitData(void);
     bool initDataReady();
     const std::vector<PeerInfo_t>& getPeerInfo(void) const { return peers; }
-    // translate a memory address to a network target (string)
-    std::string findTargetDestination(Addr addr);
+    // translate a memory address to a network target (NodeID)
+    NodeID findTargetDestination(Addr addr);
     // NOTE: does not clear the listing of destinations which are used for address lookups
     void clearPeerInfo(void) { peers.clear(); }
 
@@ -35,6 +35,7 @@ public:
     DRAMSimMemory(Component *comp, Params &params);
     virtual bool issueRequest(DRAMReq *req);
     virtual void clock();
+    virtual bool isClockIdle() { return false; }   // External simulator must be ticked every cycle
     virtual void finish();
 
 protected:
@@ -35,6 +35,7 @@ public:
     FlashDIMMSimMemory(Component *comp, Params &params);
     bool issueRequest(DRAMReq *req);
     void clock();
+    bool isClockIdle() { return false; }   // External simulator must be ticked every cycle
     void finish();
 
 private:
@@ -0,0 +1,365 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include <sstream>
+#include "membackend/frfcfsDRAMBackend.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/*------------------------------- FR-FCFS DRAM ------------------------------- */
+/* FRFCFSDRAM is a cycle-level DRAM timing model with a first-ready, first-come-first-serve scheduler.
+ *  Requests are queued per bank. Each cycle, each channel issues at most one request:
+ *      - In write drain mode (write queue above the high watermark, until it falls to the low watermark)
+ *        only writes are considered, otherwise reads are preferred and writes issue when no reads wait
+ *        or once the oldest ready write has waited max_write_age cycles. If no bank with a request in the
+ *        preferred direction is ready, a request in the other direction is issued instead
+ *      - Among requests to banks that are ready, the oldest row hit is chosen, then the oldest request
+ *      - A request older than starvation_limit cycles is chosen ahead of row hits, and a bank stops
+ *        getting row-hit priority after max_row_hits consecutive hits
+ *  Latencies:
+ *      Correct row already open: tCAS
+ *      No row open: tRCD + tCAS
+ *      Wrong row open: tRP + tRCD + tCAS
+ *      plus tWTR/tRTW when the data bus changes direction. Each transfer holds the channel's data bus for tBURST.
+ *  Each rank is refreshed every tREFI cycles, closing its rows and blocking its banks for tRFC.
+ *
+ *  Addresses are mapped by 'address_mapping', a ':'-separated list of fields from most to least significant
+ *  (above the bank_interleave_granularity offset). 'row' must come first. Example, the default:
+ *      row:col:rank:bank:channel
+ *  With bank_xor_hash, the bank index is XORed with the low bits of the row to spread row conflicts.
+ *
+ * Implementation notes:
+ *  Refresh is applied lazily when the controller clocks the backend, so the controller's clock can be
+ *  turned off while all queues are empty.
+ *  Time is counted in cycles of 'cycle_time'.
+ */
+
+
+FRFCFSDRAM::FRFCFSDRAM(Component *comp, Params &params) : MemBackend(comp, params){
+
+    // Get parameters
+    tCAS    = params.find<unsigned int>("tCAS", 11);
+    tRCD    = params.find<unsigned int>("tRCD", 11);
+    tRP     = params.find<unsigned int>("tRP", 11);
+    tBURST  = params.find<unsigned int>("tBURST", 4);
+    tWTR    = params.find<unsigned int>("tWTR", 6);
+    tRTW    = params.find<unsigned int>("tRTW", 2);
+    tREFI   = params.find<unsigned int>("tREFI", 6240);
+    tRFC    = params.find<unsigned int>("tRFC", 208);
+    std::string cycTime = params.find<std::string>("cycle_time", "1.25ns");
+    channels    = params.find<unsigned int>("channels", 1);
+    ranks       = params.find<unsigned int>("ranks", 1);
+    banks       = params.find<unsigned int>("banks", 8);
+    UnitAlgebra lineSize(params.find<std::string>("bank_interleave_granularity", "64B"));
+    UnitAlgebra rowSize(params.find<std::string>("row_size", "8KiB"));
+    std::string mapStr = params.find<std::string>("address_mapping", "row:col:rank:bank:channel");
+    bankXorHash = params.find<bool>("bank_xor_hash", false);
+    std::string policyStr = params.find<std::string>("row_policy", "open");
+    maxQueueDepth       = params.find<unsigned int>("max_queue_depth", 64);
+    writeHighWatermark  = params.find<unsigned int>("write_high_watermark", 32);
+    writeLowWatermark   = params.find<unsigned int>("write_low_watermark", 16);
+    starvationLimit     = params.find<unsigned int>("starvation_limit", 1000);
+    maxRowHits          = params.find<unsigned int>("max_row_hits", 16);
+    maxWriteAge         = params.find<unsigned int>("max_write_age", 2000);
+
+    // Check parameters
+    if (policyStr != "closed" && policyStr != "open") {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_policy - must be 'closed' or 'open'. You specified '%s'.\n", ctrl->getName().c_str(), policyStr.c_str());
+    }
+    policy = (policyStr == "closed") ? CLOSED : OPEN;
+
+    if (!isPowerOfTwo(channels))
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): channels - must be a power of two. You specified %u.\n", ctrl->getName().c_str(), channels);
+    if (!isPowerOfTwo(ranks))
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): ranks - must be a power of two. You specified %u.\n", ctrl->getName().c_str(), ranks);
+    if (!isPowerOfTwo(banks))
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): banks - must be a power of two. You specified %u.\n", ctrl->getName().c_str(), banks);
+
+    if (!(lineSize.hasUnits("B")) || !isPowerOfTwo(lineSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_interleave_granularity - must be a power of two and have units of 'B' (bytes). You specified %s.\n", ctrl->getName().c_str(), lineSize.toString().c_str());
+    }
+    if (!(rowSize.hasUnits("B")) || !isPowerOfTwo(rowSize.getRoundedValue()) || rowSize.getRoundedValue() < lineSize.getRoundedValue()) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must be a power of two, have units of 'B' (bytes) and be at least bank_interleave_granularity. You specified %s.\n", ctrl->getName().c_str(), rowSize.toString().c_str());
+    }
+    if (maxQueueDepth == 0)
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): max_queue_depth - must be at least 1.\n", ctrl->getName().c_str());
+    if (writeLowWatermark > writeHighWatermark)
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): write_low_watermark - must not be larger than write_high_watermark (%u). You specified %u.\n", ctrl->getName().c_str(), writeHighWatermark, writeLowWatermark);
+    if (maxRowHits == 0) maxRowHits = 1;
+
+    lineOffset = log2Of(lineSize.getRoundedValue());
+    unsigned int colBits = log2Of(rowSize.getRoundedValue()) - lineOffset;
+
+    // Parse address mapping. Fields are listed MSB first; store LSB first
+    std::vector<std::string> fields;
+    std::stringstream ss(mapStr);
+    std::string field;
+    while (std::getline(ss, field, ':')) fields.push_back(field);
+    bool seen[5] = {false, false, false, false, false};
+    for (int i = fields.size() - 1; i >= 0; i--) {
+        MapField f;
+        unsigned int bits;
+        if (fields[i] == "row")             { f = ROW;      bits = 0; }
+        else if (fields[i] == "rank")       { f = RANK;     bits = log2Of(ranks); }
+        else if (fields[i] == "bank")       { f = BANK;     bits = log2Of(banks); }
+        else if (fields[i] == "col")        { f = COL;      bits = colBits; }
+        else if (fields[i] == "channel")    { f = CHANNEL;  bits = log2Of(channels); }
+        else {
+            output->fatal(CALL_INFO, -1, "Invalid param(%s): address_mapping - unknown field '%s'. Fields are row, rank, bank, col, and channel.\n", ctrl->getName().c_str(), fields[i].c_str());
+            continue;
+        }
+        if (seen[f]) output->fatal(CALL_INFO, -1, "Invalid param(%s): address_mapping - field '%s' appears more than once. You specified '%s'.\n", ctrl->getName().c_str(), fields[i].c_str(), mapStr.c_str());
+        seen[f] = true;
+        if (f != ROW) mapping.push_back(std::make_pair(f, bits));
+    }
+    if (fields.size() != 5 || fields[0] != "row") {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): address_mapping - must list row, rank, bank, col, and channel once each, with row first. You specified '%s'.\n", ctrl->getName().c_str(), mapStr.c_str());
+    }
+
+    // Bookkeeping for bank/channel state
+    banksPerChannel = ranks * banks;
+    queuedRequests = 0;
+    bankState.resize(channels * banksPerChannel);
+    for (unsigned int i = 0; i < bankState.size(); i++) {
+        Bank &b = bankState[i];
+        b.openRow = -1;
+        b.readyAt = 0;
+        b.rowHitStreak = 0;
+        std::stringstream id;
+        id << i;
+        b.statRowHit        = registerStatistic<uint64_t>("row_hit", id.str());
+        b.statRowMiss       = registerStatistic<uint64_t>("row_miss", id.str());
+        b.statRowConflict   = registerStatistic<uint64_t>("row_conflict", id.str());
+        b.statQueueDepth    = registerStatistic<uint64_t>("queue_depth", id.str());
+    }
+    channelState.resize(channels);
+    for (unsigned int i = 0; i < channels; i++) {
+        Channel &c = channelState[i];
+        c.busFreeAt = 0;
+        c.lastWrite = false;
+        c.used = false;
+        c.draining = false;
+        c.reads = 0;
+        c.writes = 0;
+    }
+    // Stagger refresh across ranks
+    for (unsigned int i = 0; i < channels * ranks; i++) {
+        nextRefresh.push_back(tREFI == 0 ? 0 : tREFI + (tREFI / (channels * ranks)) * i);
+    }
+
+    // Self link for timing requests
+    self_link = ctrl->configureSelfLink("FRFCFSSelf", cycTime, new Event::Handler<FRFCFSDRAM>(this, &FRFCFSDRAM::handleSelfEvent));
+    cycleTC = ctrl->getTimeConverter(cycTime);
+
+    // Some statistics
+    statRefresh     = registerStatistic<uint64_t>("refreshes");
+    statWriteDrain  = registerStatistic<uint64_t>("write_drains");
+    statStarved     = registerStatistic<uint64_t>("starvation_overrides");
+    statWriteAged   = registerStatistic<uint64_t>("write_age_overrides");
+    statRejected    = registerStatistic<uint64_t>("requests_rejected");
+}
+
+
+/*
+ * Return response
+ */
+void FRFCFSDRAM::handleSelfEvent(SST::Event *event){
+    MemCtrlEvent *ev = static_cast<MemCtrlEvent*>(event);
+    ctrl->handleMemResponse(ev->req);
+    delete event;
+}
+
+
+void FRFCFSDRAM::decode(Addr addr, unsigned int &channel, unsigned int &bank, uint64_t &row) {
+    uint64_t a = addr >> lineOffset;
+    unsigned int rank = 0, bankInRank = 0;
+    channel = 0;
+    for (unsigned int i = 0; i < mapping.size(); i++) {
+        uint64_t value = a & ((1ULL << mapping[i].second) - 1);
+        a >>= mapping[i].second;
+        switch (mapping[i].first) {
+            case RANK:      rank = value; break;
+            case BANK:      bankInRank = value; break;
+            case CHANNEL:   channel = value; break;
+            default:        break;
+        }
+    }
+    row = a;
+    if (bankXorHash) bankInRank ^= (row & (banks - 1));
+    bank = (channel * ranks + rank) * banks + bankInRank;
+}
+
+
+bool FRFCFSDRAM::issueRequest(DRAMReq *req){
+    Addr addr = req->baseAddr_ + req->amtInProcess_;
+    unsigned int channel, bank;
+    uint64_t row;
+    decode(addr, channel, bank, row);
+
+    Channel &c = channelState[channel];
+    if (c.reads + c.writes >= maxQueueDepth) {
+        statRejected->addData(1);
+        return false;
+    }
+
+#ifdef __SST_DEBUG_OUTPUT__
+    ctrl->dbg.debug(_L10_, "FRFCFSDRAM (%s) received request for address %" PRIx64 " which maps to channel: %u, bank: %u, row: %" PRIu64 ". Bank queue depth %zu, open row is %" PRId64 "\n",
+            ctrl->getName().c_str(), addr, channel, bank, row, bankState[bank].queue.size(), bankState[bank].openRow);
+#endif
+
+    Entry entry;
+    entry.req = req;
+    entry.row = row;
+    entry.write = req->isWrite_;
+    entry.arrival = ctrl->getCurrentSimTime(cycleTC);
+    bankState[bank].statQueueDepth->addData(bankState[bank].queue.size());
+    bankState[bank].queue.push_back(entry);
+    if (entry.write) c.writes++;
+    else c.reads++;
+    queuedRequests++;
+    return true;
+}
+
+
+/* Apply any refreshes that are due. While the controller's clock is off, several may be due at once */
+void FRFCFSDRAM::refresh(SimTime_t now) {
+    if (tREFI == 0) return;
+    for (unsigned int r = 0; r < nextRefresh.size(); r++) {
+        if (now < nextRefresh[r]) continue;
+        SimTime_t last = nextRefresh[r];
+        while (nextRefresh[r] <= now) {
+            last = nextRefresh[r];
+            nextRefresh[r] += tREFI;
+            statRefresh->addData(1);
+        }
+        for (unsigned int b = r * banks; b < (r + 1) * banks; b++) {
+            Bank &bank = bankState[b];
+            bank.openRow = -1;
+            bank.rowHitStreak = 0;
+            bank.readyAt = std::max(bank.readyAt, last) + tRFC;
+        }
+    }
+}
+
+
+/* Pick and issue at most one request for a channel. Return whether one was issued */
+bool FRFCFSDRAM::schedule(unsigned int channel, SimTime_t now) {
+    Channel &c = channelState[channel];
+    if (c.reads + c.writes == 0) return false;
+
+    if (!c.draining && c.writes >= writeHighWatermark && writeHighWatermark > 0) {
+        c.draining = true;
+        statWriteDrain->addData(1);
+    } else if (c.draining && c.writes <= writeLowWatermark) {
+        c.draining = false;
+    }
+
+    // Find the oldest request and the oldest row hit among ready banks, for reads [0] and writes [1]
+    int oldestBank[2] = {-1, -1}, hitBank[2] = {-1, -1};
+    size_t oldestIndex[2] = {0, 0}, hitIndex[2] = {0, 0};
+    SimTime_t oldestArrival[2] = {0, 0}, hitArrival[2] = {0, 0};
+    for (unsigned int b = channel * banksPerChannel; b < (channel + 1) * banksPerChannel; b++) {
+        Bank &bank = bankState[b];
+        if (bank.queue.empty() || bank.readyAt > now) continue;
+        bool hitAllowed = bank.rowHitStreak < maxRowHits;
+        for (size_t i = 0; i < bank.queue.size(); i++) {
+            Entry &e = bank.queue[i];
+            int d = e.write ? 1 : 0;
+            if (oldestBank[d] == -1 || e.arrival < oldestArrival[d]) {
+                oldestBank[d] = b;
+                oldestIndex[d] = i;
+                oldestArrival[d] = e.arrival;
+            }
+            if (hitAllowed && (int64_t)e.row == bank.openRow && (hitBank[d] == -1 || e.arrival < hitArrival[d])) {
+                hitBank[d] = b;
+                hitIndex[d] = i;
+                hitArrival[d] = e.arrival;
+            }
+        }
+    }
+
+    // Outside drain mode reads go first, but a write that has waited max_write_age cycles
+    // is issued anyway so a steady read stream cannot hold writes below the watermark forever
+    bool wantWrite = c.draining || c.reads == 0;
+    if (!wantWrite && maxWriteAge > 0 && oldestBank[1] != -1 && now - oldestArrival[1] >= maxWriteAge) {
+        wantWrite = true;
+        statWriteAged->addData(1);
+    }
+    int d = wantWrite ? 1 : 0;
+    // If no bank with a request in the preferred direction is ready, issue in the other
+    // direction rather than leave the data bus idle
+    if (oldestBank[d] == -1) d = 1 - d;
+    if (oldestBank[d] == -1) return false;
+
+    int b = oldestBank[d];
+    size_t index = oldestIndex[d];
+    if (now - oldestArrival[d] >= starvationLimit) {
+        if (hitBank[d] != -1 && (hitBank[d] != oldestBank[d] || hitIndex[d] != oldestIndex[d])) statStarved->addData(1);
+    } else if (hitBank[d] != -1) {
+        b = hitBank[d];
+        index = hitIndex[d];
+    }
+
+    Bank &bank = bankState[b];
+    Entry e = bank.queue[index];
+    bank.queue.erase(bank.queue.begin() + index);
+    if (e.write) c.writes--;
+    else c.reads--;
+    queuedRequests--;
+
+    SimTime_t latency = tCAS;
+    if (bank.openRow == (int64_t)e.row) {
+        bank.rowHitStreak++;
+        bank.statRowHit->addData(1);
+    } else {
+        latency += tRCD;
+        if (bank.openRow != -1) {
+            latency += tRP;
+            bank.statRowConflict->addData(1);
+        } else {
+            bank.statRowMiss->addData(1);
+        }
+        bank.rowHitStreak = 0;
+    }
+    if (c.used && c.lastWrite != e.write) latency += e.write ? tRTW : tWTR;
+
+    SimTime_t dataStart = std::max(now + latency, c.busFreeAt);
+    SimTime_t done = dataStart + tBURST;
+    c.busFreeAt = done;
+    c.lastWrite = e.write;
+    c.used = true;
+
+    if (policy == CLOSED) {
+        bank.openRow = -1;
+        bank.readyAt = done + tRP;
+    } else {
+        bank.openRow = e.row;
+        bank.readyAt = dataStart;
+    }
+
+#ifdef __SST_DEBUG_OUTPUT__
+    ctrl->dbg.debug(_L10_, "FRFCFSDRAM (%s) issuing %s for address %" PRIx64 " to bank %d, completes in %" PRIu64 " cycles\n",
+            ctrl->getName().c_str(), e.write ? "write" : "read", e.req->baseAddr_ + e.req->amtInProcess_, b, done - now);
+#endif
+    self_link->send(done - now, new MemCtrlEvent(e.req));
+    return true;
+}
+
+
+void FRFCFSDRAM::clock() {
+    SimTime_t now = ctrl->getCurrentSimTime(cycleTC);
+    refresh(now);
+    if (queuedRequests == 0) return;
+    for (unsigned int i = 0; i < channels; i++) schedule(i, now);
+}
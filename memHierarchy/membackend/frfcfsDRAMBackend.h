@@ -0,0 +1,135 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_FRFCFS_DRAM_BACKEND
+#define _H_SST_MEMH_FRFCFS_DRAM_BACKEND
+
+#include <deque>
+#include <vector>
+
+#include "membackend/memBackend.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+class FRFCFSDRAM : public MemBackend {
+public:
+    FRFCFSDRAM();
+    FRFCFSDRAM(Component *comp, Params &params);
+    bool issueRequest(DRAMReq *req);
+    void clock();
+    bool isClockIdle() { return queuedRequests == 0; }
+
+    typedef enum {OPEN, CLOSED} RowPolicy;
+    typedef enum {ROW, RANK, BANK, COL, CHANNEL} MapField;
+
+private:
+    /* A request waiting in a bank queue */
+    struct Entry {
+        DRAMReq *   req;
+        uint64_t    row;
+        bool        write;
+        SimTime_t   arrival;
+    };
+
+    struct Bank {
+        std::deque<Entry>   queue;
+        int64_t             openRow;        // -1 if no row open
+        SimTime_t           readyAt;        // Cycle the bank can accept its next command
+        unsigned int        rowHitStreak;   // Consecutive row hits issued to the open row
+        Statistic<uint64_t> * statRowHit;
+        Statistic<uint64_t> * statRowMiss;
+        Statistic<uint64_t> * statRowConflict;
+        Statistic<uint64_t> * statQueueDepth;
+    };
+
+    struct Channel {
+        SimTime_t           busFreeAt;      // Cycle the data bus is next free
+        bool                lastWrite;      // Direction of the last transfer, for turnaround
+        bool                used;           // Whether anything has been issued yet
+        bool                draining;       // Write drain mode
+        unsigned int        reads;
+        unsigned int        writes;
+    };
+
+    void handleSelfEvent(SST::Event *event);
+    void decode(Addr addr, unsigned int &channel, unsigned int &bank, uint64_t &row);
+    void refresh(SimTime_t now);
+    bool schedule(unsigned int channel, SimTime_t now);
+
+    Link *self_link;
+    TimeConverter * cycleTC;
+
+    std::vector<Bank>       bankState;      // Indexed by (channel * ranks + rank) * banks + bank
+    std::vector<Channel>    channelState;
+    std::vector<SimTime_t>  nextRefresh;    // Per rank (channel * ranks + rank)
+    unsigned int            queuedRequests;
+
+    // Organization
+    unsigned int channels;
+    unsigned int ranks;
+    unsigned int banks;
+    unsigned int banksPerChannel;
+
+    // Mapping parameters
+    unsigned int lineOffset;
+    std::vector<std::pair<MapField, unsigned int> > mapping;   // Fields from least to most significant (above the line offset), and their widths
+    bool bankXorHash;
+
+    // Time parameters (cycles)
+    unsigned int tCAS;
+    unsigned int tRCD;
+    unsigned int tRP;
+    unsigned int tBURST;
+    unsigned int tWTR;
+    unsigned int tRTW;
+    unsigned int tREFI;
+    unsigned int tRFC;
+
+    // Scheduling parameters
+    RowPolicy policy;
+    unsigned int maxQueueDepth;     // Per channel
+    unsigned int writeHighWatermark;
+    unsigned int writeLowWatermark;
+    unsigned int starvationLimit;
+    unsigned int maxRowHits;
+    unsigned int maxWriteAge;
+
+    Statistic<uint64_t> * statRefresh;
+    Statistic<uint64_t> * statWriteDrain;
+    Statistic<uint64_t> * statStarved;
+    Statistic<uint64_t> * statWriteAged;
+    Statistic<uint64_t> * statRejected;
+
+public:
+    class MemCtrlEvent : public SST::Event {
+    public:
+        MemCtrlEvent(DRAMReq* req) : SST::Event(), req(req) { }
+
+        DRAMReq *req;
+    private:
+        MemCtrlEvent() {} // For Serialization only
+
+    public:
+        void serialize_order(SST::Core::Serialization::serializer &ser) {
+            Event::serialize_order(ser);
+            ser & req;  // Cannot serialize pointers unless they are a serializable object
+        }
+        ImplementSerializable(SST::MemHierarchy::FRFCFSDRAM::MemCtrlEvent);
+    };
+
+};
+
+}
+}
+
+#endif
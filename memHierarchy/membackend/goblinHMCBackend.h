@@ -53,6 +53,7 @@ public:
 	void setup();
 	void finish();
 	void clock();
+	bool isClockIdle() { return false; }	// HMC-Sim must be ticked every cycle
 
 private:
 	Component* owner;
@@ -35,6 +35,7 @@ public:
     HybridSimMemory(Component *comp, Params &params);
     bool issueRequest(DRAMReq *req);
     void clock();
+    bool isClockIdle() { return false; }   // External simulator must be ticked every cycle
     void finish();
 private:
     void hybridSimDone(unsigned int id, uint64_t addr, uint64_t clockcycle);
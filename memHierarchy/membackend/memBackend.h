@@ -53,6 +53,9 @@ public:
     virtual void setup() {}
     virtual void finish() {}
     virtual void clock() {}
+    /** Return true if clock() has no work to do until the next request arrives. 
+     *  MemController turns its clock off when the backend is idle. */
+    virtual bool isClockIdle() { return true; }
 protected:
     MemController *ctrl;
     Output* output;
@@ -142,6 +142,14 @@ void RequestReorderRow::clock() {
 }
 
 
+bool RequestReorderRow::isClockIdle() {
+    for (unsigned int i = 0; i < banks; i++) {
+        if (!requestQueue[i]->empty()) return false;
+    }
+    return backend->isClockIdle();
+}
+
+
 /*
  * Call throughs to our backend
  */
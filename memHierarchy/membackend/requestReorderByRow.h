@@ -28,6 +28,7 @@ public:
     void setup();
     void finish();
     void clock();
+    bool isClockIdle();
 
 private:
     MemBackend* backend;
@@ -27,6 +27,7 @@ public:
     void setup();
     void finish();
     void clock();
+    bool isClockIdle() { return requestQueue.empty() && backend->isClockIdle(); }
 
 private:
     MemBackend* backend;
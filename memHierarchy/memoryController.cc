@@ -213,6 +213,10 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id) {
     stat_GetXReqReceived    = registerStatistic<uint64_t>("requests_received_GetX");
     stat_PutMReqReceived    = registerStatistic<uint64_t>("requests_received_PutM");
     stat_outstandingReqs    = registerStatistic<uint64_t>("outstanding_requests");
+    stat_eventPoolHits      = registerStatistic<uint64_t>("MemEventPool_hits");
+    stat_eventPoolMisses    = registerStatistic<uint64_t>("MemEventPool_misses");
+    eventPoolHits_          = 0;
+    eventPoolMisses_        = 0;
 
     cyclesWithIssue = registerStatistic<uint64_t>( "cycles_with_issue" );
     cyclesAttemptIssueButRejected = registerStatistic<uint64_t>(
@@ -220,13 +224,19 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id) {
     totalCycles     = registerStatistic<uint64_t>( "total_cycles" );
 
     /* Clock Handler */
-    registerClock(clock_freq, new Clock::Handler<MemController>(this, &MemController::clock));
+    clockHandler_ = new Clock::Handler<MemController>(this, &MemController::clock);
+    clockTimeBase_ = registerClock(clock_freq, clockHandler_);
+    clockOn_ = true;
+    lastActiveClockCycle_ = 0;
     registerTimeBase("1 ns", true);
 }
 
 
 
 void MemController::handleEvent(SST::Event* event) {
+    MemEventPool::StatScope poolScope(eventPoolHits_, eventPoolMisses_);
+    if (!clockOn_) turnClockOn();
+
     MemEvent *ev = static_cast<MemEvent*>(event);
 #ifdef __SST_DEBUG_OUTPUT__
     dbg.debug(_L10_,"\n\n----------------------------------------------------------------------------------------\n");
@@ -299,6 +309,7 @@ void MemController::addRequest(MemEvent* ev) {
 
 
 bool MemController::clock(Cycle_t cycle) {
+    MemEventPool::StatScope poolScope(eventPoolHits_, eventPoolMisses_);
     totalCycles->addData(1);
     if (networkLink_) networkLink_->clock();
 
@@ -334,10 +345,31 @@ bool MemController::clock(Cycle_t cycle) {
     
     backend_->clock();
 
+    /* Turn clock off if there is nothing to issue and nothing the NIC or backend needs the clock for. 
+     * Check after clocking the backend, since responses it returns during clock() are queued at the NIC.
+     * Later responses from the backend turn it back on. */
+    bool nicIdle = !networkLink_ || networkLink_->isIdle();
+    if (requestQueue_.empty() && nicIdle && backend_->isClockIdle()) {
+        clockOn_ = false;
+        lastActiveClockCycle_ = cycle;
+        return true;
+    }
     return false;
 }
 
 
+/* Reregister the clock and fill in per-cycle statistics for the cycles it was off */
+void MemController::turnClockOn() {
+    Cycle_t cycle = reregisterClock(clockTimeBase_, clockHandler_);
+    cycle--; // reregisterClock returns the next cycle the clock will fire, set to current cycle
+    for (Cycle_t i = lastActiveClockCycle_; i < cycle; i++) {
+        totalCycles->addData(1);
+        stat_outstandingReqs->addData(requestPool_.size());
+    }
+    clockOn_ = true;
+}
+
+
 
 void MemController::performRequest(DRAMReq* req) {
     bool noncacheable  = req->reqEvent_->queryFlag(MemEvent::F_NONCACHEABLE);
@@ -419,6 +451,9 @@ void MemController::printMemory(DRAMReq* req, Addr localAddr) {
 
 
 void MemController::handleMemResponse(DRAMReq* req) {
+    MemEventPool::StatScope poolScope(eventPoolHits_, eventPoolMisses_);
+    if (!clockOn_) turnClockOn();
+
     req->amtProcessed_ += requestSize_;
     if (req->amtProcessed_ >= req->size_) req->status_ = DRAMReq::RETURNED;
 
@@ -513,6 +548,9 @@ void MemController::finish(void) {
         fclose(traceFP);
     }
 
+    stat_eventPoolHits->addData(eventPoolHits_);
+    stat_eventPoolMisses->addData(eventPoolMisses_);
+
     backend_->finish();
     if (networkLink_) networkLink_->finish();
 }
@@ -56,6 +56,7 @@ private:
     void handleEvent(SST::Event* _event);
     void addRequest(MemEvent* _ev);
     bool clock(SST::Cycle_t _cycle);
+    void turnClockOn();
     void performRequest(DRAMReq* _req);
     void sendResponse(DRAMReq* _req);
     void printMemory(DRAMReq* _req, Addr _localAddr);
@@ -125,6 +126,16 @@ private:
     Statistic<uint64_t>* stat_GetSExReqReceived;
     Statistic<uint64_t>* stat_outstandingReqs;
 
+    /* Turn clock off when idle */
+    bool        clockOn_;
+    Clock::Handler<MemController>*  clockHandler_;
+    TimeConverter*                  clockTimeBase_;
+    Cycle_t     lastActiveClockCycle_;
+    Statistic<uint64_t>* stat_eventPoolHits;
+    Statistic<uint64_t>* stat_eventPoolMisses;
+    uint64_t    eventPoolHits_;     // MemEventPool hits/misses while handling this controller's events
+    uint64_t    eventPoolMisses_;
+
 
     Output::output_location_t statsOutputTarget_;
 //#ifdef HAVE_LIBZ
@@ -47,6 +47,109 @@ MSHR::MSHR(Output* debug, int maxSize, string cacheName, bool debugAll, Addr deb
 
     DEBUG_ALL = debugAll;
     DEBUG_ADDR = debugAddr;
+
+    /* Preallocate the entry pool and a table sized for ~50% occupancy at that pool size */
+    int poolSize = (maxSize > MSHR_POOL_PREALLOC_MAX) ? MSHR_POOL_PREALLOC_MAX : (maxSize < 1 ? 1 : maxSize);
+    pool_.resize(poolSize);
+    freeEntries_.reserve(poolSize);
+    for (int i = poolSize - 1; i >= 0; i--) {
+        pool_[i].mshrQueue.reserve(MSHR_QUEUE_RESERVE);
+        freeEntries_.push_back(i);
+    }
+    size_t tableSize = 8;
+    hashShift_ = 61;
+    while (tableSize < (size_t)(2 * poolSize)) {
+        tableSize <<= 1;
+        hashShift_--;
+    }
+    mshrSlot empty = {0, -1};
+    table_.assign(tableSize, empty);
+    liveEntries_ = 0;
+}
+
+/* Return the entry for an address or NULL if none */
+mshrEntry* MSHR::find(Addr baseAddr) {
+    size_t mask = table_.size() - 1;
+    for (size_t i = hashSlot(baseAddr); ; i = (i + 1) & mask) {
+        if (table_[i].entry == -1) return NULL;
+        if (table_[i].key == baseAddr) return &pool_[table_[i].entry];
+    }
+}
+
+/* Return the entry for an address, taking one from the pool if none exists */
+mshrEntry* MSHR::findOrCreate(Addr baseAddr) {
+    size_t mask = table_.size() - 1;
+    size_t i = hashSlot(baseAddr);
+    for ( ; table_[i].entry != -1; i = (i + 1) & mask) {
+        if (table_[i].key == baseAddr) return &pool_[table_[i].entry];
+    }
+    
+    if (2 * (liveEntries_ + 1) > table_.size()) {
+        growTable();
+        return findOrCreate(baseAddr);
+    }
+
+    if (freeEntries_.empty()) {
+        freeEntries_.push_back(pool_.size());
+        pool_.push_back(mshrEntry());
+        pool_.back().mshrQueue.reserve(MSHR_QUEUE_RESERVE);
+    }
+    int index = freeEntries_.back();
+    freeEntries_.pop_back();
+    table_[i].key = baseAddr;
+    table_[i].entry = index;
+    liveEntries_++;
+    return &pool_[index];
+}
+
+/* Return an address's entry to the pool. Uses backward-shift deletion so the table never needs tombstones */
+void MSHR::release(Addr baseAddr) {
+#ifdef __SST_DEBUG_OUTPUT__
+    if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_, "MSHR erasing 0x%" PRIx64 "\n", baseAddr);
+#endif
+    size_t mask = table_.size() - 1;
+    size_t i = hashSlot(baseAddr);
+    while (table_[i].key != baseAddr || table_[i].entry == -1) {
+        if (table_[i].entry == -1) return;
+        i = (i + 1) & mask;
+    }
+    
+    mshrEntry& entry = pool_[table_[i].entry];
+    entry.mshrQueue.clear();
+    entry.tempData.clear();
+    entry.acksNeeded = 0;
+    freeEntries_.push_back(table_[i].entry);
+    liveEntries_--;
+
+    size_t hole = i;
+    for (size_t j = (i + 1) & mask; table_[j].entry != -1; j = (j + 1) & mask) {
+        size_t home = hashSlot(table_[j].key);
+        // Move j into the hole unless its home lies cyclically in (hole, j]
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            table_[hole] = table_[j];
+            hole = j;
+        }
+    }
+    table_[hole].entry = -1;
+}
+
+void MSHR::releaseIfEmpty(Addr baseAddr, mshrEntry * entry) {
+    if (entry->acksNeeded == 0 && entry->tempData.empty() && entry->mshrQueue.empty()) release(baseAddr);
+}
+
+void MSHR::growTable() {
+    vector<mshrSlot> old;
+    old.swap(table_);
+    mshrSlot empty = {0, -1};
+    table_.assign(old.size() * 2, empty);
+    hashShift_--;
+    size_t mask = table_.size() - 1;
+    for (vector<mshrSlot>::iterator it = old.begin(); it != old.end(); it++) {
+        if (it->entry == -1) continue;
+        size_t i = hashSlot(it->key);
+        while (table_[i].entry != -1) i = (i + 1) & mask;
+        table_[i] = *it;
+    }
 }
 
 
@@ -65,110 +168,85 @@ bool MSHR::isFull() {
 }
 
 int MSHR::getAcksNeeded(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return 0;
-    return (it->second).acksNeeded;
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) return 0;
+    return entry->acksNeeded;
 }
 
 
 void MSHR::setAcksNeeded(Addr baseAddr, int acksNeeded) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
 #ifdef __SST_DEBUG_OUTPUT__
-        if (DEBUG_ALL || baseAddr == DEBUG_ADDR) d_->debug(_L6_, "Creating new MSHR holder for acks\n");
+    if (find(baseAddr) == NULL && (DEBUG_ALL || baseAddr == DEBUG_ADDR)) d_->debug(_L6_, "Creating new MSHR holder for acks\n");
 #endif
-        mshrEntry entry;
-        entry.acksNeeded = acksNeeded;
-        entry.tempData.clear();
-        map_[baseAddr] = entry;
-        return;
-    }
-    (it->second).acksNeeded = acksNeeded;
+    findOrCreate(baseAddr)->acksNeeded = acksNeeded;
 }
 
 void MSHR::incrementAcksNeeded(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
-        mshrEntry entry;
-        entry.acksNeeded = 1;
-        map_[baseAddr] = entry;
-    } else {
-        (it->second).acksNeeded++;
-    }
+    findOrCreate(baseAddr)->acksNeeded++;
 }
 
 void MSHR::decrementAcksNeeded(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return;
-    (it->second).acksNeeded--;
-    if (((it->second).acksNeeded == 0) && (it->second).tempData.empty() && (it->second).mshrQueue.empty()) {
-#ifdef __SST_DEBUG_OUTPUT__
-        if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_, "MSHR erasing 0x%" PRIx64 "\n", baseAddr);
-#endif
-        map_.erase(it);
-    }
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) return;
+    entry->acksNeeded--;
+    releaseIfEmpty(baseAddr, entry);
 }
 
 void MSHR::setTempData(Addr baseAddr, vector<uint8_t>& data) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: No pending request for response event. Addr = 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
-    (it->second).tempData = data;
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: No pending request for response event. Addr = 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
+    entry->tempData.assign(data.begin(), data.end());
 }
 
 vector<uint8_t> * MSHR::getTempData(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return NULL;
-    return &((it->second).tempData);
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) return NULL;
+    return &(entry->tempData);
 }
 
 void MSHR::clearTempData(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it != map_.end()) (it->second).tempData.clear();
-    if (((it->second).acksNeeded == 0) && (it->second).tempData.empty() && (it->second).mshrQueue.empty()) {
-#ifdef __SST_DEBUG_OUTPUT__
-        if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_, "MSHR erasing 0x%" PRIx64 "\n", baseAddr);
-#endif
-        map_.erase(it);
-    }
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) return;
+    entry->tempData.clear();
+    releaseIfEmpty(baseAddr, entry);
 }
 
 bool MSHR::exists(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return false;
-    vector<mshrType> * queue = &((it->second).mshrQueue);
-    vector<mshrType>::iterator frontEntry = queue->begin();
-    if (frontEntry == queue->end()) return false;
-    return (frontEntry->elem.type() == typeid(MemEvent*));
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL || entry->mshrQueue.empty()) return false;
+    return (entry->mshrQueue.front().elem.type() == typeid(MemEvent*));
 }
 
-bool MSHR::isHit(Addr baseAddr) { return (map_.find(baseAddr) != map_.end()) && (map_.find(baseAddr)->second.mshrQueue.size() > 0); }
+bool MSHR::isHit(Addr baseAddr) { 
+    mshrEntry * entry = find(baseAddr);
+    return (entry != NULL) && (entry->mshrQueue.size() > 0); 
+}
 
 bool MSHR::pendingWriteback(Addr baseAddr) {
-    mshrType entry = mshrType(baseAddr);
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return false;
+    mshrType element = mshrType(baseAddr);
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) return false;
 
-    vector<mshrType>& res = (it->second).mshrQueue;
-    vector<mshrType>::iterator itv = std::find_if(res.begin(), res.end(), MSHREntryCompare(&entry));
+    vector<mshrType>& res = entry->mshrQueue;
+    vector<mshrType>::iterator itv = std::find_if(res.begin(), res.end(), MSHREntryCompare(&element));
     return (itv != res.end());
 }
 
-const vector<mshrType> MSHR::lookup(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
+const vector<mshrType>& MSHR::lookup(Addr baseAddr) {
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: mshr did not find entry with address 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
-    vector<mshrType> res = (it->second).mshrQueue;
-    return res;
+    return entry->mshrQueue;
 }
 
 
 MemEvent* MSHR::lookupFront(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: mshr did not find entry with address 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
-    vector<mshrType> queue = (it->second).mshrQueue;
+    vector<mshrType>& queue = entry->mshrQueue;
     if (queue.front().elem.type() != typeid(MemEvent*)) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: front entry in mshr is not of type MemEvent. Addr = 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
@@ -197,7 +275,7 @@ bool MSHR::insert(Addr baseAddr, MemEvent* event) {
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == baseAddr)
         d_->debug(_L9_, "MSHR: Event Inserted. Key addr = %" PRIx64 ", event Addr = %" PRIx64 ", Cmd = %s, MSHR Size = %u, Entry Size = %lu\n", 
-                baseAddr, event->getAddr(), CommandString[event->getCmd()], size_, map_[baseAddr].mshrQueue.size());
+                baseAddr, event->getAddr(), CommandString[event->getCmd()], size_, find(baseAddr)->mshrQueue.size());
 #endif
     return true;
 }
@@ -218,18 +296,8 @@ bool MSHR::insertWriteback(Addr keyAddr) {
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == keyAddr) d_->debug(_L9_, "MSHR: Inserted writeback.  Key Addr = %" PRIx64 "\n", keyAddr);
 #endif
-    mshrType mshrElement = mshrType(keyAddr);
-
-    mshrTable::iterator it = map_.find(keyAddr);
-    if (it == map_.end()) {
-        mshrEntry newEntry;
-        newEntry.acksNeeded = 0;
-        newEntry.tempData.clear();
-        map_[keyAddr] = newEntry;
-    }
-
-    vector<mshrType>::iterator itv = map_[keyAddr].mshrQueue.begin();
-    map_[keyAddr].mshrQueue.insert(itv, mshrElement);
+    vector<mshrType>& queue = findOrCreate(keyAddr)->mshrQueue;
+    queue.insert(queue.begin(), mshrType(keyAddr));
     
     return true;
 }
@@ -239,7 +307,7 @@ bool MSHR::insertInv(Addr baseAddr, MemEvent* event, bool inProgress) {
 #ifdef __SST_DEBUG_OUTPUT__
     if (LIKELY(ret)) {
         if (DEBUG_ALL || DEBUG_ADDR == baseAddr)
-            d_->debug(_L9_, "MSHR: Event Inserted. Key addr = %" PRIx64 ", event Addr = %" PRIx64 ", Cmd = %s, MSHR Size = %u, Entry Size = %lu\n", baseAddr, event->getAddr(), CommandString[event->getCmd()], size_, map_[baseAddr].mshrQueue.size());
+            d_->debug(_L9_, "MSHR: Event Inserted. Key addr = %" PRIx64 ", event Addr = %" PRIx64 ", Cmd = %s, MSHR Size = %u, Entry Size = %lu\n", baseAddr, event->getAddr(), CommandString[event->getCmd()], size_, find(baseAddr)->mshrQueue.size());
      }
     else if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_, "MSHR Full.  Event could not be inserted.\n");
 #endif
@@ -248,16 +316,8 @@ bool MSHR::insertInv(Addr baseAddr, MemEvent* event, bool inProgress) {
 
 bool MSHR::insertAll(Addr baseAddr, vector<mshrType>& events) {
     if (events.empty()) return false;
-    mshrTable::iterator it = map_.find(baseAddr);
-    
-    if (it != map_.end()) (it->second).mshrQueue.insert((it->second).mshrQueue.end(), events.begin(), events.end());
-    else {
-        mshrEntry entry;
-        entry.mshrQueue = events;
-        entry.acksNeeded = 0;
-        entry.tempData.clear();
-        map_[baseAddr] = entry;
-    }
+    vector<mshrType>& queue = findOrCreate(baseAddr)->mshrQueue;
+    queue.insert(queue.end(), events.begin(), events.end());
     
     int trueSize = 0;
     int prefetches = 0;
@@ -277,35 +337,17 @@ bool MSHR::insertAll(Addr baseAddr, vector<mshrType>& events) {
 
 /* Private insertion methods called by public inserts */
 bool MSHR::insert(Addr baseAddr, mshrType entry) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
-        mshrEntry entry;
-        entry.acksNeeded = 0;
-        entry.tempData.clear();
-        map_[baseAddr] = entry;
-    }
-    map_[baseAddr].mshrQueue.push_back(entry);
-    
+    findOrCreate(baseAddr)->mshrQueue.push_back(entry);
     return true;
 }
 
 bool MSHR::insertInv(Addr baseAddr, mshrType entry, bool inProgress) {
     if (size_ >= maxSize_) return false;
     
-    vector<mshrType>::iterator it = map_[baseAddr].mshrQueue.begin();
-    /*int i = 0;
-    for (it = map_[baseAddr].mshrQueue.begin(); it != map_[baseAddr].mshrQueue.end(); it++) {
-        if (inProgress && it == map_[baseAddr].mshrQueue.begin()) continue;
-        if (it->elem.type() == typeid(MemEvent*)) {
-            MemEvent * ev = boost::get<MemEvent*>(it->elem);
-            if (ev->getCmd() == GetS || ev->getCmd() == GetSEx || ev->getCmd() == GetX) {
-                break;
-            }
-        }
-        i++;
-    }*/
-    if (inProgress && map_[baseAddr].mshrQueue.size() > 0) it++;
-    map_[baseAddr].mshrQueue.insert(it, entry);
+    vector<mshrType>& queue = findOrCreate(baseAddr)->mshrQueue;
+    vector<mshrType>::iterator it = queue.begin();
+    if (inProgress && queue.size() > 0) it++;
+    queue.insert(it, entry);
     if (entry.elem.type() == typeid(MemEvent*)) size_++;
     //printTable();
     return true;
@@ -317,14 +359,20 @@ bool MSHR::insertInv(Addr baseAddr, mshrType entry, bool inProgress) {
 
 
 
+/* Ties are broken by lowest address so the result does not depend on table layout */
 MemEvent* MSHR::getOldestRequest() const {
     MemEvent *ev = NULL;
-    for ( mshrTable::const_iterator it = map_.begin() ; it != map_.end() ; ++it ) {
-        for ( vector<mshrType>::const_iterator jt = (it->second).mshrQueue.begin() ; jt != (it->second).mshrQueue.end() ; jt++ ) {
+    Addr evAddr = 0;
+    for ( vector<mshrSlot>::const_iterator it = table_.begin() ; it != table_.end() ; ++it ) {
+        if ( it->entry == -1 ) continue;
+        const vector<mshrType>& queue = pool_[it->entry].mshrQueue;
+        for ( vector<mshrType>::const_iterator jt = queue.begin() ; jt != queue.end() ; jt++ ) {
             if ( jt->elem.type() == typeid(MemEvent*) ) {
                 MemEvent *me = boost::get<MemEvent*>(jt->elem);
-                if ( !ev || ( me->getInitializationTime() < ev->getInitializationTime() ) ) {
+                if ( !ev || ( me->getInitializationTime() < ev->getInitializationTime() ) || 
+                        ( me->getInitializationTime() == ev->getInitializationTime() && it->key < evAddr ) ) {
                     ev = me;
+                    evAddr = it->key;
                 }
             }
         }
@@ -335,19 +383,14 @@ MemEvent* MSHR::getOldestRequest() const {
 
 
 vector<mshrType> MSHR::removeAll(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: mshr did not find entry with address 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
-    vector<mshrType> res = (it->second).mshrQueue;
-    if ((it->second).acksNeeded == 0 && (it->second).tempData.empty()) {
-#ifdef __SST_DEBUG_OUTPUT__
-        if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_, "MSHR erasing 0x%" PRIx64 "\n", baseAddr);
-#endif
-        map_.erase(it);
-    } else {
-        (it->second).mshrQueue.clear();
-    }
+    vector<mshrType> res = entry->mshrQueue;
+    entry->mshrQueue.clear();
+    releaseIfEmpty(baseAddr, entry);
+
     int trueSize = 0;
     int prefetches = 0;
     for (vector<mshrType>::iterator it = res.begin(); it != res.end(); it++) {
@@ -367,29 +410,17 @@ vector<mshrType> MSHR::removeAll(Addr baseAddr) {
 }
 
 MemEvent* MSHR::removeFront(Addr baseAddr) {
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) {
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) {
         d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: mshr did not find entry with address 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
     }
-    //if (it->second.empty()) {
-    //  d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: no front entry to remove in mshr for addr = 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
-    //}
-    //
-    // if (it->second.front().elem.type() != typeid(MemEvent*)) {
-    //     d2_->fatal(CALL_INFO,-1, "%s (MSHR), Error: front entry in mshr is not of type MemEvent. Addr = 0x%" PRIx64 "\n", ownerName_.c_str(), baseAddr);
-    // }
     
-    MemEvent* ret = boost::get<MemEvent*>((it->second).mshrQueue.front().elem);
+    MemEvent* ret = boost::get<MemEvent*>(entry->mshrQueue.front().elem);
     
     if (ret->isPrefetch()) prefetchCount_--;
     
-    (it->second).mshrQueue.erase(it->second.mshrQueue.begin());
-    if (((it->second).acksNeeded == 0) && (it->second).tempData.empty() && (it->second).mshrQueue.empty()) {
-#ifdef __SST_DEBUG_OUTPUT__
-        if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_, "MSHR erasing 0x%" PRIx64 "\n", baseAddr);
-#endif
-        map_.erase(it);
-    }
+    entry->mshrQueue.erase(entry->mshrQueue.begin());
+    releaseIfEmpty(baseAddr, entry);
     
     size_--;
     
@@ -418,25 +449,20 @@ void MSHR::removeElement(Addr baseAddr, Addr pointer) {
     removeElement(baseAddr, mshrType(pointer));
 }
 
-bool MSHR::removeElement(Addr baseAddr, mshrType entry) {
+bool MSHR::removeElement(Addr baseAddr, mshrType element) {
 
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return false;    
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) return false;    
 #ifdef __SST_DEBUG_OUTPUT__
-    if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_,"MSHR Entry size = %lu\n", it->second.mshrQueue.size());
+    if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_,"MSHR Entry size = %lu\n", entry->mshrQueue.size());
 #endif
-    vector<mshrType>& res = (it->second).mshrQueue;
-    vector<mshrType>::iterator itv = std::find_if(res.begin(), res.end(), MSHREntryCompare(&entry));
+    vector<mshrType>& res = entry->mshrQueue;
+    vector<mshrType>::iterator itv = std::find_if(res.begin(), res.end(), MSHREntryCompare(&element));
     
     if (itv == res.end()) return false;
-    res.erase(std::remove_if(res.begin(), res.end(), MSHREntryCompare(&entry)), res.end());
+    res.erase(std::remove_if(itv, res.end(), MSHREntryCompare(&element)), res.end());
 
-    if (((it->second).acksNeeded == 0) && (it->second).tempData.empty() && (it->second).mshrQueue.empty()) {
-#ifdef __SST_DEBUG_OUTPUT__
-        if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_, "MSHR erasing 0x%" PRIx64 "\n", baseAddr);
-#endif
-        map_.erase(it);
-    }
+    releaseIfEmpty(baseAddr, entry);
     
 #ifdef __SST_DEBUG_OUTPUT__
     if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_, "MSHR Removed Event\n");
@@ -450,15 +476,15 @@ void MSHR::removeWriteback(Addr baseAddr) {
 }
 
 bool MSHR::elementIsHit(Addr baseAddr, MemEvent *event) {
-    mshrType entry = mshrType(event);
+    mshrType element = mshrType(event);
 
-    mshrTable::iterator it = map_.find(baseAddr);
-    if (it == map_.end()) return false;    
+    mshrEntry * entry = find(baseAddr);
+    if (entry == NULL) return false;    
 #ifdef __SST_DEBUG_OUTPUT__
-    if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_,"MSHR Entry size = %lu\n", it->second.mshrQueue.size());
+    if (DEBUG_ALL || DEBUG_ADDR == baseAddr) d_->debug(_L9_,"MSHR Entry size = %lu\n", entry->mshrQueue.size());
 #endif
-    vector<mshrType>& res = (it->second).mshrQueue;
-    vector<mshrType>::iterator itv = std::find_if (res.begin(), res.end(), MSHREntryCompare(&entry));
+    vector<mshrType>& res = entry->mshrQueue;
+    vector<mshrType>::iterator itv = std::find_if (res.begin(), res.end(), MSHREntryCompare(&element));
     
     if (itv == res.end()) return false;
     return true;
@@ -466,9 +492,10 @@ bool MSHR::elementIsHit(Addr baseAddr, MemEvent *event) {
 
 
 void MSHR::printTable() {
-    for (mshrTable::iterator it = map_.begin(); it != map_.end(); it++) {
-        vector<mshrType> entries = (it->second).mshrQueue;
-        d_->debug(_L9_, "MSHR: Addr = 0x%" PRIx64 "\n", (it->first));
+    for (vector<mshrSlot>::iterator it = table_.begin(); it != table_.end(); it++) {
+        if (it->entry == -1) continue;
+        vector<mshrType>& entries = pool_[it->entry].mshrQueue;
+        d_->debug(_L9_, "MSHR: Addr = 0x%" PRIx64 "\n", it->key);
         for (vector<mshrType>::iterator it2 = entries.begin(); it2 != entries.end(); it2++) {
             if (it2->elem.type() != typeid(MemEvent*)) {
                 Addr ptr = boost::get<Addr>(it2->elem);
@@ -13,7 +13,7 @@
 #define _MSHR_H_
 
 #include <boost/assert.hpp>
-#include <map>
+#include <deque>
 
 #include <sst/core/event.h>
 #include <sst/core/sst_types.h>
@@ -40,16 +40,24 @@ struct mshrType {
 
 /* An MSHR entry has a vector of mshrTypes (events & pointers) along with some bookkeeping for outstanding requests 
  * If we were just doing inclusive caches, the bookkeeping could also be kept with the cache state
+ * Entries are pooled and reused, so the vectors keep their capacity from one address to the next
  */
 struct mshrEntry {
     vector<mshrType> mshrQueue; // Events and pointers to events for this address
     uint32_t        acksNeeded; // Acks needed for request at top of queue. Here instead of at cacheline for non-inclusive caches
     vector<uint8_t> tempData;   // Temporary holding place for response data during replay of request events (for non-inclusive caches)
+    mshrEntry() : acksNeeded(0) {}
 };
 
-typedef map<Addr, mshrEntry >   mshrTable;
+/* Slot in the open-addressed address -> entry table. entry == -1 means empty */
+struct mshrSlot {
+    Addr    key;
+    int     entry;
+};
 
 #define HUGE_MSHR 100000
+#define MSHR_POOL_PREALLOC_MAX 256  // Cap on entries preallocated up front (e.g., for HUGE_MSHR); the pool grows past this on demand
+#define MSHR_QUEUE_RESERVE 4        // Queue slots reserved per pooled entry
 
 /**
  *  Implements an MSHR with entries of type mshrEntry
@@ -72,7 +80,7 @@ public:
     vector<mshrType> removeAll(Addr);                       
     void removeWriteback(Addr baseAddr);
 
-    const vector<mshrType> lookup(Addr baseAddr);           
+    const vector<mshrType>& lookup(Addr baseAddr);         
     bool isHit(Addr baseAddr);                              
     bool elementIsHit(Addr baseAddr, MemEvent *event);
     bool isFull();                                          // external
@@ -106,7 +114,20 @@ public:
     void printTable();
 
 private:
-    mshrTable map_;
+    /* Address table & entry pool */
+    mshrEntry* find(Addr baseAddr);
+    mshrEntry* findOrCreate(Addr baseAddr);
+    void release(Addr baseAddr);
+    void releaseIfEmpty(Addr baseAddr, mshrEntry * entry);
+    void growTable();
+    inline size_t hashSlot(Addr baseAddr) const { return (size_t)((baseAddr * 0x9E3779B97F4A7C15ULL) >> hashShift_); }
+
+    vector<mshrSlot> table_;        // Open-addressed (linear probing) map from address to pool index
+    unsigned int hashShift_;        // 64 - log2(table_.size())
+    deque<mshrEntry> pool_;         // Entry storage; deque so pointers handed out (getTempData) stay valid as the pool grows
+    vector<int> freeEntries_;       // Unused pool indices
+    unsigned int liveEntries_;      // Addresses currently in the table
+
     Output* d_;
     Output* d2_;
     int size_;
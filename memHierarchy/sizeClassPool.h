@@ -0,0 +1,137 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_SIZECLASSPOOL_H
+#define MEMHIERARCHY_SIZECLASSPOOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ *  Recycling allocator for small, frequently created objects such as events.
+ *  Storage is kept on per-thread free lists, one per 16-byte size class; each
+ *  Family (usually the pooled base class) gets its own lists. Free lists hold
+ *  at most MaxFreePerClass objects; anything beyond goes back to the heap.
+ *  Hits/misses are counted per thread. Use drainStats() or a StatScope to
+ *  attribute them to a component.
+ */
+template<typename Family, size_t MaxFreePerClass>
+class SizeClassPool {
+    struct PoolState;
+public:
+    /** Allocate storage for an object of 'size' bytes */
+    static void* allocate(size_t size) {
+        size_t sc = sizeClass(size);
+        PoolState &s = state();
+        if (sc < NUM_CLASSES && s.heads[sc] != NULL) {
+            FreeNode * node = s.heads[sc];
+            s.heads[sc] = node->next;
+            s.counts[sc]--;
+            s.hits++;
+            return node;
+        }
+        s.misses++;
+        return ::operator new(sc < NUM_CLASSES ? (sc + 1) * CLASS_BYTES : size);
+    }
+
+    /** Return storage previously obtained from allocate() */
+    static void release(void * ptr, size_t size) {
+        if (ptr == NULL) return;
+        size_t sc = sizeClass(size);
+        PoolState &s = state();
+        if (sc >= NUM_CLASSES || s.counts[sc] >= MaxFreePerClass) {
+            ::operator delete(ptr);
+            return;
+        }
+        FreeNode * node = static_cast<FreeNode*>(ptr);
+        node->next = s.heads[sc];
+        s.heads[sc] = node;
+        s.counts[sc]++;
+    }
+
+    /** Return hits/misses on this thread since the last call, and reset them */
+    static void drainStats(uint64_t &hits, uint64_t &misses) {
+        PoolState &s = state();
+        hits = s.hits;
+        misses = s.misses;
+        s.hits = 0;
+        s.misses = 0;
+    }
+
+    /** Adds the hits/misses made on this thread while it is in scope to a
+     *  component's counters. Scopes nest; counts go to the innermost one
+     *  and counts made outside any scope are dropped */
+    class StatScope {
+    public:
+        StatScope(uint64_t &hits, uint64_t &misses) : hits_(hits), misses_(misses) {
+            PoolState &s = state();
+            chargePending(s);
+            outer_ = s.scope;
+            s.scope = this;
+        }
+        ~StatScope() {
+            PoolState &s = state();
+            chargePending(s);
+            s.scope = outer_;
+        }
+    private:
+        StatScope(const StatScope&);
+        void operator=(const StatScope&);
+
+        static void chargePending(PoolState &s) {
+            if (s.scope != NULL) {
+                s.scope->hits_ += s.hits;
+                s.scope->misses_ += s.misses;
+            }
+            s.hits = 0;
+            s.misses = 0;
+        }
+
+        uint64_t &  hits_;
+        uint64_t &  misses_;
+        StatScope * outer_;
+    };
+
+protected:
+    static void countHit() { state().hits++; }
+    static void countMiss() { state().misses++; }
+
+private:
+    static const size_t CLASS_BYTES = 16;
+    static const size_t NUM_CLASSES = 32;           // Objects up to 512 bytes are pooled
+
+    struct FreeNode {
+        FreeNode * next;
+    };
+
+    /* Plain-old-data so it can live in thread-local storage */
+    struct PoolState {
+        FreeNode *  heads[NUM_CLASSES];
+        size_t      counts[NUM_CLASSES];
+        uint64_t    hits;
+        uint64_t    misses;
+        StatScope * scope;
+    };
+
+    static size_t sizeClass(size_t size) { return (size - 1) / CLASS_BYTES; }
+
+    static PoolState& state() {
+        static __thread PoolState s;
+        return s;
+    }
+};
+
+}}
+
+#endif
@@ -214,6 +214,8 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
     
     progress_vcs = new int[num_ports];
 
+    std::string credit_window = params.find<std::string>("credit_coalescing_window", "0ns");
+
     std::string inspector_config = params.find<std::string>("network_inspectors", "");
     split(inspector_config,",",inspector_names);
 
@@ -241,6 +243,7 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
                                    1, getLogicalGroupParam(params,topo,i,"output_latency","0ns"),
                                    getLogicalGroupParam(params,topo,i,"input_buf_size"),
                                    getLogicalGroupParam(params,topo,i,"output_buf_size"),
+                                   credit_window,
                                    inspector_names);
         
     }
@@ -378,14 +381,11 @@ hr_router::clock_handler(Cycle_t cycle)
 #endif
     }
     // Loop through all the events at the heads of the queues and call
-    // route
-    int index = 0;
-    for ( int i = 0; i < num_ports; i++ ) {
-        for ( int j = 0; j < num_vcs; j++ ) {
-            if ( vc_heads[index] != NULL ) {
-                topo->reroute(i,j,vc_heads[index]);
-            }
-            index++;
+    // route.  Only the occupied VCs are visited.
+    for ( int i = vc_ready.nextPort(0); i != -1; i = vc_ready.nextPort(i+1) ) {
+        internal_router_event** port_heads = &vc_heads[i*num_vcs];
+        for ( int j = vc_ready.nextVC(i,0); j != -1; j = vc_ready.nextVC(i,j+1) ) {
+            topo->reroute(i,j,port_heads[j]);
         }
     }
     
@@ -585,6 +585,7 @@ hr_router::init_vcs()
     //     out_buf_sizes[i] = output_buf_size;
     // }
 
+    vc_ready.init(num_ports,num_vcs);
     vc_heads = new internal_router_event*[num_ports*num_vcs];
     xbar_in_credits = new int[num_ports*num_vcs];
     for ( int i = 0; i < num_ports*num_vcs; i++ ) {
@@ -600,6 +601,7 @@ hr_router::init_vcs()
 
     // Now that we have the number of VCs we can finish initializing
     // arbitration logic
+    arb->setReadyMap(&vc_ready);
     arb->setPorts(num_ports,num_vcs);
 
     vcs_initialized = true;
@@ -18,6 +18,7 @@
 #include <sst/core/link.h>
 #include <sst/core/timeConverter.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "sst/elements/merlin/router.h"
@@ -36,10 +37,25 @@ private:
     int rr_port_shadow;
 #endif
 
-    typedef std::pair<uint16_t,uint16_t> priority_entry_t;
-    priority_entry_t* priority[2];
-    priority_entry_t* cur_list;
-    priority_entry_t* next_list;
+    // LRU order is kept as a stamp per (port,vc): a lower stamp means
+    // a higher priority.  Satisfied entries are given new stamps above
+    // all others, with the first one satisfied getting the highest,
+    // which is the order the old priority lists produced.  This way
+    // only the VCs that have an event are touched each cycle.
+    std::vector<uint64_t> stamps;
+    uint64_t next_stamp;
+    std::vector<int> candidates;
+    std::vector<int> satisfied;
+
+    class stamp_order {
+    public:
+        stamp_order(const uint64_t* stamps) : stamps(stamps) {}
+        inline bool operator()(int lhs, int rhs) const {
+            return stamps[lhs] < stamps[rhs];
+        }
+    private:
+        const uint64_t* stamps;
+    };
     
     int total_entries;
     
@@ -62,19 +78,14 @@ public:
 
         total_entries = num_ports * num_vcs;
 
-        priority[0] = new priority_entry_t[total_entries];
-        priority[1] = new priority_entry_t[total_entries];
-        cur_list = priority[0];
-        next_list = priority[1];
-        
-        int index = 0;
-        for ( int i = 0; i < num_ports; i++ ) {
-            for ( int j = 0; j < num_vcs; j++ ) {
-                cur_list[index++] = priority_entry_t(i,j);
-            }
+        stamps.resize(total_entries);
+        for ( int i = 0; i < total_entries; i++ ) {
+            stamps[i] = i;
         }
+        next_stamp = total_entries;
+        candidates.reserve(total_entries);
+        satisfied.reserve(total_entries);
 
-        
         vc_heads = new internal_router_event*[num_vcs];
     }
     
@@ -89,80 +100,48 @@ public:
 #endif
                    )
     {
-        // TraceFunction trace(CALL_INFO_LONG);
-        
         for ( int i = 0; i < num_ports; i++ ) progress_vc[i] = -1;
-        
-
-        priority_entry_t* sat_list = &next_list[total_entries-1];
-        priority_entry_t* unsat_list = next_list;
-        
-        for ( int i = 0; i < total_entries; i++ ) {
-                    
-            const priority_entry_t& check = cur_list[i];
 
-            /* std::cout << check.first << ", " << check.second << std::endl; */
-            
-            int port = check.first;
-            int vc = check.second;
+        // Collect the VCs that have an event and put them in LRU order
+        candidates.clear();
+        for ( int port = ready->nextPort(0); port != -1; port = ready->nextPort(port+1) ) {
+            for ( int vc = ready->nextVC(port,0); vc != -1; vc = ready->nextVC(port,vc+1) ) {
+                candidates.push_back(port * num_vcs + vc);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), stamp_order(&stamps[0]));
 
-            // std::cout << check.first << ", " << check.second << std::endl;
+        satisfied.clear();
+        for ( size_t i = 0; i < candidates.size(); i++ ) {
+            int port = candidates[i] / num_vcs;
+            int vc = candidates[i] % num_vcs;
             
             vc_heads = ports[port]->getVCHeads();
-            
             internal_router_event* src_event = vc_heads[vc];
 
-            // trace.getOutput().output("Got to here 1\n");
-            
-            // If there's an event, see if we can progress it
-            if ( src_event != NULL) {
-                int next_port = src_event->getNextPort();
-                int next_vc = src_event->getVC();
+            int next_port = src_event->getNextPort();
+            int next_vc = src_event->getVC();
             
-                // Move the packet as long as there is space in the output buffer
-                if ( ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) {
-
-                    // We just go ahead and do the move.  The
-                    // progress_vc vector will be set to all -1's so
-                    // hr_router won't try to progress anything.
-                    // trace.getOutput().output("Got to here 2\n");
-                    internal_router_event* ev = ports[port]->recv(vc);
-                    // trace.getOutput().output("%p\n",ev);
-                    ports[ev->getNextPort()]->send(ev,ev->getVC());
-                    // trace.getOutput().output("Got to here 3\n");
-                    
-                    
-                    // Copy data to new list.  This goes at the bottom since it was satisfied
-                    *sat_list = check;
-                    --sat_list;
-                }
-                else {
-                    // Not satisfied, put at the top of the next list
-                    *unsat_list = check;
-                    ++unsat_list;
-                }
-            }
-            else {
-                // std::cout << "putting at top of list" << std::endl;
-                // next_list[unsat_index++] = check;
-                *unsat_list = check;
-                ++unsat_list;
+            // Move the packet as long as there is space in the output buffer
+            if ( ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) {
+
+                // We just go ahead and do the move.  The
+                // progress_vc vector will be set to all -1's so
+                // hr_router won't try to progress anything.
+                internal_router_event* ev = ports[port]->recv(vc);
+                ports[ev->getNextPort()]->send(ev,ev->getVC());
+
+                satisfied.push_back(candidates[i]);
             }
-            // trace.getOutput().output("Got to here 4\n");
         }
 
-        // std::cout << "+++++++++" << std::endl;
-        // for ( int i = 0; i < total_entries; i++ ) {
-        //     std::cout << priority[next_list][i].first << ", " << priority[cur_list][i].second << std::endl;
-        // }
-        // std::cout << "+++++++++" << std::endl;
-
-        // cur_list ^= next_list;
-        // next_list ^= cur_list;
-        // cur_list ^= next_list;
-        priority_entry_t* tmp = cur_list;
-        cur_list = next_list;
-        next_list = tmp;
+        // Satisfied entries go to the bottom of the list, with the
+        // first one satisfied at the very bottom
+        uint64_t count = satisfied.size();
+        for ( size_t i = 0; i < satisfied.size(); i++ ) {
+            stamps[satisfied[i]] = next_stamp + count - 1 - i;
+        }
+        next_stamp += count;
         return;
     }
     
@@ -144,26 +144,22 @@ public:
 
         // Find all ports that have data and who's inputs to the xbar
         // aren't busy.  Sort them by prioritizing on injection time.
-        // Oldest gets top priority.
-        int index = 0;
-        for ( int i = 0; i < num_ports; i++ ) {
+        // Oldest gets top priority.  Only ports and VCs that have an
+        // event are visited.
+        for ( int i = ready->nextPort(0); i != -1; i = ready->nextPort(i+1) ) {
             if ( in_port_busy[i] > 0 ) {
-                index += num_vcs;
                 continue; // No need to consider port if input to xbar is busy
             }
 
             vc_heads = ports[i]->getVCHeads();
-            for ( int j = 0; j < num_vcs; j++ ) {
-                internal_router_event* src_event = vc_heads[j];
-                if ( src_event != NULL ) {
-                    entries[index].next_port = vc_heads[j]->getNextPort();
-                    entries[index].next_vc = vc_heads[j]->getVC();
-                    entries[index].size_in_flits = vc_heads[j]->getFlitCount();
-                    entries[index].rand_pri = rng->nextUniform();
-
-                    rand_queue.push(&entries[index]);
-                }
-                index++;
+            for ( int j = ready->nextVC(i,0); j != -1; j = ready->nextVC(i,j+1) ) {
+                int index = i * num_vcs + j;
+                entries[index].next_port = vc_heads[j]->getNextPort();
+                entries[index].next_vc = vc_heads[j]->getVC();
+                entries[index].size_in_flits = vc_heads[j]->getFlitCount();
+                entries[index].rand_pri = rng->nextUniform();
+
+                rand_queue.push(&entries[index]);
             }
             
         }
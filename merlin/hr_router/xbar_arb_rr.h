@@ -64,7 +64,7 @@ public:
         for ( int i = 0; i < num_ports; i++ ) {
             rr_vcs[i] = 0;
         }
-	
+
         rr_port = 0;
 #if VERIFY_DECLOCKING
         rr_port_shadow = 0;
@@ -83,50 +83,68 @@ public:
 #endif
                    )
     {
-        // Run through each of the ports, giving first pick in a round robin fashion
-        // for ( int port = rr_port, pcount = 0; pcount < num_ports; port = (port+1) % num_ports, pcount++ ) {
-        for ( int port = rr_port, pcount = 0; pcount < num_ports; port = ((port != num_ports-1) ? port+1 : 0), pcount++ ) {
-
-            vc_heads = ports[port]->getVCHeads();
-	    
-            // Overwrite old data
-            progress_vc[port] = -1;
+        for ( int i = 0; i < num_ports; i++ ) progress_vc[i] = -1;
+
+        // Run through each of the ports that have data, giving first
+        // pick in a round robin fashion
+        bool port_wrapped = false;
+        int port = ready->nextPort(rr_port);
+        if ( port == -1 ) {
+            port = ready->nextPort(0);
+            port_wrapped = true;
+        }
+        while ( port != -1 && !(port_wrapped && port >= rr_port) ) {
+
             // if the output of this port is busy, nothing to do.
-            if ( in_port_busy[port] > 0 ) {
-                continue;
-            }
-	    
-            // See what we should progress for this port
-            // for ( int vc = rr_vcs[port], vcount = 0; vcount < num_vcs; vc = (vc+1) % num_vcs, vcount++ ) {
-            for ( int vc = rr_vcs[port], vcount = 0; vcount < num_vcs; vc = ((vc != num_vcs-1) ? (vc+1) : 0), vcount++ ) {
-		
-                // If there is no event, move to next VC
-                internal_router_event* src_event = vc_heads[vc];
-                if ( src_event == NULL ) continue;
-		
-                // Have an event, see if it can be progressed
-                int next_port = src_event->getNextPort();
-		
-                // We can progress if the next port's input is not
-                // busy and there are enough credits.
-                if ( out_port_busy[next_port] > 0 ) continue;
-                
-                // Need to see if the VC has enough credits
-                int next_vc = src_event->getVC();
-
-                // See if there is enough space
-                if ( !ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) continue;
+            if ( in_port_busy[port] <= 0 ) {
+                vc_heads = ports[port]->getVCHeads();
+
+                // See what we should progress for this port, only
+                // looking at VCs that have an event
+                bool vc_wrapped = false;
+                int vc = ready->nextVC(port,rr_vcs[port]);
+                if ( vc == -1 ) {
+                    vc = ready->nextVC(port,0);
+                    vc_wrapped = true;
+                }
+                while ( vc != -1 && !(vc_wrapped && vc >= rr_vcs[port]) ) {
+                    internal_router_event* src_event = vc_heads[vc];
+
+                    // We can progress if the next port's input is not
+                    // busy and there are enough credits.
+                    int next_port = src_event->getNextPort();
+                    int next_vc = src_event->getVC();
+                    if ( out_port_busy[next_port] <= 0 &&
+                         ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) {
+                        // Tell the router what to move
+                        progress_vc[port] = vc;
 		
-                // Tell the router what to move
-                progress_vc[port] = vc;
-		
-                // Need to set the busy values
-                in_port_busy[port] = src_event->getFlitCount();
-                out_port_busy[next_port] = src_event->getFlitCount();
-                break;  // Go to next port;
+                        // Need to set the busy values
+                        in_port_busy[port] = src_event->getFlitCount();
+                        out_port_busy[next_port] = src_event->getFlitCount();
+                        break;  // Go to next port;
+                    }
+
+                    vc = ready->nextVC(port,vc+1);
+                    if ( vc == -1 && !vc_wrapped ) {
+                        vc = ready->nextVC(port,0);
+                        vc_wrapped = true;
+                    }
+                }
+            }
+
+            port = ready->nextPort(port+1);
+            if ( port == -1 && !port_wrapped ) {
+                port = ready->nextPort(0);
+                port_wrapped = true;
+            }
+        }
+        // Increment rr_vcs for next time, only for ports that were not
+        // busy coming in (whether or not they had anything to send)
+        for ( int i = 0; i < num_ports; i++ ) {
+            if ( in_port_busy[i] <= 0 || progress_vc[i] != -1 ) {
+                rr_vcs[i] = (rr_vcs[i] + 1) % num_vcs;
             }
-            // Increemnt rr_vcs for next time 
-            rr_vcs[port] = (rr_vcs[port] + 1) % num_vcs;
         }
         rr_port = (rr_port + 1) % num_ports;
 
@@ -81,6 +81,7 @@ static const ElementInfoParam hr_router_params[] = {
     {"input_buf_size", "Size of input buffers specified in b or B (can include SI prefix)."},
     {"output_buf_size", "Size of output buffers specified in b or B (can include SI prefix)."},
     {"network_inspectors", "Comma separated list of network inspectors to put on output ports.", ""},
+    {"credit_coalescing_window", "Time to hold freed input buffer credits before returning them in one event per VC.  Specified in s (can include SI prefix).  0 returns credits with every packet.", "0ns"},
     {"debug", "Turn on debugging for router. Set to 1 for on, 0 for off.", "0"},
     {NULL,NULL,NULL}
 };
@@ -96,6 +97,7 @@ static const ElementInfoStatistic hr_router_statistics[] = {
     { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
     { "xbar_stalls", "Count number of cycles the xbar is stalled", "cycles", 1},
     { "idle_time", "number of nanoseconds that port was idle", "nanoseconds", 1},
+    { "send_credit_count", "Count number of credit events sent on link", "events", 1},
     { NULL, NULL, NULL, 0 }
 };
 
@@ -322,6 +324,8 @@ static const ElementInfoParam torus_params[] = {
     {"torus:shape","Shape of the torus specified as the number of routers in each dimension, where each dimension is separated by a colon.  For example, 4x4x2x2.  Any number of dimensions is supported."},
     {"torus:width","Number of links between routers in each dimension, specified in same manner as for shape.  For example, 2x2x1 denotes 2 links in the x and y dimensions and one in the z dimension."},
     {"torus:local_ports","Number of endpoints attached to each router."},
+    {"torus:algorithm","Routing algorithm to use. [DOR | adaptive | ugal].  adaptive picks the productive dimension with the most output credits and falls back to dimension order escape VCs; ugal also considers a non-minimal route through a random intermediate router at the source.","DOR"},
+    {"torus:adaptive_threshold","For ugal, the non-minimal route is taken when its credits per hop exceed those of the minimal route by this factor.","1.0"},
     {NULL,NULL,NULL}
 };
 
@@ -337,6 +341,8 @@ static const ElementInfoParam mesh_params[] = {
     {"mesh:shape","Shape of the mesh specified as the number of routers in each dimension, where each dimension is separated by a colon.  For example, 4x4x2x2.  Any number of dimensions is supported."},
     {"mesh:width","Number of links between routers in each dimension, specified in same manner as for shape.  For example, 2x2x1 denotes 2 links in the x and y dimensions and one in the z dimension."},
     {"mesh:local_ports","Number of endpoints attached to each router."},
+    {"mesh:algorithm","Routing algorithm to use. [DOR | adaptive | ugal].  adaptive picks the productive dimension with the most output credits and falls back to dimension order escape VCs; ugal also considers a non-minimal route through a random intermediate router at the source.","DOR"},
+    {"mesh:adaptive_threshold","For ugal, the non-minimal route is taken when its credits per hop exceed those of the minimal route by this factor.","1.0"},
     {NULL,NULL,NULL}
 };
 
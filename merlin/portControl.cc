@@ -100,7 +100,7 @@ PortControl::recv(int vc)
 	// Need to update vc_heads
 	if ( input_buf[vc].empty() ) {
 	    vc_heads[vc] = NULL;
-	    parent->dec_vcs_with_data();
+	    parent->dec_vcs_with_data(port_number,vc);
 	}
 	else {
 	    vc_heads[vc] = input_buf[vc].front();
@@ -113,8 +113,13 @@ PortControl::recv(int vc)
 	// For now, we're just going to send the credits back to the
 	// other side.  The required BW to do this will not be taken
 	// into account.
-	port_link->send(1,new credit_event(vc_return,port_ret_credits[vc_return])); 
-	port_ret_credits[vc_return] = 0;
+	if ( !coalesce_credits || port_ret_credits[vc_return] >= credit_flush_threshold ) {
+	    sendCredits(vc_return);
+	}
+	else if ( !credit_flush_pending ) {
+	    credit_timing->send(1,NULL);
+	    credit_flush_pending = true;
+	}
     
 #if TRACK
     if ( rtr_id == TRACK_ID && port_number == TRACK_PORT ) {
@@ -124,6 +129,24 @@ PortControl::recv(int vc)
 #endif
     return event;
 }
+
+void
+PortControl::sendCredits(int vc)
+{
+	port_link->send(1,new credit_event(vc,port_ret_credits[vc]));
+	port_ret_credits[vc] = 0;
+	send_credit_count->addData(1);
+}
+
+void
+PortControl::handle_credit_flush(Event* ev)
+{
+	credit_flush_pending = false;
+	for ( int i = 0; i < num_vcs; i++ ) {
+	    if ( port_ret_credits[i] > 0 ) sendCredits(i);
+	}
+}
+
 // time_base is a frequency which represents the bandwidth of the link in flits/second.
 // PortControl::PortControl(Router* rif, int rtr_id, std::string link_port_name,
 //                          int port_number, TimeConverter* time_base, Topology *topo, 
@@ -135,6 +158,7 @@ PortControl::PortControl(Router* rif, int rtr_id, std::string link_port_name,
                          SimTime_t input_latency_cycles, std::string input_latency_timebase,
                          SimTime_t output_latency_cycles, std::string output_latency_timebase,
                          const UnitAlgebra& in_buf_size, const UnitAlgebra& out_buf_size,
+                         const std::string& credit_window,
                          std::vector<std::string>& inspector_names) :
     rtr_id(rtr_id),
     num_vcs(-1),
@@ -149,6 +173,10 @@ PortControl::PortControl(Router* rif, int rtr_id, std::string link_port_name,
     output_buf_count(NULL),
     port_ret_credits(NULL),
     port_out_credits(NULL),
+    credit_timing(NULL),
+    coalesce_credits(false),
+    credit_flush_pending(false),
+    credit_flush_threshold(1),
     idle_start(0),
     waiting(true),
     have_packets(false),
@@ -201,6 +229,18 @@ PortControl::PortControl(Router* rif, int rtr_id, std::string link_port_name,
     
     // output_timing = rif->configureSelfLink(link_port_name + "_output_timing", time_base,
     //                                        new Event::Handler<PortControl>(this,&PortControl::handle_output));
+
+    // A non-zero window turns on credit coalescing
+    UnitAlgebra credit_window_ua(credit_window);
+    if ( !credit_window_ua.hasUnits("s") ) {
+        merlin_abort.fatal(CALL_INFO,-1,"credit_coalescing_window must be specified in s "
+                           "(can include SI prefix): %s\n",credit_window.c_str());
+    }
+    if ( credit_window_ua > UnitAlgebra("0s") ) {
+        coalesce_credits = true;
+        credit_timing = rif->configureSelfLink(link_port_name + "_credit_timing", credit_window,
+                                               new Event::Handler<PortControl>(this,&PortControl::handle_credit_flush));
+    }
     
     curr_out_vc = 0;
 
@@ -212,6 +252,7 @@ PortControl::PortControl(Router* rif, int rtr_id, std::string link_port_name,
     send_packet_count = rif->registerStatistic<uint64_t>("send_packet_count", port_name);
     output_port_stalls = rif->registerStatistic<uint64_t>("output_port_stalls", port_name);
     idle_time = rif->registerStatistic<uint64_t>("idle_time", port_name);
+    send_credit_count = rif->registerStatistic<uint64_t>("send_credit_count", port_name);
 
     // Create any NetworkInspectors
     for ( unsigned int i = 0; i < inspector_names.size(); i++ ) {
@@ -286,7 +327,12 @@ PortControl::initVCs(int vcs, internal_router_event** vc_heads_in, int* xbar_in_
         port_ret_credits[i] = ibs.getRoundedValue();
         xbar_in_credits[i] = obs.getRoundedValue();
         port_out_credits[i] = 0;
+        input_buf[i].init(ibs.getRoundedValue());
+        output_buf[i].init(obs.getRoundedValue());
     }
+
+    credit_flush_threshold = ibs.getRoundedValue() / 2;
+    if ( credit_flush_threshold < 1 ) credit_flush_threshold = 1;
     
     // // Copy the starting return tokens for the input buffers (this
     // // essentially sets the size of the buffer)
@@ -642,7 +688,7 @@ PortControl::handle_input_n2r(Event* ev)
 	    // If this becomes vc_head we need to put it into the vc_heads array
 	    if ( vc_heads[curr_vc] == NULL ) {
             vc_heads[curr_vc] = rtr_event;
-            parent->inc_vcs_with_data();
+            parent->inc_vcs_with_data(port_number,curr_vc);
 	    }
 	    
 	    if ( event->request->getTraceType() != SST::Interfaces::SimpleNetwork::Request::NONE ) {
@@ -737,7 +783,7 @@ PortControl::handle_input_r2r(Event* ev)
 	    // in the array) we need to put it into the vc_heads array
 	    if ( vc_heads[curr_vc] == NULL ) {
             vc_heads[curr_vc] = event;
-            parent->inc_vcs_with_data();
+            parent->inc_vcs_with_data(port_number,curr_vc);
 	    }
         // std::cout << "Got to here 3" << std::endl; 
 	    
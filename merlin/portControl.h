@@ -34,7 +34,70 @@ using namespace SST;
 namespace SST {
 namespace Merlin {
 
-typedef std::queue<internal_router_event*> port_queue_t;
+// Fixed capacity FIFO used for the port buffers.  The capacity is set
+// from the buffer size in flits, which bounds how many packets credit
+// flow control can let into a VC.  It only grows if that bound is
+// ever exceeded.
+template <typename T>
+class port_ring_buffer {
+public:
+    port_ring_buffer() :
+        buf(NULL),
+        mask(0),
+        head(0),
+        count(0)
+    {}
+
+    ~port_ring_buffer() { delete [] buf; }
+
+    void init(size_t capacity) {
+        size_t cap = 1;
+        while ( cap < capacity ) cap <<= 1;
+        delete [] buf;
+        buf = new T[cap];
+        mask = cap - 1;
+        head = 0;
+        count = 0;
+    }
+
+    inline bool empty() const { return count == 0; }
+    inline size_t size() const { return count; }
+    inline T& front() { return buf[head]; }
+
+    inline void pop() {
+        head = (head + 1) & mask;
+        count--;
+    }
+
+    inline void push(const T& value) {
+        if ( count > mask ) grow();
+        buf[(head + count) & mask] = value;
+        count++;
+    }
+
+private:
+    T* buf;
+    size_t mask;
+    size_t head;
+    size_t count;
+
+    void grow() {
+        size_t cap = (mask + 1) * 2;
+        T* new_buf = new T[cap];
+        for ( size_t i = 0; i < count; i++ ) {
+            new_buf[i] = buf[(head + i) & mask];
+        }
+        delete [] buf;
+        buf = new_buf;
+        mask = cap - 1;
+        head = 0;
+    }
+
+    port_ring_buffer(const port_ring_buffer&);
+    port_ring_buffer& operator=(const port_ring_buffer&);
+};
+
+typedef port_ring_buffer<internal_router_event*> port_queue_t;
 typedef std::queue<TopologyEvent*> topo_queue_t;
 
 // Class to manage link between NIC and router.  A single NIC can have
@@ -92,6 +155,15 @@ private:
 
     int* port_ret_credits;
     int* port_out_credits;
+
+    // Credit coalescing.  When enabled, credits freed by recv() are
+    // held and returned with one credit_event per VC at the end of
+    // the coalescing window, or as soon as a VC has half of its input
+    // buffer to return.  Otherwise a credit_event is sent per packet.
+    Link* credit_timing;
+    bool coalesce_credits;
+    bool credit_flush_pending;
+    int credit_flush_threshold;
     
     // Doing a round robin on the output.  Need to keep track of the
     // current virtual channel.
@@ -119,6 +191,7 @@ private:
     Statistic<uint64_t>* send_packet_count;
     Statistic<uint64_t>* output_port_stalls;
     Statistic<uint64_t>* idle_time;
+    Statistic<uint64_t>* send_credit_count;
 
     Output& output;
     
@@ -145,6 +218,7 @@ public:
                 SimTime_t input_latency_cycles, std::string input_latency_timebase,
                 SimTime_t output_latency_cycles, std::string output_latency_timebase,
                 const UnitAlgebra& in_buf_size, const UnitAlgebra& out_buf_size,
+                const std::string& credit_window,
                 std::vector<std::string>& inspector_names);
 
     void initVCs(int vcs, internal_router_event** vc_heads, int* xbar_in_credits);
@@ -175,6 +249,9 @@ private:
     void handle_input_r2r(Event* ev);
     void handle_output_n2r(Event* ev);
     void handle_output_r2r(Event* ev);
+    void handle_credit_flush(Event* ev);
+
+    void sendCredits(int vc);
 };
 
 }  // Namespace merlin
@@ -35,7 +35,7 @@ debug = 0
 class Topo:
     def __init__(self):
         self.topoKeys = []
-        self.topoOptKeys = []
+        self.topoOptKeys = ["credit_coalescing_window"]
         def epFunc(epID):
             return None
         self._getEndPoint = epFunc
@@ -88,7 +88,7 @@ class topoTorus(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys.extend(["topology", "debug", "num_ports", "flit_size", "link_bw", "xbar_bw", "torus:shape", "torus:width", "torus:local_ports","input_latency","output_latency","input_buf_size","output_buf_size"])
-        self.topoOptKeys.extend(["xbar_arb"])
+        self.topoOptKeys.extend(["xbar_arb","torus:algorithm","torus:adaptive_threshold"])
     def getName(self):
         return "Torus"
     def prepParams(self):
@@ -198,7 +198,7 @@ class topoMesh(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys = ["topology", "debug", "num_ports", "flit_size", "link_bw", "xbar_bw", "mesh:shape", "mesh:width", "mesh:local_ports","input_latency","output_latency","input_buf_size","output_buf_size"]
-        self.topoOptKeys = ["xbar_arb"]
+        self.topoOptKeys = ["xbar_arb","credit_coalescing_window","mesh:algorithm","mesh:adaptive_threshold"]
     def getName(self):
         return "Mesh"
     def prepParams(self):
@@ -316,7 +316,7 @@ class topoFatTree(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys = ["topology", "debug", "flit_size", "link_bw", "xbar_bw","input_latency","output_latency","input_buf_size","output_buf_size", "fattree:shape"]
-        self.topoOptKeys = ["xbar_arb", "fattree:routing_alg", "fattree:adaptive_threshold"]
+        self.topoOptKeys = ["xbar_arb","credit_coalescing_window", "fattree:routing_alg", "fattree:adaptive_threshold"]
         self.nicKeys = ["link_bw"]
         self.ups = []
         self.downs = []
@@ -500,7 +500,7 @@ class topoDragonFly(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys = ["topology", "debug", "num_ports", "flit_size", "link_bw", "xbar_bw", "dragonfly:hosts_per_router", "dragonfly:routers_per_group", "dragonfly:intergroup_per_router", "dragonfly:num_groups","input_latency","output_latency","input_buf_size","output_buf_size"]
-        self.topoOptKeys = ["xbar_arb","link_bw:host","link_bw:group","link_bw:global","input_latency:host","input_latency:group","input_latency:global","output_latency:host","output_latency:group","output_latency:global","input_buf_size:host","input_buf_size:group","input_buf_size:global","output_buf_size:host","output_buf_size:group","output_buf_size:global",]
+        self.topoOptKeys = ["xbar_arb","credit_coalescing_window","link_bw:host","link_bw:group","link_bw:global","input_latency:host","input_latency:group","input_latency:global","output_latency:host","output_latency:group","output_latency:global","input_buf_size:host","input_buf_size:group","input_buf_size:global","output_buf_size:host","output_buf_size:group","output_buf_size:global",]
     def getName(self):
         return "Dragonfly"
 
@@ -578,7 +578,7 @@ class topoDragonFly2(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys = ["topology", "debug", "num_ports", "flit_size", "link_bw", "xbar_bw", "dragonfly:hosts_per_router", "dragonfly:routers_per_group", "dragonfly:intergroup_per_router", "dragonfly:num_groups","dragonfly:intergroup_links","input_latency","output_latency","input_buf_size","output_buf_size"]
-        self.topoOptKeys = ["xbar_arb","link_bw:host","link_bw:group","link_bw:global","input_latency:host","input_latency:group","input_latency:global","output_latency:host","output_latency:group","output_latency:global","input_buf_size:host","input_buf_size:group","input_buf_size:global","output_buf_size:host","output_buf_size:group","output_buf_size:global",]
+        self.topoOptKeys = ["xbar_arb","credit_coalescing_window","link_bw:host","link_bw:group","link_bw:global","input_latency:host","input_latency:group","input_latency:global","output_latency:host","output_latency:group","output_latency:global","input_buf_size:host","input_buf_size:group","input_buf_size:global","output_buf_size:host","output_buf_size:group","output_buf_size:global",]
         self.global_link_map = None
 
     def getName(self):
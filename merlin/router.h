@@ -23,6 +23,9 @@
 #include <sst/core/unitAlgebra.h>
 #include <sst/core/interfaces/simpleNetwork.h>
 
+#include <stdint.h>
+#include <vector>
+
 using namespace SST;
 
 namespace SST {
@@ -33,6 +36,81 @@ namespace Merlin {
 const int INIT_BROADCAST_ADDR = -1;
 
 class TopologyEvent;
+
+// Bitmap of the (port,VC) input queues that currently have an event
+// at their head.  PortControl keeps it up to date as events are
+// enqueued and dequeued, so the router and the crossbar arbiters can
+// walk only the occupied VCs with find-first-set instead of scanning
+// every port and VC each cycle.  Iteration is always in ascending
+// (port,vc) order.
+class VCReadyMap {
+public:
+    VCReadyMap() :
+        num_ports(0),
+        num_vcs(0),
+        words_per_port(0)
+    {}
+
+    void init(int num_ports_s, int num_vcs_s) {
+        num_ports = num_ports_s;
+        num_vcs = num_vcs_s;
+        words_per_port = (num_vcs + 63) / 64;
+        vc_bits.assign(num_ports * words_per_port, 0);
+        port_bits.assign((num_ports + 63) / 64, 0);
+    }
+
+    inline void set(int port, int vc) {
+        vc_bits[port * words_per_port + (vc >> 6)] |= (uint64_t)1 << (vc & 63);
+        port_bits[port >> 6] |= (uint64_t)1 << (port & 63);
+    }
+
+    inline void clear(int port, int vc) {
+        uint64_t* words = &vc_bits[port * words_per_port];
+        words[vc >> 6] &= ~((uint64_t)1 << (vc & 63));
+        for ( int i = 0; i < words_per_port; i++ ) {
+            if ( words[i] != 0 ) return;
+        }
+        port_bits[port >> 6] &= ~((uint64_t)1 << (port & 63));
+    }
+
+    inline bool test(int port, int vc) const {
+        return (vc_bits[port * words_per_port + (vc >> 6)] >> (vc & 63)) & 1;
+    }
+
+    inline bool portReady(int port) const {
+        return (port_bits[port >> 6] >> (port & 63)) & 1;
+    }
+
+    // Returns the first port >= start that has a ready VC, or -1 if
+    // there is none.
+    inline int nextPort(int start) const {
+        return findNext(&port_bits[0], port_bits.size(), start, num_ports);
+    }
+
+    // Returns the first VC >= start on port that is ready, or -1 if
+    // there is none.
+    inline int nextVC(int port, int start) const {
+        return findNext(&vc_bits[port * words_per_port], words_per_port, start, num_vcs);
+    }
+
+private:
+    int num_ports;
+    int num_vcs;
+    int words_per_port;
+    std::vector<uint64_t> vc_bits;
+    std::vector<uint64_t> port_bits;
+
+    static inline int findNext(const uint64_t* words, int num_words, int start, int limit) {
+        if ( start >= limit ) return -1;
+        int w = start >> 6;
+        uint64_t bits = words[w] & (~(uint64_t)0 << (start & 63));
+        while ( true ) {
+            if ( bits != 0 ) return (w << 6) + __builtin_ctzll(bits);
+            if ( ++w >= num_words ) return -1;
+            bits = words[w];
+        }
+    }
+};
     
 class Router : public Component {
 private:
@@ -49,6 +127,7 @@ protected:
     { requestNotifyOnEvent = state; }
 
     int vcs_with_data;
+    VCReadyMap vc_ready;
     
 public:
 
@@ -64,9 +143,10 @@ public:
    
     virtual void notifyEvent() {}
 
-    inline void inc_vcs_with_data() { vcs_with_data++; }
-    inline void dec_vcs_with_data() { vcs_with_data--; }
+    inline void inc_vcs_with_data(int port, int vc) { vcs_with_data++; vc_ready.set(port,vc); }
+    inline void dec_vcs_with_data(int port, int vc) { vcs_with_data--; vc_ready.clear(port,vc); }
     inline int get_vcs_with_data() { return vcs_with_data; }
+    inline const VCReadyMap& get_vc_ready() { return vc_ready; }
 
     virtual int const* getOutputBufferCredits() = 0;
     virtual void sendTopologyEvent(int port, TopologyEvent* ev) = 0;
@@ -380,10 +460,15 @@ class PortControl;
 class XbarArbitration : public SubComponent {
 public:
     XbarArbitration(Component* parent) :
-        SubComponent(parent)
+        SubComponent(parent),
+        ready(NULL)
     {}
     virtual ~XbarArbitration() {}
 
+    // The router's (port,VC) ready map.  Arbiters use it to visit
+    // only the VCs that have an event waiting.
+    void setReadyMap(const VCReadyMap* ready_s) { ready = ready_s; }
+
 #if VERIFY_DECLOCKING
     virtual void arbitrate(PortControl** ports, int* port_busy, int* out_port_busy, int* progress_vc, bool clocking) = 0;
 #else
@@ -392,6 +477,9 @@ public:
     virtual void setPorts(int num_ports, int num_vcs) = 0;
     virtual void reportSkippedCycles(Cycle_t cycles) {};
     virtual void dumpState(std::ostream& stream) {};
+
+protected:
+    const VCReadyMap* ready;
 	
 };
 
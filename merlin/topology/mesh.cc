@@ -14,6 +14,8 @@
 #include <algorithm>
 #include <stdlib.h>
 
+#include "sst/core/rng/xorshift.h"
+
 
 
 using namespace SST::Merlin;
@@ -79,6 +81,37 @@ topo_mesh::topo_mesh(Component* comp, Params& params) :
 
     id_loc = new int[dimensions];
     idToLocation(router_id, id_loc);
+
+    num_routers = 1;
+    for ( int i = 0; i < dimensions; i++ ) {
+        num_routers *= dim_size[i];
+    }
+
+    // The adaptive algorithms use one dimension order escape VC and
+    // one adaptive VC per VN (Duato).  UGAL needs a separate pair for
+    // each phase of a non-minimal route.
+    std::string route_algo = params.find<std::string>("mesh:algorithm", "DOR");
+    if ( !route_algo.compare("DOR") ) {
+        algorithm = DOR;
+        vcs_per_vn = 2;
+    }
+    else if ( !route_algo.compare("adaptive") ) {
+        algorithm = ADAPTIVE;
+        vcs_per_vn = 2;
+    }
+    else if ( !route_algo.compare("ugal") ) {
+        algorithm = UGAL;
+        vcs_per_vn = 4;
+    }
+    else {
+        output.fatal(CALL_INFO, -1, "Unknown mesh:algorithm %s.  Valid values are DOR, adaptive and ugal\n", route_algo.c_str());
+    }
+
+    adaptive_threshold = params.find<double>("mesh:adaptive_threshold", 1.0);
+
+    output_credits = NULL;
+    num_vcs = 0;
+    rng = new RNG::XORShiftRNG(router_id+1);
 }
 
 topo_mesh::~topo_mesh()
@@ -87,10 +120,28 @@ topo_mesh::~topo_mesh()
     delete [] dim_size;
     delete [] dim_width;
     delete [] port_start;
+    delete rng;
 }
 
 void
 topo_mesh::route(int port, int vc, internal_router_event* ev)
+{
+    if ( algorithm == DOR ) {
+        route_dor(port, vc, ev);
+        return;
+    }
+
+    if ( get_dest_router(ev->getDest()) == router_id ) {
+        ev->setNextPort(get_dest_local_port(ev->getDest()));
+        return;
+    }
+
+    route_adaptive(port, vc, static_cast<topo_mesh_event*>(ev));
+}
+
+
+void
+topo_mesh::route_dor(int port, int vc, internal_router_event* ev)
 {
     int dest_router = get_dest_router(ev->getDest());
     if ( dest_router == router_id ) {
@@ -129,18 +180,136 @@ topo_mesh::route(int port, int vc, internal_router_event* ev)
 
 
 
+void
+topo_mesh::route_adaptive(int port, int vc, topo_mesh_event* tt_ev)
+{
+    // Reached the intermediate router, start the second phase
+    if ( tt_ev->last_router != router_id ) {
+        tt_ev->last_router = router_id;
+        if ( tt_ev->route_phase == 0 && memcmp(id_loc, tt_ev->mid_loc, dimensions * sizeof(int)) == 0 ) {
+            tt_ev->route_phase = 1;
+        }
+    }
+
+    int flits = tt_ev->getFlitCount();
+    int vn_base = (vc / vcs_per_vn) * vcs_per_vn;
+
+    // UGAL: at the source router, choose between the minimal route
+    // and the route through the intermediate router.  Each candidate
+    // is scored by the credits of its best adaptive output, weighted
+    // by the number of hops the route takes.  The decision is
+    // revisited every time the packet is rerouted until it leaves
+    // this router.
+    if ( algorithm == UGAL && tt_ev->mid_loc != NULL && port >= local_port_start ) {
+        int min_credits;
+        choose_adaptive_port(tt_ev->dest_loc, vn_base + 2 + 1, min_credits);
+        int nm_credits;
+        choose_adaptive_port(tt_ev->mid_loc, vn_base + 1, nm_credits);
+
+        int min_hops = get_hops(id_loc, tt_ev->dest_loc);
+        int nm_hops = get_hops(id_loc, tt_ev->mid_loc) + get_hops(tt_ev->mid_loc, tt_ev->dest_loc);
+
+        if ( (double)nm_credits * min_hops > (double)min_credits * nm_hops * adaptive_threshold ) {
+            tt_ev->route_phase = 0;
+        }
+        else {
+            tt_ev->route_phase = 1;
+        }
+    }
+
+    const int* target = (tt_ev->route_phase == 0) ? tt_ev->mid_loc : tt_ev->dest_loc;
+    int vc_base = vn_base;
+    if ( algorithm == UGAL && tt_ev->route_phase == 1 ) vc_base += 2;
+
+    // Take the productive output with the most credits on the
+    // adaptive VC.  If none has room for the packet, fall back to the
+    // dimension order escape VC.
+    int credits;
+    int adaptive_port = choose_adaptive_port(target, vc_base + 1, credits);
+    if ( adaptive_port != -1 && credits >= flits ) {
+        tt_ev->setNextPort(adaptive_port);
+        tt_ev->setVC(vc_base + 1);
+        return;
+    }
+
+    tt_ev->setNextPort(choose_escape_port(target));
+    tt_ev->setVC(vc_base);
+}
+
+
+int
+topo_mesh::get_hops(const int* from, const int* to) const
+{
+    int hops = 0;
+    for ( int dim = 0; dim < dimensions; dim++ ) {
+        hops += abs(to[dim] - from[dim]);
+    }
+    return hops;
+}
+
+
+int
+topo_mesh::choose_adaptive_port(const int* target, int vc, int& credits) const
+{
+    int best_port = -1;
+    credits = -1;
+    for ( int dim = 0; dim < dimensions; dim++ ) {
+        if ( target[dim] == id_loc[dim] ) continue;
+
+        int go_pos = (id_loc[dim] < target[dim]);
+        for ( int i = 0; i < dim_width[dim]; i++ ) {
+            int p = port_start[dim][(go_pos) ? 0 : 1] + i;
+            int c = output_credits[p * num_vcs + vc];
+            if ( c > credits ) {
+                credits = c;
+                best_port = p;
+            }
+        }
+    }
+    return best_port;
+}
+
+
+int
+topo_mesh::choose_escape_port(const int* target)
+{
+    for ( int dim = 0; dim < dimensions; dim++ ) {
+        if ( target[dim] == id_loc[dim] ) continue;
+
+        int go_pos = (id_loc[dim] < target[dim]);
+        return choose_multipath(port_start[dim][(go_pos) ? 0 : 1],
+                                dim_width[dim],
+                                abs(id_loc[dim] - target[dim]));
+    }
+    // Only called when the packet is not at its target
+    return -1;
+}
+
+
 internal_router_event*
 topo_mesh::process_input(RtrEvent* ev)
 {
     topo_mesh_event* tt_ev = new topo_mesh_event(dimensions);
     tt_ev->setEncapsulatedEvent(ev);
-    tt_ev->setVC(ev->request->vn * 2);
+    tt_ev->setVC(ev->request->vn * vcs_per_vn);
     
     // Need to figure out what the mesh address is for easier
     // routing.
     int run_id = get_dest_router(tt_ev->getDest());
     idToLocation(run_id, tt_ev->dest_loc);
 
+    tt_ev->last_router = router_id;
+
+    // Pick the intermediate router for a possible non-minimal route
+    if ( algorithm == UGAL && num_routers > 2 && run_id != router_id ) {
+        int mid_id;
+        do {
+            mid_id = rng->generateNextUInt32() % num_routers;
+        } while ( mid_id == router_id || mid_id == run_id );
+        tt_ev->mid_loc = new int[dimensions];
+        idToLocation(mid_id, tt_ev->mid_loc);
+    }
+
 	return tt_ev;
 }
 
@@ -153,7 +322,7 @@ void topo_mesh::routeInitData(int port, internal_router_event* ev, std::vector<i
             /* Broadcast has arrived at 0.  Switch Phases */
             tt_ev->phase = 1;
         } else {
-            route(port, 0, ev);
+            route_dor(port, 0, ev);
             outPorts.push_back(ev->getNextPort());
             return;
         }
@@ -193,7 +362,7 @@ internal_router_event* topo_mesh::process_InitData_input(RtrEvent* ev)
 {
     topo_mesh_init_event* tt_ev = new topo_mesh_init_event(dimensions);
     tt_ev->setEncapsulatedEvent(ev);
-    tt_ev->setVC(ev->request->vn * 2);
+    tt_ev->setVC(ev->request->vn * vcs_per_vn);
     if ( tt_ev->getDest() == INIT_BROADCAST_ADDR ) {
         /* For broadcast, first send to rtr 0 */
         idToLocation(0, tt_ev->dest_loc);
@@ -292,7 +461,7 @@ topo_mesh::choose_multipath(int start_port, int num_ports, int dest_dist)
 int
 topo_mesh::computeNumVCs(int vns)
 {
-    return 2*vns;
+    return vcs_per_vn*vns;
 }
 
 int
@@ -302,3 +471,9 @@ topo_mesh::getEndpointID(int port)
     return (router_id * num_local_ports) + (port - local_port_start);
 }
 
+void
+topo_mesh::setOutputBufferCreditArray(int const* array, int vcs)
+{
+    output_credits = array;
+    num_vcs = vcs;
+}
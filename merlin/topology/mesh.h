@@ -18,6 +18,7 @@
 #include <sst/core/event.h>
 #include <sst/core/link.h>
 #include <sst/core/params.h>
+#include <sst/core/rng/sstrng.h>
 
 #include <string.h>
 
@@ -32,14 +33,23 @@ public:
     int routing_dim;
     int* dest_loc;
 
-    topo_mesh_event() {}
-    topo_mesh_event(int dim) {	dimensions = dim; routing_dim = 0; dest_loc = new int[dim]; }
-    virtual ~topo_mesh_event() { delete[] dest_loc; }
+    // State used by the adaptive and ugal algorithms
+    int* mid_loc;           // Intermediate router for non-minimal routes (NULL if none)
+    int route_phase;        // 0 = routing to mid_loc, 1 = routing to dest_loc
+    int last_router;        // Router that last processed the arrival of this event
+
+    topo_mesh_event() : mid_loc(NULL) {}
+    topo_mesh_event(int dim) {	dimensions = dim; routing_dim = 0; dest_loc = new int[dim]; mid_loc = NULL; route_phase = 1; last_router = -1; }
+    virtual ~topo_mesh_event() { delete[] dest_loc; delete[] mid_loc; }
     virtual internal_router_event* clone(void)
     {
         topo_mesh_event* tte = new topo_mesh_event(*this);
         tte->dest_loc = new int[dimensions];
         memcpy(tte->dest_loc, dest_loc, dimensions*sizeof(int));
+        if ( mid_loc != NULL ) {
+            tte->mid_loc = new int[dimensions];
+            memcpy(tte->mid_loc, mid_loc, dimensions*sizeof(int));
+        }
         return tte;
     }
 
@@ -47,14 +57,25 @@ public:
         internal_router_event::serialize_order(ser);
         ser & dimensions;
         ser & routing_dim;
+        ser & route_phase;
+        ser & last_router;
+
+        bool has_mid = (mid_loc != NULL);
+        ser & has_mid;
 
         if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
             dest_loc = new int[dimensions];
+            mid_loc = has_mid ? new int[dimensions] : NULL;
         }
 
         for ( int i = 0 ; i < dimensions ; i++ ) {
             ser & dest_loc[i];
         }
+        if ( has_mid ) {
+            for ( int i = 0 ; i < dimensions ; i++ ) {
+                ser & mid_loc[i];
+            }
+        }
     }
 
 protected:
@@ -77,6 +98,7 @@ public:
         topo_mesh_init_event* tte = new topo_mesh_init_event(*this);
         tte->dest_loc = new int[dimensions];
         memcpy(tte->dest_loc, dest_loc, dimensions*sizeof(int));
+        tte->mid_loc = NULL;
         return tte;
     }
 
@@ -93,6 +115,12 @@ private:
 
 class topo_mesh: public Topology {
 
+    enum RouteAlgo {
+        DOR,
+        ADAPTIVE,
+        UGAL
+    };
+
     int router_id;
     int* id_loc;
 
@@ -105,6 +133,16 @@ class topo_mesh: public Topology {
     int num_local_ports;
     int local_port_start;
 
+    RouteAlgo algorithm;
+    double adaptive_threshold;
+    int vcs_per_vn;
+    int num_routers;
+
+    int const* output_credits;
+    int num_vcs;
+
+    RNG::SSTRandom* rng;
+
 public:
     topo_mesh(Component* comp, Params& params);
     ~topo_mesh();
@@ -119,6 +157,8 @@ public:
     virtual int computeNumVCs(int vns);
     virtual int getEndpointID(int port);
 
+    virtual void setOutputBufferCreditArray(int const* array, int vcs);
+
 protected:
     virtual int choose_multipath(int start_port, int num_ports, int dest_dist);
 
@@ -127,6 +167,12 @@ private:
     void parseDimString(const std::string &shape, int *output) const;
     int get_dest_router(int dest_id) const;
     int get_dest_local_port(int dest_id) const;
+
+    void route_dor(int port, int vc, internal_router_event* ev);
+    void route_adaptive(int port, int vc, topo_mesh_event* tt_ev);
+    int get_hops(const int* from, const int* to) const;
+    int choose_adaptive_port(const int* target, int vc, int& credits) const;
+    int choose_escape_port(const int* target);
 };
 
 }
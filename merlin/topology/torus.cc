@@ -14,6 +14,8 @@
 #include <algorithm>
 #include <stdlib.h>
 
+#include "sst/core/rng/xorshift.h"
+
 
 
 using namespace SST::Merlin;
@@ -84,6 +86,42 @@ topo_torus::topo_torus(Component* comp, Params& params) :
 
     id_loc = new int[dimensions];
     idToLocation(router_id, id_loc);
+
+    num_routers = 1;
+    for ( int i = 0; i < dimensions; i++ ) {
+        num_routers *= dim_size[i];
+    }
+
+    // DOR uses a pair of dateline VCs per VN.  The adaptive
+    // algorithms add an adaptive VC on top of the dateline pair,
+    // which is kept as the escape path (Duato).  UGAL needs a
+    // separate set for each phase of a non-minimal route.
+    std::string route_algo = params.find<std::string>("torus:algorithm", "DOR");
+    if ( !route_algo.compare("DOR") ) {
+        algorithm = DOR;
+        vcs_per_vn = 2;
+    }
+    else if ( !route_algo.compare("adaptive") ) {
+        algorithm = ADAPTIVE;
+        vcs_per_vn = 3;
+    }
+    else if ( !route_algo.compare("ugal") ) {
+        algorithm = UGAL;
+        vcs_per_vn = 6;
+    }
+    else {
+        output.fatal(CALL_INFO, -1, "Unknown torus:algorithm %s.  Valid values are DOR, adaptive and ugal\n", route_algo.c_str());
+    }
+
+    if ( algorithm != DOR && dimensions > 32 ) {
+        output.fatal(CALL_INFO, -1, "torus:algorithm %s supports at most 32 dimensions\n", route_algo.c_str());
+    }
+
+    adaptive_threshold = params.find<double>("torus:adaptive_threshold", 1.0);
+
+    output_credits = NULL;
+    num_vcs = 0;
+    rng = new RNG::XORShiftRNG(router_id+1);
 }
 
 topo_torus::~topo_torus()
@@ -92,10 +130,28 @@ topo_torus::~topo_torus()
     delete [] dim_size;
     delete [] dim_width;
     delete [] port_start;
+    delete rng;
 }
 
 void
 topo_torus::route(int port, int vc, internal_router_event* ev)
+{
+    if ( algorithm == DOR ) {
+        route_dor(port, vc, ev);
+        return;
+    }
+
+    if ( get_dest_router(ev->getDest()) == router_id ) {
+        ev->setNextPort(get_dest_local_port(ev->getDest()));
+        return;
+    }
+
+    route_adaptive(port, vc, static_cast<topo_torus_event*>(ev));
+}
+
+
+void
+topo_torus::route_dor(int port, int vc, internal_router_event* ev)
 {
     int dest_router = get_dest_router(ev->getDest());
     if ( dest_router == router_id ) {
@@ -143,18 +199,177 @@ topo_torus::route(int port, int vc, internal_router_event* ev)
 
 
 
+void
+topo_torus::route_adaptive(int port, int vc, topo_torus_event* tt_ev)
+{
+    if ( tt_ev->last_router != router_id ) {
+        process_arrival(port, tt_ev);
+    }
+
+    int flits = tt_ev->getFlitCount();
+    int vn_base = (vc / vcs_per_vn) * vcs_per_vn;
+
+    // UGAL: at the source router, choose between the minimal route
+    // and the route through the intermediate router.  Each candidate
+    // is scored by the credits of its best adaptive output, weighted
+    // by the number of hops the route takes.  The decision is
+    // revisited every time the packet is rerouted until it leaves
+    // this router.
+    if ( algorithm == UGAL && tt_ev->mid_loc != NULL && port >= local_port_start ) {
+        int min_credits;
+        choose_adaptive_port(tt_ev->dest_loc, vn_base + 3 + 2, min_credits);
+        int nm_credits;
+        choose_adaptive_port(tt_ev->mid_loc, vn_base + 2, nm_credits);
+
+        int min_hops = get_hops(id_loc, tt_ev->dest_loc);
+        int nm_hops = get_hops(id_loc, tt_ev->mid_loc) + get_hops(tt_ev->mid_loc, tt_ev->dest_loc);
+
+        if ( (double)nm_credits * min_hops > (double)min_credits * nm_hops * adaptive_threshold ) {
+            tt_ev->route_phase = 0;
+        }
+        else {
+            tt_ev->route_phase = 1;
+        }
+    }
+
+    const int* target = (tt_ev->route_phase == 0) ? tt_ev->mid_loc : tt_ev->dest_loc;
+    int vc_base = vn_base;
+    if ( algorithm == UGAL && tt_ev->route_phase == 1 ) vc_base += 3;
+
+    // Take the productive output with the most credits on the
+    // adaptive VC.  If none has room for the packet, fall back to the
+    // dimension order escape VCs.
+    int credits;
+    int adaptive_port = choose_adaptive_port(target, vc_base + 2, credits);
+    if ( adaptive_port != -1 && credits >= flits ) {
+        tt_ev->setNextPort(adaptive_port);
+        tt_ev->setVC(vc_base + 2);
+        return;
+    }
+
+    int dim;
+    int escape_port = choose_escape_port(target, dim);
+    tt_ev->setNextPort(escape_port);
+    tt_ev->setVC(vc_base + ((tt_ev->crossed >> dim) & 1));
+}
+
+
+void
+topo_torus::process_arrival(int port, topo_torus_event* tt_ev)
+{
+    tt_ev->last_router = router_id;
+
+    // Note which dateline (if any) the packet just crossed.  A packet
+    // arriving on a negative port was travelling in the positive
+    // direction and vice versa.
+    for ( int dim = 0; dim < dimensions; dim++ ) {
+        if ( port >= port_start[dim][1] && port < port_start[dim][1] + dim_width[dim] ) {
+            if ( id_loc[dim] == 0 ) tt_ev->crossed |= (1 << dim);
+            break;
+        }
+        if ( port >= port_start[dim][0] && port < port_start[dim][0] + dim_width[dim] ) {
+            if ( id_loc[dim] == dim_size[dim] - 1 ) tt_ev->crossed |= (1 << dim);
+            break;
+        }
+    }
+
+    // Reached the intermediate router, start the second phase
+    if ( tt_ev->route_phase == 0 && memcmp(id_loc, tt_ev->mid_loc, dimensions * sizeof(int)) == 0 ) {
+        tt_ev->route_phase = 1;
+        tt_ev->crossed = 0;
+    }
+}
+
+
+int
+topo_torus::get_hops(const int* from, const int* to) const
+{
+    int hops = 0;
+    for ( int dim = 0; dim < dimensions; dim++ ) {
+        int dist = abs(to[dim] - from[dim]);
+        hops += std::min(dist, dim_size[dim] - dist);
+    }
+    return hops;
+}
+
+
+int
+topo_torus::choose_adaptive_port(const int* target, int vc, int& credits) const
+{
+    int best_port = -1;
+    credits = -1;
+    for ( int dim = 0; dim < dimensions; dim++ ) {
+        if ( target[dim] == id_loc[dim] ) continue;
+
+        int dist_neg = id_loc[dim] - target[dim];
+        if ( dist_neg < 0 ) dist_neg += dim_size[dim];
+        int dist_pos = target[dim] - id_loc[dim];
+        if ( dist_pos < 0 ) dist_pos += dim_size[dim];
+
+        // Both directions are minimal when the distances are equal
+        for ( int dir = 0; dir < 2; dir++ ) {
+            if ( dir == 0 && dist_pos > dist_neg ) continue;
+            if ( dir == 1 && dist_neg > dist_pos ) continue;
+            for ( int i = 0; i < dim_width[dim]; i++ ) {
+                int p = port_start[dim][dir] + i;
+                int c = output_credits[p * num_vcs + vc];
+                if ( c > credits ) {
+                    credits = c;
+                    best_port = p;
+                }
+            }
+        }
+    }
+    return best_port;
+}
+
+
+int
+topo_torus::choose_escape_port(const int* target, int& dim)
+{
+    for ( dim = 0; dim < dimensions; dim++ ) {
+        if ( target[dim] == id_loc[dim] ) continue;
+
+        int dist_neg = id_loc[dim] - target[dim];
+        if ( dist_neg < 0 ) dist_neg += dim_size[dim];
+        int dist_pos = target[dim] - id_loc[dim];
+        if ( dist_pos < 0 ) dist_pos += dim_size[dim];
+
+        int go_pos = (dist_pos <= dist_neg);
+        return choose_multipath(port_start[dim][(go_pos) ? 0 : 1],
+                                dim_width[dim],
+                                (go_pos)? dist_pos : dist_neg);
+    }
+    // Only called when the packet is not at its target
+    dim = 0;
+    return -1;
+}
+
+
 internal_router_event*
 topo_torus::process_input(RtrEvent* ev)
 {
     topo_torus_event* tt_ev = new topo_torus_event(dimensions);
     tt_ev->setEncapsulatedEvent(ev);
-    tt_ev->setVC(ev->request->vn * 2);
+    tt_ev->setVC(ev->request->vn * vcs_per_vn);
     
     // Need to figure out what the torus address is for easier
     // routing.
     int run_id = get_dest_router(tt_ev->getDest());
     idToLocation(run_id, tt_ev->dest_loc);
 
+    tt_ev->last_router = router_id;
+
+    // Pick the intermediate router for a possible non-minimal route
+    if ( algorithm == UGAL && num_routers > 2 && run_id != router_id ) {
+        int mid_id;
+        do {
+            mid_id = rng->generateNextUInt32() % num_routers;
+        } while ( mid_id == router_id || mid_id == run_id );
+        tt_ev->mid_loc = new int[dimensions];
+        idToLocation(mid_id, tt_ev->mid_loc);
+    }
+
 	return tt_ev;
 }
 
@@ -191,7 +406,7 @@ void topo_torus::routeInitData(int port, internal_router_event* ev, std::vector<
 
 
     } else {
-        route(port, 0, ev);
+        route_dor(port, 0, ev);
         outPorts.push_back(ev->getNextPort());
     }
 }
@@ -201,7 +416,7 @@ internal_router_event* topo_torus::process_InitData_input(RtrEvent* ev)
 {
     topo_torus_event* tt_ev = new topo_torus_event(dimensions);
     tt_ev->setEncapsulatedEvent(ev);
-    tt_ev->setVC(ev->request->vn * 2);
+    tt_ev->setVC(ev->request->vn * vcs_per_vn);
     if ( tt_ev->getDest() == INIT_BROADCAST_ADDR ) {
         /* For broadcast, use dest_loc as src_loc */
         for ( int i = 0 ; i < dimensions ; i++ ) {
@@ -283,7 +498,7 @@ topo_torus::choose_multipath(int start_port, int num_ports, int dest_dist)
 int
 topo_torus::computeNumVCs(int vns)
 {
-    return 2*vns;
+    return vcs_per_vn*vns;
 }
 
 int
@@ -293,4 +508,9 @@ topo_torus::getEndpointID(int port)
     return (router_id * num_local_ports) + (port - local_port_start);
 }
 
-
+void
+topo_torus::setOutputBufferCreditArray(int const* array, int vcs)
+{
+    output_credits = array;
+    num_vcs = vcs;
+}
@@ -105,10 +105,9 @@ DragonflyMachine::DragonflyMachine(int routersPerGroup, int portsPerRouter,
     dist_it = 1;
     nodesAtDistances.push_back(1);
     while (total < numNodes) {
-        list<int> *temp_list = getFreeAtDistance(0, dist_it);
-        nodesAtDistances.push_back(temp_list->size());
-        total += temp_list->size();
-        delete temp_list;
+        int shellSize = getShell(0, dist_it).size();
+        nodesAtDistances.push_back(shellSize);
+        total += shellSize;
         dist_it++;
     }
     
@@ -148,66 +147,71 @@ std::string DragonflyMachine::getSetupInfo(bool comment)
     return ret.str();
 }
 
-int DragonflyMachine::getNodeDistance(int node0, int node1) const
+int DragonflyMachine::computeNodeDistance(int node0, int node1) const
 {
-    vector<int>* links = getRoute(node0, node1, 1);
-    int size = links->size();
-    delete links;
-    return size;
+    //same number of hops as appendRoute()
+    if (node0 == node1)
+        return 0;
+    int hops = 2;   //node-to-router & router-to-node
+
+    int rID0 = routerOf(node0);
+    int rID1 = routerOf(node1);
+    int gID0 = rID0 / routersPerGroup;
+    int lID0 = rID0 % routersPerGroup;
+    int gID1 = rID1 / routersPerGroup;
+    int lID1 = rID1 % routersPerGroup;
+
+    int gdist = max(gID1 - gID0, gID0 - gID1);
+    gdist = min(gdist, numGroups - gdist);
+    if (gdist != 0) {
+        int rmid0 = gID0 * routersPerGroup + gdist - 1;
+        int rmid1 = gID1 * routersPerGroup + gdist - 1;
+        hops += 1 + (rID0 != rmid0) + (rID1 != rmid1);
+    } else if (lID0 != lID1) {
+        hops++;
+    }
+    return hops;
 }
 
-list<int>* DragonflyMachine::getFreeAtDistance(int center, int distance) const
+void DragonflyMachine::appendAtDistance(int center, int distance, vector<int> & nodes) const
 {
-    list<int>* nodes = new list<int>();
     if (distance <= 1) {
-        return nodes;
+        return;
     }
   
     //apply breadth-first search to find routers at (distance - 2)
     //  to account for the node-to-router hop
     vector<bool> marked(numRouters, false);
-    list<int>* rQ1 = new list<int>();
-    int center_rID = routerOf(center);
-    rQ1->push_back(center_rID);
-    marked[center_rID] = true;
+    vector<int> rQ1(1, routerOf(center));
+    marked[rQ1[0]] = true;
     
     while (distance > 2) {
-        list<int>* rQ2 = new list<int>();
-        while (!rQ1->empty()) {
+        vector<int> rQ2;
+        for (unsigned int i = 0; i < rQ1.size(); i++) {
             //add connected nodes to rQ2
-            int rID = rQ1->front();
-            rQ1->pop_front();
-
+            int rID = rQ1[i];
             for (map<int, int>::const_iterator it = routers[rID].begin();
                 it != routers[rID].end(); it++) {
                 if(!marked[it->first]){
                     marked[it->first] = true;
-                    rQ2->push_back(it->first);
+                    rQ2.push_back(it->first);
                 }
             }
         }
         //we don't care about routers with smaller distance
-        delete rQ1;
-        rQ1 = rQ2;
+        rQ1.swap(rQ2);
         distance--;
     }
-    for (int i = 0; i < numRouters; i++)
-        rQ1->push_back(i); 
     
     //get all nodes connected to the routers in the queue
-    while (!rQ1->empty()) {
-        int rID = rQ1->front();
-        rQ1->pop_front();
+    for (unsigned int i = 0; i < rQ1.size(); i++) {
+        int rID = rQ1[i];
         for (int nID = rID * nodesPerRouter; nID < (rID + 1) * nodesPerRouter; nID++) {
-            if (isFree(nID) && nID != center) {
-                nodes->push_back(nID);
+            if (nID != center) {
+                nodes.push_back(nID);
             }
         }
     }
-    
-    delete rQ1;
-
-    return nodes;
 }
 
 int DragonflyMachine::nodesAtDistance(int dist) const
@@ -218,11 +222,10 @@ int DragonflyMachine::nodesAtDistance(int dist) const
         return nodesAtDistances[dist];
 }
 
-vector<int>* DragonflyMachine::getRoute(int node0, int node1, double commWeight) const
+void DragonflyMachine::appendRoute(int node0, int node1, double commWeight, vector<int> & links) const
 {
-    vector<int>* links = new vector<int>();
     if (node0 == node1)
-        return links;
+        return;
  
     //randomize when there is multiple equidistant paths
     static SST::RNG::SSTRandom* rng = new SST::RNG::MarsagliaRNG();
@@ -231,7 +234,7 @@ vector<int>* DragonflyMachine::getRoute(int node0, int node1, double commWeight)
     const int numInterRouterLinks = numLinks - nodesPerRouter * numRouters;
 
     //node-to-router-hop
-    links->push_back(numInterRouterLinks + node0);
+    links.push_back(numInterRouterLinks + node0);
 
     int rID0 = routerOf(node0);
     int rID1 = routerOf(node1);
@@ -253,19 +256,19 @@ vector<int>* DragonflyMachine::getRoute(int node0, int node1, double commWeight)
 			 
                 //add local hop 1
                 if (rID0 != rmid0)
-                    links->push_back(routers[rID0].find(rmid0)->second);
+                    links.push_back(routers[rID0].find(rmid0)->second);
                 //add global hop
-                links->push_back(routers[rmid0].find(rmid1)->second);
+                links.push_back(routers[rmid0].find(rmid1)->second);
                 //add local hop 2
                 if (rID1 != rmid1){
-                    links->push_back(routers[rmid1].find(rID1)->second);
+                    links.push_back(routers[rmid1].find(rID1)->second);
                 }
             } else {
                 goto unknown_topo;
             }
         } else if(lID0 != lID1) {
             if (ltopo == ALLTOALL) {
-                links->push_back(routers[rID0].find(rID1)->second);
+                links.push_back(routers[rID0].find(rID1)->second);
             } else {
                 goto unknown_topo;
             }
@@ -277,12 +280,11 @@ vector<int>* DragonflyMachine::getRoute(int node0, int node1, double commWeight)
     }
 
     //router-to-node hop
-    links->push_back(numInterRouterLinks + node1);
+    links.push_back(numInterRouterLinks + node1);
  
-    return links;
+    return;
 unknown_topo:
-    schedout.fatal(CALL_INFO, 1, "DragonflyMachine - getRoute(): Unknown topology\n");
-    return NULL;
+    schedout.fatal(CALL_INFO, 1, "DragonflyMachine - appendRoute(): Unknown topology\n");
 }
 
 int DragonflyMachine::routerOf(int node) const
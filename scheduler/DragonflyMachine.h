@@ -43,19 +43,19 @@ namespace SST {
 
                 std::string getSetupInfo(bool comment);
                 
-                //returns the network distance of the given nodes
-                int getNodeDistance(int node0, int node1) const;
-                
-                //returns the free nodes at the given Distance
-                std::list<int>* getFreeAtDistance(int center, int distance) const;
-                
                 //max number of nodes at the given distance - NearestAllocMapper uses this
                 int nodesAtDistance(int dist) const;
                 
                 //DragonflyMachine default routing is local->(global->global->...)->local
-                //@return vector of link indices
-                std::vector<int>* getRoute(int node0, int node1, double commWeight) const;
+                void appendRoute(int node0, int node1, double commWeight, std::vector<int> & links) const;
                 
+            protected:
+                //returns the network distance of the given nodes
+                int computeNodeDistance(int node0, int node1) const;
+                
+                //appends all nodes at the given Distance
+                void appendAtDistance(int center, int distance, std::vector<int> & nodes) const;
+
             private:                
                 //constructor helpers
                 int getNumNodes(int opticalsPerRouter, int routersPerGroup, int nodesPerRouter) const
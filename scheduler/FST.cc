@@ -11,13 +11,21 @@
 
 /*
  * Computes the FST for each job that comes in
+ *
+ * Rather than copying the simulation's scheduler for every arrival, FST
+ * keeps its own copy up to date by replaying the arrivals, starts and
+ * completions the simulation reports.  The schedule it plays forward to
+ * find one job's FST is kept, and the next arrival carries on from it when
+ * nothing since has made it wrong; otherwise its copy of the scheduler is
+ * copied again.
  */
 
 #include "sst_config.h"
 #include "FST.h"
 
-#include <vector>
+#include <math.h>
 #include <map>
+#include <vector>
 
 #include "AllocInfo.h"
 #include "Job.h"
@@ -31,11 +39,29 @@
 using namespace SST::Scheduler;
 using namespace std;
 
-FST::FST(int inrelaxed)
+//used as a comparator to make sure our simulation considers events in the
+//right order.  We assume that events that finish at the same time arrive in
+//order of event number (this also matches the Java), which corresponds to the
+//start time of the job
+bool compevents(Job* j1, Job* j2) {
+    if (j1 -> getStartTime() + j1 -> getActualTime() == j2 -> getStartTime() + j2 -> getActualTime()) {
+        //return j1 -> getJobNum() < j2 -> getJobNum();
+        return j1 -> getStartTime() < j2 -> getStartTime();
+    }
+    return j1 -> getStartTime() + j1 -> getActualTime() < j2 -> getStartTime() + j2 -> getActualTime();
+}
+
+FST::FST(int inrelaxed, int numThreads)
 {
-    //keeps track of job copies so we have a pointer when they actually start
-    running = new vector<Job*>;
-    toRun = new vector<Job*>;
+    jobFST = NULL;
+    numjobs = 0;
+    current = NULL;
+    projection = NULL;
+    diverged = false;
+    decisionPending = false;
+    decisionTime = 0;
+    this -> numThreads = numThreads;
+    stopping = false;
     schedout.init("", 8, 0, Output::STDOUT);
 
     if (inrelaxed == 1) {
@@ -45,281 +71,501 @@ FST::FST(int inrelaxed)
     } else {
         schedout.fatal(CALL_INFO, 1, "Passed %d to FST constructor; should be 1 or 2", inrelaxed);
     }
+    if (numThreads < 0) {
+        schedout.fatal(CALL_INFO, 1, "Passed %d FST threads; should be 0 or more", numThreads);
+    }
+}
+
+FST::~FST()
+{
+    if (evaluator.joinable()) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            stopping = true;
+        }
+        workReady.notify_all();
+        evaluator.join();
+    }
+    delete projection;
+    delete current;
+    delete [] jobFST;
 }
 
 //This would normally be a part of the constructor but we need the number of
-//jobs, so schedComponent calls it later. 
-void FST::setup(int innumjobs)
+//jobs, so schedComponent calls it later, before any job has arrived
+void FST::setup(int innumjobs, Scheduler* insched, Machine* inmach)
 {
     numjobs = innumjobs;
-    jobFST = new unsigned long[numjobs]; 
+    jobFST = new unsigned long[numjobs];
+    computed.assign(numjobs, 0);
+
+    //the only copy of the simulation's scheduler we need; from here on it
+    //follows the updates
+    vector<Job*> none;
+    current = new Schedule(insched -> copy(&none, &none), inmach);
+
+    //every FST builds on the schedules before it, so the updates are
+    //applied in order on one thread however many were asked for
+    if (numThreads > 0) {
+        evaluator = std::thread(&FST::evaluatorLoop, this);
+    }
 }
 
-//used as a comparator to make sure our simulation considers events in the
-//right order.  We assume that events that finish at the same time arrive in
-//order of event number (this also matches the Java), which corresponds to the
-//start time of the job 
-bool compevents(Job* j1, Job* j2) {
-    if (j1 -> getStartTime() + j1 -> getActualTime() == j2 -> getStartTime() + j2 -> getActualTime()) {
-        //return j1 -> getJobNum() < j2 -> getJobNum();
-        return j1 -> getStartTime() < j2 -> getStartTime();
+FST::Schedule::Schedule(Scheduler* insched, Machine* inmach)
+{
+    sched = insched;
+    mach = new SimpleMachine(inmach -> numNodes, true, inmach -> coresPerNode, NULL);
+    alloc = new SimpleAllocator((SimpleMachine*) mach);
+    taskMap = new SimpleTaskMapper(*mach);
+}
+
+FST::Schedule::~Schedule()
+{
+    delete sched;
+    delete taskMap;
+    delete alloc;
+    delete mach;
+    for (map<long, TaskMapInfo*>::iterator it = jobToAi.begin(); it != jobToAi.end(); it++) {
+        delete it -> second;
     }
-    return j1 -> getStartTime() + j1 -> getActualTime() < j2 -> getStartTime() + j2 -> getActualTime();
+    for (map<long, Job*>::iterator it = jobs.begin(); it != jobs.end(); it++) {
+        delete it -> second;
+    }
+}
+
+//starts a job the scheduler returned from tryToStart, the way schedComponent does
+void FST::Schedule::start(Job* job, unsigned long time)
+{
+    job -> start(time);
+    AllocInfo* ai = alloc -> allocate(job);
+    if (NULL == ai) {
+        schedout.fatal(CALL_INFO, 1, "FST could not allocate %s after the scheduler started it\n", job -> toString().c_str());
+    }
+    TaskMapInfo* tmi = taskMap -> mapTasks(ai);
+    mach -> allocate(tmi);
+    sched -> startNext(time, *mach);
+    jobToAi[job -> getJobNum()] = tmi;
+}
+
+void FST::Schedule::finish(Job* job, unsigned long time)
+{
+    map<long, TaskMapInfo*>::iterator tmi = jobToAi.find(job -> getJobNum());
+    if (tmi == jobToAi.end()) schedout.fatal(CALL_INFO, 1, "couldn't find %s in jobToAi", job -> toString().c_str());
+
+    mach -> deallocate(tmi -> second);
+    alloc -> deallocate(tmi -> second -> allocInfo);
+    sched -> jobFinishes(job, time, *mach);
+    delete tmi -> second;
+    jobToAi.erase(tmi);
+    jobs.erase(job -> getJobNum());
+    delete job;
+}
+
+FST::Projection::Projection(Scheduler* insched, Machine* inmach) : Schedule(insched, inmach), endtimes(compevents)
+{
+    time = 0;
+    decided = false;
+    unstarted = 0;
+    waiting = NULL;
+    waitingSince = 0;
+    faithful = true;
+}
+
+FST::Projection::~Projection()
+{
+    delete waiting;
 }
 
 //When a job arrives, we need to calculate its FST value
-void FST::jobArrives(Job *inj, Scheduler* insched, Machine* inmach)
-{ 
+void FST::jobArrives(Job *inj)
+{
     schedout.debug(CALL_INFO, 7, 0, "%s arriving to FST\n", inj -> toString().c_str());
-    
-    Job *j = new Job(*inj); //must copy the job because they keep track of when they each start
 
-    //if the schedule is not relaxed the job has already been added; otherwise
-    //we want to add it later (but only once)
-    bool alreadyadded = !relaxed;
+    Update update;
+    update.type = Update::ARRIVAL;
+    update.job = new Job(*inj); //must copy the job because they keep track of when they each start
+    update.jobNum = inj -> getJobNum();
+    update.time = inj -> getArrivalTime();
+    post(update);
+}
 
-    if (!relaxed) {
-        toRun -> push_back(j); //keep the pointer for the future so we can add it to running
-        //(if relaxed we'll add it later, after all the other jobs complete)
-    }
+void FST::jobStarts(Job* j, unsigned long time)
+{
+    Update update;
+    update.type = Update::START;
+    update.job = NULL;
+    update.jobNum = j -> getJobNum();
+    update.time = time;
+    post(update);
+}
 
-    //if there are no running jobs, no need for simulation
-    if (running -> empty()) {
-        schedout.debug(CALL_INFO, 7, 0, "no need for simulation\n");
-        jobFST[j -> getJobNum()] = j -> getArrivalTime();
-        schedout.debug(CALL_INFO, 7, 0, "Assigning FST of %lu to Job %ld\n", jobFST[j -> getJobNum()], j -> getJobNum());
-        if (relaxed) {
-            toRun -> push_back(j); //keep the pointer for the future so we can add it to running
-        }
+void FST::jobCompletes(Job* j, unsigned long time)
+{
+    schedout.debug(CALL_INFO, 7, 0, "%s completing in FST\n", j -> toString().c_str());
+    Update update;
+    update.type = Update::COMPLETION;
+    update.job = NULL;
+    update.jobNum = j -> getJobNum();
+    update.time = time;
+    post(update);
+}
+
+void FST::post(Update update)
+{
+    if (0 == numThreads) {
+        apply(update);
         return;
     }
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        pending.push_back(update);
+    }
+    workReady.notify_one();
+}
 
-    //create copies of the scheduler, machine, and allocator for our simulation
-    Scheduler* sched = insched -> copy(running, toRun);
-    Machine* mach = new SimpleMachine(inmach->numNodes, true, inmach->coresPerNode, NULL);
-    Allocator* alloc = new SimpleAllocator((SimpleMachine*) mach);
-    TaskMapper* taskMap = new SimpleTaskMapper(*mach);
-    string nullstr = "";
-    char nullcstr[] = "";
-    map<Job*, TaskMapInfo*>* jobToAi = new map<Job*, TaskMapInfo*>();
+void FST::evaluatorLoop()
+{
+    while (true) {
+        Update update;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            while (!stopping && pending.empty()) {
+                workReady.wait(guard);
+            }
+            if (pending.empty()) {
+                return;
+            }
+            update = pending.front();
+            pending.pop_front();
+        }
+        apply(update);
+    }
+}
 
-    for (unsigned int x = 0; x < running -> size(); x++) {
-        AllocInfo* ai = alloc -> allocate(running -> at(x));
-        if (NULL == ai){
-            schedout.fatal(CALL_INFO, 1, "in FST could not allocate running job\nMachine had %d processors for %s", mach -> getNumFreeNodes(), running -> at(x) -> toString().c_str());
+//replays one thing the simulation did on our copy of its scheduler
+void FST::apply(const Update & update)
+{
+    closeDecision(update.time);
+
+    if (Update::ARRIVAL == update.type) {
+        //if the schedule is not relaxed the simulation's scheduler already
+        //has the job; otherwise it gets it once we know the FST
+        if (!relaxed) {
+            current -> sched -> jobArrives(update.job, update.time, *(current -> mach));
+            current -> jobs[update.jobNum] = update.job;
+        }
+        evaluate(update.job, update.time);
+        if (relaxed) {
+            current -> sched -> jobArrives(update.job, update.time, *(current -> mach));
+            current -> jobs[update.jobNum] = update.job;
+        }
+    } else if (Update::START == update.type) {
+        Job* job = current -> sched -> tryToStart(update.time, *(current -> mach));
+        if (NULL == job || job -> getJobNum() != update.jobNum) {
+            schedout.fatal(CALL_INFO, 1, "FST's copy of the scheduler did not start job %ld at %lu as the simulation did\n", update.jobNum, update.time);
+        }
+        current -> start(job, update.time);
+
+        //the projection must have started it at the same time, or it no
+        //longer describes the simulation
+        if (NULL != projection && update.time <= projection -> time) {
+            map<long, Job*>::iterator found = projection -> jobs.find(update.jobNum);
+            if (found != projection -> jobs.end() && found -> second -> getStartTime() != update.time) {
+                diverged = true;
+            }
+        }
+    } else {
+        map<long, Job*>::iterator found = current -> jobs.find(update.jobNum);
+        if (found == current -> jobs.end()) {
+            schedout.fatal(CALL_INFO, 1, "FST could not find completing job %ld in its currently-running list\n", update.jobNum);
+        }
+        //the projection assumed every job runs for exactly its actual time
+        if (found -> second -> getStartTime() + found -> second -> getActualTime() != update.time) {
+            diverged = true;
         }
-        TaskMapInfo* tmi = taskMap->mapTasks(ai);
-        mach -> allocate(tmi);
-        jobToAi -> insert(pair<Job*, TaskMapInfo*>(running -> at(x), tmi));
-        delete tmi;
+        current -> finish(found -> second, update.time);
     }
 
-    Statistics* stats = new Statistics(mach, sched, alloc, taskMap, nullstr.c_str(), nullcstr, true, this);
+    decisionPending = true;
+    decisionTime = update.time;
+}
 
-    //have to keep track of each job's end time
-    bool(*compeventsptr)(Job*, Job*) = compevents;
-    std::multimap<Job*, unsigned long, bool(*)(Job*, Job*)>* endtimes = 
-        new std::multimap<Job*, unsigned long, bool(*)(Job*, Job*)>(compeventsptr); 
+//after the arrivals and completions at a time, the simulation asks its
+//scheduler for jobs until there are none; the starts come to us as updates,
+//so ask the copy the last time once the simulation has moved on
+void FST::closeDecision(unsigned long time)
+{
+    if (!decisionPending || decisionTime >= time) {
+        return;
+    }
+    Job* job = current -> sched -> tryToStart(decisionTime, *(current -> mach));
+    if (NULL != job) {
+        schedout.fatal(CALL_INFO, 1, "FST's copy of the scheduler would start job %ld at %lu but the simulation did not\n", job -> getJobNum(), decisionTime);
+    }
+    decisionPending = false;
+}
 
-    for(unsigned int x = 0; x < running -> size(); x++) {
-        endtimes -> insert(pair<Job*, unsigned long>(running -> at(x), running -> at(x) -> getStartTime() + running -> at(x) -> getActualTime()));
+//plays the schedule forward until j starts; current is the simulation's
+//state as j arrives
+void FST::evaluate(Job* j, unsigned long time)
+{
+    //if there are no running jobs and nothing waiting ahead of j, no need
+    //for simulation
+    if (current -> jobToAi.empty() && current -> jobs.size() == (relaxed ? 0u : 1u)) {
+        schedout.debug(CALL_INFO, 7, 0, "no need for simulation\n");
+        record(j -> getJobNum(), time);
+        delete projection;
+        projection = NULL;
+        return;
     }
 
-    //the scheduler will delete jobs once they finish; we'll still need them
-    //for the next simulation though
-    std::vector<Job*>* readdtorunning = new vector<Job*>; 
-    std::vector<Job*>* readdtorun = new vector<Job*>; 
+    if (carryOn(j, time)) {
+        schedout.debug(CALL_INFO, 7, 0, "carrying on from the schedule for the last job at %lu\n", projection -> time);
+    } else {
+        fork(j, time);
+    }
 
-    //step through each waiting job, including j.  Tell the scheduler that it
-    //arrives.  In the meantime, keep an eye on endtimes to make sure we tell
-    //the scheduler about any job that's finishing.
-    unsigned long time = j -> getArrivalTime();
     bool success = false;
-    //see if we can start now
-    if (toRun -> empty() && !alreadyadded) {
-        toRun -> push_back(j);
-        sched -> jobArrives(j, j -> getArrivalTime(), *mach);
-        alreadyadded = true;
-    } 
-    success = FSTstart(endtimes, jobToAi, j, sched, alloc, mach, stats, time);
-
-    if (!alreadyadded) {
-        bool allothersstarted = true;
-        for (unsigned int x = 0; allothersstarted && x < toRun -> size(); x++) {
-            if (!toRun -> at(x) -> hasStarted()) {
-                allothersstarted = false;
-            }
-        }
-        if (allothersstarted) {
-            toRun -> push_back(j);
-            sched -> jobArrives(j, time, *mach);
-            stats -> jobArrives(time);
-            alreadyadded = true;
-            //try to start again in case we can start the job right away
-            success = FSTstart(endtimes, jobToAi, j, sched, alloc, mach, stats, time);
-        }
+    if (!projection -> decided || NULL != projection -> waiting) {
+        success = decide(projection -> time, j -> getJobNum());
     }
 
-
     //step through each running job.  When it finishes  we tell the scheduler
     //it finishes, then try to start a new job.  If the new job that gets
     //started is j, we assign that as the FST value of j
-    while (!success && !endtimes -> empty()) { 
-        time = endtimes -> begin() -> second;
-        bool found = false;
-
-        //find our job in toRun or running and erase it, but keep track of the pointer for later
-        for (unsigned int x = 0; !found && x < running -> size(); x++) {
-            if (running -> at(x) == endtimes -> begin() -> first) {
-                running -> erase(running -> begin() + x);
-                readdtorunning -> push_back(new Job(*(endtimes -> begin() -> first)));
-                found = true;
-            }
-        }
-        for (unsigned int x = 0; !found && x < toRun -> size(); x++) {
-            if (toRun -> at(x) == endtimes -> begin() -> first) {
-                toRun -> erase(toRun -> begin() + x);
-                readdtorun-> push_back(new Job(*(endtimes -> begin() -> first)));
-                found = true;
-            }
-        } 
-        if (!found) schedout.fatal(CALL_INFO, 1, "Could not find %s in running or toRun", endtimes->begin()->first->toString().c_str());
-
-        if(jobToAi -> find(endtimes -> begin() -> first) == jobToAi -> end()) schedout.fatal(CALL_INFO, 1, "couldn't find %s in jobToAi", endtimes ->begin() -> first -> toString().c_str());
-
-        //tell our simulated scheduler etc that the job completed
-        mach -> deallocate(jobToAi -> find(endtimes -> begin() -> first) -> second);
-        alloc -> deallocate(jobToAi -> find(endtimes -> begin() -> first) -> second -> allocInfo);
-        sched -> jobFinishes(endtimes -> begin() -> first, time, *mach);
-        endtimes -> erase(endtimes -> begin());
-
-        //this check is because we don't want to start until all jobs that have completed at the same time to finish
-        //(may cause a larger job to be able to start as more processors become available)
-        if (endtimes -> begin() -> second != time) {
-            success = FSTstart(endtimes, jobToAi, j, sched, alloc, mach, stats, time);
-
-            //now that a new job is started, see if we can add ours
-            if (relaxed && !alreadyadded) {
-                bool allothersstarted = true;
-                for (unsigned int x = 0; allothersstarted && x < toRun -> size(); x++) {
-                    if (!toRun -> at(x) -> hasStarted()) {
-                        allothersstarted = false;
-                    }
-                }
-                if (allothersstarted) {
-                    toRun -> push_back(j);
-                    sched -> jobArrives(j, time, *mach);
-                    stats -> jobArrives(time);
-                    alreadyadded = true;
-                    //try to start again in case we can start the job right away
-                    success = FSTstart(endtimes, jobToAi, j, sched, alloc, mach, stats, time);
-                }
-            }
-        } 
+    while (!success && !projection -> endtimes.empty()) {
+        finishNext();
+        success = decide(projection -> time, j -> getJobNum());
     }
     if (!success) schedout.fatal(CALL_INFO, 1, "Could not find time for %s in FST\n", j -> toString().c_str());
+    record(j -> getJobNum(), projection -> time);
+}
 
-    //clean up
-    delete sched;
-    delete mach;
-    delete alloc;
-    delete taskMap;
-    delete stats;
-    delete endtimes;
-    for (map<Job*, TaskMapInfo*>::iterator it = jobToAi->begin(); it != jobToAi -> end(); it++) {
-        delete it -> second;
+//adds j to the projection if it still holds for the simulation with j in it
+bool FST::carryOn(Job* j, unsigned long time)
+{
+    if (NULL == projection || diverged || !projection -> faithful) {
+        return false;
     }
-    jobToAi -> clear();
-    delete jobToAi;
-    while (!readdtorunning -> empty()) {
-        running -> push_back(readdtorunning -> back());
-        readdtorunning -> pop_back();
+    //arrivals come in order, so earlier start decisions are not needed again
+    while (!projection -> decisions.empty() && projection -> decisions.front().first < time) {
+        projection -> decisions.pop_front();
     }
-    while (!readdtorun-> empty()) {
-        toRun -> push_back(readdtorun -> back());
-        readdtorun -> pop_back();
+
+    if (projection -> time < time || (projection -> time == time && !projection -> decided)) {
+        advance(time);
+    } else if (!projection -> sched -> arrivalOrdered()) {
+        return false;
+    } else if (!relaxed) {
+        //the projection has already made decisions after j arrived; if j
+        //could have started in one of them we have to go back
+        if (nodesNeeded(j) <= maxFreeBetween(time, projection -> time)) {
+            return false;
+        }
+        //otherwise it is first considered once the last decision is done,
+        //so that decision is made again
+        waitedThrough(time, projection -> time);
+        projection -> decided = false;
     }
-    //some of these jobs may have been started during our simulation; reset them
-    for (unsigned int x = 0; x < toRun -> size(); x++) {
-        toRun -> at(x) -> reset();
+
+    Job* copy = new Job(*j);
+    if (relaxed) {
+        projection -> waiting = copy;
+        projection -> waitingSince = time;
+    } else {
+        projection -> sched -> jobArrives(copy, projection -> time, *(projection -> mach));
+        projection -> jobs[copy -> getJobNum()] = copy;
+        projection -> unstarted++;
     }
-    delete readdtorunning;
-    delete readdtorun;
+    return true;
 }
 
-//helper function; tells the scheduler to start a job
-bool FST::FSTstart(std::multimap<Job*, unsigned long, bool(*)(Job*, Job*)>* endtimes,
-                   std::map<Job*, TaskMapInfo*>* jobToAi, Job* j, Scheduler* sched, 
-                   Allocator* alloc, Machine* mach, Statistics* stats, unsigned long time) 
+//replaces the projection with a copy of the simulation's state
+void FST::fork(Job* j, unsigned long time)
 {
-    AllocInfo* ai;
-    Job* newJob;
-    SimpleTaskMapper taskMapper = SimpleTaskMapper(*mach);
-    TaskMapInfo* tmi;
-    do {
-        newJob = sched->tryToStart(time, *mach);
-        sched->startNext(time, *mach);
-        ai = alloc->allocate(newJob);
-        if (ai != NULL) {
-            tmi = taskMapper.mapTasks(ai);
-            if (ai -> job == j) {
-                //our job has been scheduled!  record the time
-                jobFST[j -> getJobNum()] = time;
-                schedout.debug(CALL_INFO, 7, 0, "Assigning FST of %lu to Job %ld\n", jobFST[j -> getJobNum()], j -> getJobNum());
-                j -> reset();
-                return true;
-            }
-            else {
-                schedout.debug(CALL_INFO, 7, 0, "%lu: FST starting %s\n", time, ai -> job -> toString().c_str());
-                endtimes -> insert(pair<Job*, unsigned long>(ai -> job, time + ai -> job -> getActualTime()));
-                jobToAi -> insert(pair<Job*, TaskMapInfo*>(ai -> job, tmi));
+    delete projection;
+
+    vector<Job*> running;
+    vector<Job*> toRun;
+    map<long, Job*> copies;
+    for (map<long, Job*>::iterator it = current -> jobs.begin(); it != current -> jobs.end(); it++) {
+        Job* copy = new Job(*(it -> second));
+        copies[it -> first] = copy;
+        if (copy -> hasStarted()) {
+            running.push_back(copy);
+        } else {
+            toRun.push_back(copy);
+        }
+    }
+    projection = new Projection(current -> sched -> copy(&running, &toRun), current -> mach);
+    projection -> jobs = copies;
+
+    for (unsigned int x = 0; x < running.size(); x++) {
+        Job* job = running[x];
+        AllocInfo* ai = projection -> alloc -> allocate(job);
+        if (NULL == ai){
+            schedout.fatal(CALL_INFO, 1, "in FST could not allocate running job\nMachine had %d processors for %s", projection -> mach -> getNumFreeNodes(), job -> toString().c_str());
+        }
+        TaskMapInfo* tmi = projection -> taskMap -> mapTasks(ai);
+        projection -> mach -> allocate(tmi);
+        projection -> jobToAi[job -> getJobNum()] = tmi;
+        //have to keep track of each job's end time
+        projection -> endtimes.insert(pair<Job*, unsigned long>(job, job -> getStartTime() + job -> getActualTime()));
+    }
+
+    projection -> unstarted = toRun.size();
+    projection -> time = time;
+    projection -> decided = false;
+    if (relaxed) {
+        //in a relaxed schedule j only joins once every job ahead of it has started
+        projection -> waiting = new Job(*j);
+        projection -> waitingSince = time;
+    }
+    diverged = false;
+}
+
+//plays the projection up to time: the jobs that end by then finish, and
+//jobs start at every earlier time they would have
+void FST::advance(unsigned long time)
+{
+    while (!projection -> endtimes.empty() && projection -> endtimes.begin() -> second <= time) {
+        finishNext();
+        if (projection -> time < time) {
+            decide(projection -> time, -1);
+        }
+    }
+    projection -> time = time;
+    projection -> decided = false;
+}
+
+//finishes every job that ends at the earliest end time; we don't want to
+//start anything until all jobs that complete at the same time finish (may
+//cause a larger job to be able to start as more processors become available)
+void FST::finishNext()
+{
+    unsigned long time = projection -> endtimes.begin() -> second;
+    while (!projection -> endtimes.empty() && projection -> endtimes.begin() -> second == time) {
+        Job* finishing = projection -> endtimes.begin() -> first;
+        projection -> endtimes.erase(projection -> endtimes.begin());
+        projection -> finish(finishing, time);
+    }
+    projection -> time = time;
+    projection -> decided = false;
+}
+
+//starts every job the scheduler will start at time, the way schedComponent
+//does, and returns whether one of them was job number target
+bool FST::decide(unsigned long time, long target)
+{
+    Projection* proj = projection;
+    bool found = false;
+    while (true) {
+        Job* newJob = proj -> sched -> tryToStart(time, *(proj -> mach));
+        if (NULL == newJob) {
+            if (NULL == proj -> waiting || proj -> unstarted > 0) {
+                break;
             }
-            stats -> jobStarts(tmi, time);
+            //every job ahead of the waiting one has started, so it joins
+            //now.  Had it been there since it arrived, it must not have
+            //been able to start any earlier for the projection to go on
+            //describing the simulation
+            Job* joining = proj -> waiting;
+            proj -> waiting = NULL;
+            proj -> faithful = proj -> sched -> arrivalOrdered()
+                && nodesNeeded(joining) > maxFreeBetween(proj -> waitingSince, time);
+            waitedThrough(proj -> waitingSince, time);
+            proj -> sched -> jobArrives(joining, time, *(proj -> mach));
+            proj -> jobs[joining -> getJobNum()] = joining;
+            proj -> unstarted++;
+            continue;
+        }
+        proj -> start(newJob, time);
+        proj -> endtimes.insert(pair<Job*, unsigned long>(newJob, time + newJob -> getActualTime()));
+        proj -> unstarted--;
+        if (newJob -> getJobNum() == target) {
+            found = true;
+        } else {
+            schedout.debug(CALL_INFO, 7, 0, "%lu: FST starting %s\n", time, newJob -> toString().c_str());
         }
-    } while (ai != NULL); 
-    return false; 
+    }
+    //a scheduler that takes jobs in order of arrival returns a later job
+    //only once none ahead of it can start, so this is all a job that
+    //arrived since would have had (none, while jobs wait ahead of it, if
+    //the scheduler never backfills)
+    //a decision made again at the same time replaces the earlier one
+    while (!proj -> decisions.empty() && proj -> decisions.back().first == time) {
+        proj -> decisions.pop_back();
+    }
+    int freeAfter = proj -> mach -> getNumFreeNodes();
+    if (proj -> unstarted > 0 && !proj -> sched -> backfills()) {
+        freeAfter = 0;
+    }
+    proj -> decisions.push_back(pair<unsigned long, int>(time, freeAfter));
+    proj -> time = time;
+    proj -> decided = true;
+    return found;
 }
 
-//when a job finishes, we just remove it from running
-void FST::jobCompletes(Job* j)
+//most nodes left free by a decision made in [from, to), or -1
+int FST::maxFreeBetween(unsigned long from, unsigned long to)
 {
-    schedout.debug(CALL_INFO, 7, 0, "%s completing in FST\n", j -> toString().c_str());
-    for(vector<Job*>::iterator it = running -> begin(); it != running -> end(); it++) {
-        if ((*it) -> getJobNum() == j -> getJobNum()) {
-            delete *it;
-            running -> erase(it);
-            return;
+    int most = -1;
+    for (deque<pair<unsigned long, int> >::iterator it = projection -> decisions.begin(); it != projection -> decisions.end(); it++) {
+        if (it -> first >= from && it -> first < to && it -> second > most) {
+            most = it -> second;
         }
     }
-    schedout.fatal(CALL_INFO, 1, "FST could not find completing job in its currently-running list\n");
+    return most;
 }
 
-//when a job starts, we must move it to running from toRun
-void FST::jobStarts(Job* j, unsigned long time) 
+//a job that could not start was waiting through the decisions made in
+//[from, to); with a scheduler that never backfills nothing that arrived
+//after it could have started in them either
+void FST::waitedThrough(unsigned long from, unsigned long to)
 {
-    //Need to add the job to running when it actually starts.  But, we want to
-    //add the copied version, not the actual version (or this simulation kills
-    //our schedule)
-    for(unsigned int x = 0; x < toRun -> size(); x++) {
-        if(toRun -> at(x) -> getJobNum() == j -> getJobNum()) {
-            Job* startingjob = toRun -> at(x);
-            startingjob -> startsAtTime(time);
-            running -> push_back(startingjob); 
-            toRun -> erase (toRun -> begin() + x);
-            return;
-        } 
+    if (projection -> sched -> backfills()) {
+        return;
+    }
+    for (deque<pair<unsigned long, int> >::iterator it = projection -> decisions.begin(); it != projection -> decisions.end(); it++) {
+        if (it -> first >= from && it -> first < to) {
+            it -> second = 0;
+        }
+    }
+}
+
+int FST::nodesNeeded(Job* j)
+{
+    return ceil(((float) j -> getProcsNeeded()) / projection -> mach -> coresPerNode);
+}
+
+void FST::record(long jobNum, unsigned long time)
+{
+    schedout.debug(CALL_INFO, 7, 0, "Assigning FST of %lu to Job %ld\n", time, jobNum);
+    if (0 == numThreads) {
+        jobFST[jobNum] = time;
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        jobFST[jobNum] = time;
+        computed[jobNum] = 1;
     }
-    schedout.fatal(CALL_INFO, 1, "Job %ld started before FST was aware it arrived\n", j -> getJobNum());
+    workDone.notify_all();
 }
 
 //returns the FST value for job num
 unsigned long FST::getFST(int num)
 {
     if(num < 0 || num >= numjobs) schedout.fatal(CALL_INFO, 1, "trying to get FST value out of range: %d", num);
+    if (numThreads > 0) {
+        std::unique_lock<std::mutex> guard(lock);
+        while (!computed[num]) {
+            workDone.wait(guard);
+        }
+    }
     return jobFST[num];
 }
 
-
 /*    
       for (unsigned int simjob = 0; simjob < running -> size(); simjob++) {
 //tell the scheduler about all jobs that finish before the next running job starts
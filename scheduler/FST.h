@@ -16,8 +16,13 @@
 #ifndef SST_SCHEDULER_FST_H__
 #define SST_SCHEDULER_FST_H__
 
-#include <vector>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace SST {
     namespace Scheduler {
@@ -25,26 +30,98 @@ namespace SST {
         class Machine;
         class Allocator;
         class Job;
-        class Statistics;
         class TaskMapInfo;
+        class TaskMapper;
 
         class FST {
             private:
-                std::vector<Job*>* running;
-                std::vector<Job*>* toRun;
+                typedef std::multimap<Job*, unsigned long, bool(*)(Job*, Job*)> EndTimes;
+
+                //a copy of the scheduler on a simple machine, with its own
+                //copies of the jobs it knows about
+                struct Schedule {
+                    Scheduler* sched;
+                    Machine* mach;
+                    Allocator* alloc;
+                    TaskMapper* taskMap;
+                    std::map<long, Job*> jobs;              //running or waiting, by job number
+                    std::map<long, TaskMapInfo*> jobToAi;   //running jobs' allocations
+
+                    Schedule(Scheduler* insched, Machine* inmach);
+                    ~Schedule();
+                    void start(Job* job, unsigned long time);
+                    void finish(Job* job, unsigned long time);
+                };
+
+                //the schedule played forward from the simulation's state
+                //until the last job we were asked about started; the next
+                //arrival carries on from here instead of copying again
+                struct Projection : public Schedule {
+                    EndTimes endtimes;
+                    unsigned long time;     //how far it has been played
+                    bool decided;           //whether jobs were started at time
+                    int unstarted;          //jobs the scheduler has not started
+                    Job* waiting;           //relaxed: job that joins once the others start
+                    unsigned long waitingSince;
+                    bool faithful;          //whether it still follows the simulation
+                    //free nodes after each start decision since the last arrival
+                    std::deque<std::pair<unsigned long, int> > decisions;
+
+                    Projection(Scheduler* insched, Machine* inmach);
+                    ~Projection();
+                };
+
+                //what the simulation tells us, in the order it happens
+                struct Update {
+                    enum Type { ARRIVAL, START, COMPLETION } type;
+                    Job* job;               //ARRIVAL: our copy of the job
+                    long jobNum;
+                    unsigned long time;
+                };
+
                 int numjobs;
                 unsigned long* jobFST; //array to hold the FST values for jobs 1....numjobs
                 bool relaxed;
 
+                Schedule* current;      //the simulation's schedule, replayed from updates
+                Projection* projection;
+                bool diverged;          //a job ran longer or shorter than its actual time
+                bool decisionPending;   //current has not yet been asked to start jobs at decisionTime
+                unsigned long decisionTime;
+
+                //with numThreads > 0 updates are applied on a background
+                //thread and getFST() waits for the value it needs
+                int numThreads;
+                std::thread evaluator;
+                std::deque<Update> pending;
+                std::vector<char> computed;
+                std::mutex lock;
+                std::condition_variable workReady;
+                std::condition_variable workDone;
+                bool stopping;
+
+                void post(Update update);
+                void apply(const Update & update);
+                void closeDecision(unsigned long time);
+                void evaluate(Job* j, unsigned long time);
+                bool carryOn(Job* j, unsigned long time);
+                void fork(Job* j, unsigned long time);
+                void advance(unsigned long time);
+                void finishNext();
+                bool decide(unsigned long time, long target);
+                int maxFreeBetween(unsigned long from, unsigned long to);
+                void waitedThrough(unsigned long from, unsigned long to);
+                int nodesNeeded(Job* j);
+                void record(long jobNum, unsigned long time);
+                void evaluatorLoop();
+
             public:
-                void jobArrives(Job* j, Scheduler* insched, Machine* inmach);
-                void jobCompletes(Job* j);
+                void jobArrives(Job* j);
+                void jobCompletes(Job* j, unsigned long time);
                 void jobStarts(Job* j, unsigned long time);
-                FST(int inrelaxed); 
-                bool FSTstart(std::multimap<Job*, unsigned long, bool(*)(Job*, Job*)>* endtimes, 
-                              std::map<Job*, TaskMapInfo*>* jobToAi, Job* j, Scheduler* sched,
-                              Allocator* alloc, Machine* mach, Statistics* stats, unsigned long time);
-                void setup(int numjobs);
+                FST(int inrelaxed, int numThreads = 0);
+                ~FST();
+                void setup(int numjobs, Scheduler* insched, Machine* inmach);
                 unsigned long getFST(int num);
         };
 
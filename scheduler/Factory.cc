@@ -43,6 +43,7 @@
 #include "allocators/SimpleAllocator.h"
 #include "allocators/SortedFreeListAllocator.h"
 
+#include "schedulers/ConservativeScheduler.h"
 #include "schedulers/EASYScheduler.h"
 #include "schedulers/PQScheduler.h"
 #include "schedulers/StatefulScheduler.h"
@@ -70,6 +71,7 @@ const Factory::schedTableEntry Factory::schedTable[] = {
     {PRIORITIZE, "prioritize"},
     {DELAYED, "delayed"},
     {ELC, "elc"},
+    {CONSERVATIVE, "conservative"},
 };
 
 const Factory::machTableEntry Factory::machTable[] = {
@@ -208,6 +210,15 @@ Scheduler* Factory::getScheduler(SST::Params& params, int numNodes, const Machin
             }
             break;
 
+            //Conservative backfilling on an availability profile
+        case CONSERVATIVE:
+            schedout.debug(CALL_INFO, 4, 0, "Conservative Backfilling Scheduler\n");
+            if (schedparams -> size() != 1) {
+                schedout.fatal(CALL_INFO, 1, "Conservative backfilling scheduler takes no parameters");
+            }
+            return new ConservativeScheduler(numNodes);
+            break;
+
             //Default: scheduler name not matched
         default:
             schedout.fatal(CALL_INFO, 1, "Could not parse name of scheduler");
@@ -558,6 +569,26 @@ int Factory::getFST(SST::Params& params)
     return 0; 
 }
 
+//threads for FST, given as strict[threads] or relaxed[threads]; 0 computes
+//each FST before the simulation goes on, anything more on one background
+//thread, since each FST carries on from the last
+int Factory::getFSTThreads(SST::Params& params)
+{
+    if (params.find_string("FST").empty()) {
+        return 0;
+    }
+    vector<string>* FSTparams = parseparams(params.find_string("FST"));
+    int threads = 0;
+    if (FSTparams -> size() > 1) {
+        threads = strtol(FSTparams -> at(1).c_str(), NULL, 0);
+        if (threads < 0) {
+            schedout.fatal(CALL_INFO, 1, "Number of FST threads should be 0 or more");
+        }
+    }
+    delete FSTparams;
+    return threads;
+}
+
 vector<double>* Factory::getTimePerDistance(SST::Params& params)
 {
     vector<double>* ret = new vector<double>;
@@ -40,6 +40,7 @@ namespace SST {
                 Allocator* getAllocator(SST::Params& params, Machine* m, schedComponent* sc);
                 TaskMapper* getTaskMapper(SST::Params& params, Machine* mach);
                 int getFST(SST::Params& params);
+                int getFSTThreads(SST::Params& params);
                 std::vector<double>* getTimePerDistance(SST::Params& params);
             private:
                 std::vector<std::string>* parseparams(std::string inparam);
@@ -56,6 +57,7 @@ namespace SST {
                     PRIORITIZE = 3,
                     DELAYED = 4,
                     ELC = 5,
+                    CONSERVATIVE = 6,
                 };
                 enum MachineType{
                     SIMPLEMACH = 0,
@@ -122,13 +124,13 @@ namespace SST {
                 };
 
                 static const int numMachTableEntries = 4;
-                static const int numSchedTableEntries = 6;
+                static const int numSchedTableEntries = 7;
                 static const int numFSTTableEntries = 3;
                 static const int numAllocTableEntries = 18;
                 static const int numTaskMapTableEntries = 7;
                 
                 static const machTableEntry machTable[4];
-                static const schedTableEntry schedTable[6];
+                static const schedTableEntry schedTable[7];
                 static const FSTTableEntry FSTTable[3];
                 static const allocTableEntry allocTable[18];
                 static const taskMapTableEntry taskMapTable[7];
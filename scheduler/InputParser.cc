@@ -15,6 +15,9 @@
 #include <string>
 #include <typeinfo>
 
+#include <stdlib.h>
+#include <string.h>
+
 #include <boost/algorithm/string.hpp>
 #include <boost/tokenizer.hpp>        // for reading YumYum jobs
 #include <boost/filesystem.hpp>
@@ -33,6 +36,28 @@ using namespace std;
 using namespace SST;
 using namespace SST::Scheduler;
 
+//binary trace index: a header, then one record per non-blank trace line
+//in trace order
+static const char traceIndexMagic[8] = {'S', 'S', 'T', 'J', 'I', 'D', 'X', '1'};
+
+struct TraceIndexHeader {
+    char magic[8];
+    uint64_t traceSize;     //size & modification time of the indexed trace
+    uint64_t traceModTime;
+    uint64_t numRecords;
+    uint64_t sorted;        //1 if arrival times never decrease
+};
+
+struct TraceIndexRecord {
+    uint64_t offset;        //of the line in the trace
+    uint64_t arrival;
+};
+
+static bool isBlank(const string & line)
+{
+    return line.find_first_not_of(" \t\n") == string::npos;
+}
+
 JobParser::JobParser(Machine* machine,
           SST::Params& params,
           bool* useYumYumSimulationKill,
@@ -54,6 +79,14 @@ JobParser::JobParser(Machine* machine,
     //end->NetworkSim
 
     lastJobRead[ 0 ] = '\0';
+
+    startTime = 0;
+    if (!params.find_string("traceStartTime").empty()) {
+        startTime = strtoul(params.find_string("traceStartTime").c_str(), NULL, 0);
+    }
+    indexName = params.find_string("traceIndex");
+    firstRecord = 0;
+    numRecords = 0;
     
     char* inputDir = getenv("SIMINPUT");
     if (inputDir != NULL) {
@@ -100,6 +133,149 @@ std::vector<Job*> JobParser::parseJobs(SimTime_t currSimTime)
     return jobs;
 }
 
+Job* JobParser::nextJob()
+{
+    if (!trace.is_open()) {
+        openTrace();
+    }
+    string line;
+    while (getline(trace, line)) {
+        if (startTime > 0 && strtoul(line.c_str(), NULL, 10) < startTime) {
+            continue;
+        }
+        Job* j = parseJobLine(line);
+        if (NULL != j) {
+            return j;
+        }
+    }
+    return NULL;
+}
+
+long JobParser::countJobs()
+{
+    if (!trace.is_open()) {
+        openTrace();
+    }
+    if (!indexName.empty()) {
+        return numRecords - firstRecord;
+    }
+    ifstream input(openedTrace.c_str());
+    long count = 0;
+    string line;
+    while (getline(input, line)) {
+        if (!isBlank(line) && strtoul(line.c_str(), NULL, 10) >= startTime) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void JobParser::openTrace()
+{
+    openedTrace = fileName;
+    trace.open(openedTrace.c_str());
+    if (!trace.is_open()) {
+        openedTrace = jobTrace;  //try without directory
+        trace.open(openedTrace.c_str());
+    }
+    if (!trace.is_open()) {
+        schedout.fatal(CALL_INFO, 1, "Unable to open job trace file: %s\n", fileName.c_str());
+    }
+    if (indexName.empty()) {
+        return;
+    }
+
+    //seek to the first job that arrives at startTime or later
+    checkIndex();
+    ifstream index(indexName.c_str(), ios::binary);
+    TraceIndexHeader header;
+    TraceIndexRecord record;
+    index.read((char*) &header, sizeof(header));
+    if (startTime > 0 && !header.sorted) {
+        schedout.fatal(CALL_INFO, 1, "traceStartTime with an index needs a trace sorted by arrival time: %s\n", openedTrace.c_str());
+    }
+    long low = 0;
+    long high = numRecords;
+    while (low < high) {
+        long mid = low + (high - low) / 2;
+        index.seekg(sizeof(header) + mid * sizeof(record));
+        index.read((char*) &record, sizeof(record));
+        if (record.arrival < startTime) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    firstRecord = low;
+    if (firstRecord < numRecords) {
+        index.seekg(sizeof(header) + firstRecord * sizeof(record));
+        index.read((char*) &record, sizeof(record));
+        trace.seekg(record.offset);
+    } else {
+        trace.seekg(0, ios::end);
+    }
+}
+
+void JobParser::checkIndex()
+{
+    uint64_t traceSize = boost::filesystem::file_size(openedTrace);
+    uint64_t traceModTime = boost::filesystem::last_write_time(openedTrace);
+    ifstream index(indexName.c_str(), ios::binary);
+    TraceIndexHeader header;
+    if (index.is_open()
+        && index.read((char*) &header, sizeof(header))
+        && 0 == memcmp(header.magic, traceIndexMagic, sizeof(traceIndexMagic))
+        && header.traceSize == traceSize
+        && header.traceModTime == traceModTime) {
+        numRecords = header.numRecords;
+        return;
+    }
+    index.close();
+    buildIndex();
+}
+
+void JobParser::buildIndex()
+{
+    schedout.verbose(CALL_INFO, 1, 0, "Indexing job trace %s into %s\n", openedTrace.c_str(), indexName.c_str());
+    ifstream input(openedTrace.c_str());
+    ofstream index(indexName.c_str(), ios::binary | ios::trunc);
+    if (!index.is_open()) {
+        schedout.fatal(CALL_INFO, 1, "Unable to write job trace index: %s\n", indexName.c_str());
+    }
+
+    TraceIndexHeader header;
+    memcpy(header.magic, traceIndexMagic, sizeof(traceIndexMagic));
+    header.traceSize = boost::filesystem::file_size(openedTrace);
+    header.traceModTime = boost::filesystem::last_write_time(openedTrace);
+    header.numRecords = 0;
+    header.sorted = 1;
+    index.write((const char*) &header, sizeof(header));  //completed below
+
+    TraceIndexRecord record;
+    uint64_t offset = 0;
+    uint64_t lastArrival = 0;
+    string line;
+    while (getline(input, line)) {
+        if (!isBlank(line)) {
+            record.offset = offset;
+            record.arrival = strtoul(line.c_str(), NULL, 10);
+            if (record.arrival < lastArrival) {
+                header.sorted = 0;
+            }
+            lastArrival = record.arrival;
+            index.write((const char*) &record, sizeof(record));
+            header.numRecords++;
+        }
+        offset += line.size() + 1;
+    }
+    index.seekp(0);
+    index.write((const char*) &header, sizeof(header));
+    if (!index.good()) {
+        schedout.fatal(CALL_INFO, 1, "Unable to write job trace index: %s\n", indexName.c_str());
+    }
+    numRecords = header.numRecords;
+}
+
 //NetworkSim: parser for completedJobTrace
 std::map<int, unsigned long> JobParser::parseJobsEmberCompleted()
 {
@@ -281,27 +457,41 @@ bool JobParser::newYumYumJobLine(std::string line, SimTime_t currSimTime)
 
     strcpy( lastJobRead, ID );
 
+    Job* j = NULL;
     if (tokens.size() != 3) {
         schedout.fatal(CALL_INFO, 1, "Poorly formatted input line: %s\n", line.c_str());
     } else {
         if (useYumYumTraceFormat) {
-            jobs.push_back(new Job(currSimTime + 1, procs, duration, duration + 1, std::string(ID)));
+            j = new Job(currSimTime + 1, procs, duration, duration + 1, std::string(ID));
         } else {
-            jobs.push_back(new Job(currSimTime, procs, duration, duration, std::string(ID)));
+            j = new Job(currSimTime, procs, duration, duration, std::string(ID));
         }
     }
 
     // validate the job to make sure that the specified machine can actually run it. 
-    Job* j = jobs.back();
-
-    return validateJob(j, &jobs, abs((long)duration));
+    if (!validateJob(j, abs((long)duration))) {
+        delete j;
+        return false;
+    }
+    jobs.push_back(j);
+    return true;
 }
 
 
 bool JobParser::newJobLine(std::string line)
 {
-    if (line.find_first_not_of(" \t\n") == string::npos)
+    Job* j = parseJobLine(line);
+    if (NULL == j) {
         return false;
+    }
+    jobs.push_back(j);
+    return true;
+}
+
+Job* JobParser::parseJobLine(const std::string & line)
+{
+    if (isBlank(line))
+        return NULL;
 
     unsigned long arrivalTime = -1;
     int procsNeeded = -1;
@@ -373,27 +563,28 @@ bool JobParser::newJobLine(std::string line)
     //end->NetworkSim
 
     //add job
-    jobs.push_back(new Job(arrivalTime, procsNeeded, runningTime, estRunningTime, commInfo, phaseInfo)); //NetworkSim: added phase info
+    Job* j = new Job(arrivalTime, procsNeeded, runningTime, estRunningTime, commInfo, phaseInfo); //NetworkSim: added phase info
 
     //validate
-    return validateJob(jobs.back() , &jobs, runningTime);
+    if (!validateJob(j, runningTime)) {
+        delete j;
+        return NULL;
+    }
+    return j;
 }
 
-bool JobParser::validateJob( Job* j, vector<Job*>* jobs, long runningTime )
+//the caller deletes jobs that are not valid
+bool JobParser::validateJob( Job* j, long runningTime )
 {
     bool ok = true;
     if (j->getProcsNeeded() <= 0) {
         schedout.verbose(CALL_INFO, 0, 0, "Warning: Job %ld  requests %d processors; ignoring it\n",
                          j->getJobNum(), j->getProcsNeeded());
-        delete jobs->back();
-        jobs->pop_back();
         ok = false;
     }
     if (ok && runningTime < 0) {  //time 0 also strange, but perhaps rounded down     
         schedout.verbose(CALL_INFO, 0, 0, "Warning: Job %ld  has running time of %ld; ignoring it\n",
                          j->getJobNum(), runningTime);
-        delete jobs->back();
-        jobs->pop_back();
         ok = false;
     }
     if (ok && j->getProcsNeeded() > (machine->numNodes * machine->coresPerNode)) {
@@ -12,6 +12,8 @@
 #ifndef SST_SCHEDULER_INPUTPARSER_H__
 #define SST_SCHEDULER_INPUTPARSER_H__
 
+#include <fstream>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -40,7 +42,17 @@ namespace SST {
                           bool* doDetailedNetworkSim); //NetworkSim: added bool parameter 
                 ~JobParser() { };
                         
+                //reads the whole trace at once
                 std::vector<Job*> parseJobs(SimTime_t currSimTime);
+
+                //streams the trace (not the YumYum format) one job at a time,
+                //starting with the first job that arrives at traceStartTime or later
+                //@return NULL after the last job
+                Job* nextJob();
+                //number of trace lines nextJob() makes jobs from, which bounds their job numbers;
+                //scans the trace unless it is indexed
+                long countJobs();
+
                 //NetworkSim: parse the files for jobs completed/running on ember
                 std::map<int, unsigned long> parseJobsEmberCompleted();
                 std::map<int, std::pair<unsigned long, int> > parseJobsEmberRunning();
@@ -61,9 +73,24 @@ namespace SST {
                 
                 time_t LastJobFileModTime;            // Contains the last time that the job file was modified
                 char lastJobRead[ JobIDlength ];      // The ID of the last job read from the Job list file
+
+                //streaming
+                std::ifstream trace;
+                std::string openedTrace;      //fileName or jobTrace, whichever could be opened
+                unsigned long startTime;      //jobs arriving earlier are skipped
+                std::string indexName;        //binary index of the trace, empty if not used
+                long firstRecord;             //index record of the first job nextJob() returns
+                long numRecords;              //index records in all
+
+                void openTrace();
+                //makes sure indexName indexes openedTrace, building it if not
+                void checkIndex();
+                void buildIndex();
                 
                 bool newJobLine(std::string line);
-                bool validateJob( Job * j, std::vector<Job*> * jobs, long runningTime );
+                //@return the job on the line; NULL if the line is blank or the job invalid
+                Job* parseJobLine(const std::string & line);
+                bool validateJob( Job * j, long runningTime );
                 
                 //yumyum
                 bool useYumYumTraceFormat;
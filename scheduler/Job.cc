@@ -16,6 +16,7 @@
 #include <string>
 
 #include <iostream> //debug
+#include <mutex>
 
 #include "output.h"
 #include "TaskCommInfo.h"
@@ -27,7 +28,10 @@ static long nextJobNum = 0;  //used setting jobNum
 //NetworkSim: added PhaseInfo
 Job::Job(unsigned long arrivalTime, int procsNeeded, unsigned long actualRunningTime, unsigned long estRunningTime, CommInfo inComm, PhaseInfo inPhase) : commInfo(inComm), phaseInfo(inPhase)
 {
-    schedout.init("", 8, 0, Output::STDOUT);
+    //jobs are read in while FST's evaluation thread uses copies of them,
+    //so schedout is only set up by the first one
+    static std::once_flag outputInit;
+    std::call_once(outputInit, [] { schedout.init("", 8, 0, Output::STDOUT); });
     initialize(arrivalTime, procsNeeded, actualRunningTime, estRunningTime);
 }
 
@@ -26,6 +26,10 @@ Machine::Machine(int inNumNodes,
                    coresPerNode(numCoresPerNode)
 {
     this->D_matrix = D_matrix;
+    distances = NULL;
+    if(numNodes <= maxCachedNodes){
+        distances = new std::atomic<unsigned char*>[numNodes]();
+    }
     freeNodes = std::vector<bool>(numNodes);
     traffic = std::vector<double>(numLinks);
     reset();
@@ -33,6 +37,12 @@ Machine::Machine(int inNumNodes,
 
 Machine::~Machine()
 {
+    if(distances != NULL){
+        for(int i = 0; i < numNodes; i++){
+            delete[] distances[i].load();
+        }
+        delete[] distances;
+    }
     if(D_matrix != NULL){
         for (int i = 0; i < numNodes; i++)
             delete[] D_matrix[i];
@@ -65,7 +75,11 @@ void Machine::allocate(TaskMapInfo* taskMapInfo)
         freeNodes[allocInfo -> nodeIndices[i]] = false;
     }
 
-    //update network traffic
+    //update network traffic; FST's copies of jobs are placed before their
+    //communication files are read, and its machines don't track traffic
+    if (NULL == allocInfo -> job -> taskCommInfo) {
+        return;
+    }
     std::map<unsigned int, double> jobTraffic = taskMapInfo->getTraffic();
     for(std::map<unsigned int, double>::iterator it = jobTraffic.begin(); it != jobTraffic.end(); it++){
         traffic[it->first] += it->second;
@@ -91,6 +105,9 @@ void Machine::deallocate(TaskMapInfo* taskMapInfo)
     }
 
     //update network traffic
+    if (NULL == allocInfo -> job -> taskCommInfo) {
+        return;
+    }
     std::map<unsigned int, double> jobTraffic = taskMapInfo->getTraffic();
     for(std::map<unsigned int, double>::iterator it = jobTraffic.begin(); it != jobTraffic.end(); it++){
         traffic[it->first] -= it->second;
@@ -100,6 +117,80 @@ void Machine::deallocate(TaskMapInfo* taskMapInfo)
     }
 }
 
+int Machine::getNodeDistance(int node0, int node1) const
+{
+    if(distances == NULL){
+        return computeNodeDistance(node0, node1);
+    }
+    const unsigned char* row = distances[node0].load(std::memory_order_acquire);
+    if(row == NULL){
+        row = distanceRow(node0);
+    }
+    if(row[node1] == uncachedDistance){
+        return computeNodeDistance(node0, node1);
+    }
+    return row[node1];
+}
+
+//computes & publishes the distance row of node0. Threads that race on
+//the same row each compute it; the first one to finish is kept
+const unsigned char* Machine::distanceRow(int node0) const
+{
+    unsigned char* row = new unsigned char[numNodes];
+    for(int node = 0; node < numNodes; node++){
+        int distance = computeNodeDistance(node0, node);
+        row[node] = (distance < uncachedDistance) ? distance : (int) uncachedDistance;
+    }
+    unsigned char* expected = NULL;
+    if(!distances[node0].compare_exchange_strong(expected, row, std::memory_order_acq_rel)){
+        delete[] row;
+        return expected;
+    }
+    return row;
+}
+
+std::list<int>* Machine::getFreeAtDistance(int center, int distance) const
+{
+    std::list<int>* nodeList = new std::list<int>();
+    const std::vector<int> & shell = getShell(center, distance);
+    for(unsigned int i = 0; i < shell.size(); i++){
+        if(freeNodes[shell[i]]){
+            nodeList->push_back(shell[i]);
+        }
+    }
+    return nodeList;
+}
+
+const std::vector<int> & Machine::getShell(int center, int distance) const
+{
+    static const std::vector<int> empty;
+    if(distance < 1){
+        return empty;
+    }
+    std::lock_guard<std::mutex> guard(shellLock);
+    if(shells.empty()){
+        shells.resize(numNodes);
+    }
+    //shells are filled in order, so an empty one is never recomputed
+    std::deque<std::vector<int> > & centerShells = shells[center];
+    if(centerShells.empty()){
+        centerShells.resize(1);
+    }
+    while((int) centerShells.size() <= distance){
+        centerShells.push_back(std::vector<int>());
+        appendAtDistance(center, centerShells.size() - 1, centerShells.back());
+        std::vector<int>(centerShells.back()).swap(centerShells.back());  //trim
+    }
+    return centerShells[distance];
+}
+
+std::vector<int>* Machine::getRoute(int node0, int node1, double commWeight) const
+{
+    std::vector<int>* links = new std::vector<int>();
+    appendRoute(node0, node1, commWeight, *links);
+    return links;
+}
+
 std::vector<int>* Machine::getFreeNodes() const
 {
     std::vector<int>* freeList = new std::vector<int>(numAvail);
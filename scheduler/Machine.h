@@ -16,7 +16,10 @@
 #ifndef SST_SCHEDULER_MACHINE_H__
 #define SST_SCHEDULER_MACHINE_H__
 
+#include <atomic>
+#include <deque>
 #include <list>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -48,24 +51,48 @@ namespace SST {
                 virtual AllocInfo* getBaselineAllocation(Job* job) const = 0;
 
                 //returns the network distance between two nodes
-                virtual int getNodeDistance(int node0, int node1) const = 0;
+                //distances are computed once per source node & kept. Safe to call from several threads
+                int getNodeDistance(int node0, int node1) const;
                 
                 //max number of nodes at a given distance - NearestAllocMapper uses this
                 virtual int nodesAtDistance(int dist) const = 0;
                 
                 //returns the free nodes at given network distance
-                virtual std::list<int>* getFreeAtDistance(int center, int distance) const = 0;
+                std::list<int>* getFreeAtDistance(int center, int distance) const;
+
+                //returns all nodes at given network distance, free or not, in the order
+                //getFreeAtDistance() lists them. Computed once per center & distance; the
+                //reference stays valid as long as the machine. Safe to call from several threads
+                const std::vector<int> & getShell(int center, int distance) const;
 
                 //finds the communication route between node0 and node1 for the given weight of commWeight
                 //@return The link indices used in the route
-                virtual std::vector<int>* getRoute(int node0, int node1, double commWeight) const = 0;
+                std::vector<int>* getRoute(int node0, int node1, double commWeight) const;
+                //same as getRoute() but appends the links to the given vector
+                virtual void appendRoute(int node0, int node1, double commWeight, std::vector<int> & links) const = 0;
                 
                 double** D_matrix;
                 
                 const int numNodes;          //total number of nodes
                 const int coresPerNode;
 
+            protected:
+                //uncached versions of getNodeDistance() & getShell()
+                virtual int computeNodeDistance(int node0, int node1) const = 0;
+                virtual void appendAtDistance(int center, int distance, std::vector<int> & nodes) const = 0;
+
             private:
+                static const int maxCachedNodes = 16384;  //larger machines do not cache distances
+                static const unsigned char uncachedDistance = 255;
+
+                const unsigned char* distanceRow(int node0) const;
+
+                //caches are filled on first use. A distance row is published once it is
+                //complete, so readers need no lock; shells are locked
+                std::atomic<unsigned char*>* distances;  //[source][target], NULL if uncached
+                mutable std::vector<std::deque<std::vector<int> > > shells;  //[center][distance]
+                mutable std::mutex shellLock;
+
                 int numAvail;                //number of available nodes
                 std::vector<bool> freeNodes;  //whether each node is free
                 std::vector<double> traffic;  //traffic on network links
@@ -44,23 +44,24 @@ std::string Mesh3DMachine::getSetupInfo(bool comment)
     return ret.str();
 }
 
-int Mesh3DMachine::getNodeDistance(int node1, int node2) const
+int Mesh3DMachine::computeNodeDistance(int node1, int node2) const
 {
-    MeshLocation loc1 = MeshLocation(node1, *this);
-    MeshLocation loc2 = MeshLocation(node2, *this);
-    return loc1.L1DistanceTo(loc2);
+    int totalDist = 0;
+    for(unsigned int i = 0; i < dims.size(); i++){
+        totalDist += abs(coordOf(node1, i) - coordOf(node2, i));
+    }
+    return totalDist;
 }
 
-std::list<int>* Mesh3DMachine::getFreeAtDistance(int center, int dist) const
+void Mesh3DMachine::appendAtDistance(int center, int dist, std::vector<int> & nodes) const
 {
     int centerX = coordOf(center,0);
     int centerY = coordOf(center,1);
     int centerZ = coordOf(center,2);
-    std::list<int>* nodeList = new std::list<int>();
     std::vector<int> curDims(3);
     //optimization:
     if(dist < 1 || dist > dims[0] + dims[1] + dims[2]){
-        return nodeList;
+        return;
     }
 
     for(curDims[0] = std::max(centerX - dist, 0); curDims[0] <= std::min(centerX + dist, dims[0] - 1); curDims[0]++){
@@ -68,14 +69,13 @@ std::list<int>* Mesh3DMachine::getFreeAtDistance(int center, int dist) const
         for(curDims[1] = std::max(centerY - yRange, 0); curDims[1] <= std::min(centerY + yRange, dims[1] - 1); curDims[1]++){
             int zRange = yRange - abs(centerY - curDims[1]);
             curDims[2] = centerZ - zRange;
-            appendIfFree(curDims, nodeList);
+            appendIfInside(curDims, nodes);
             if(zRange != 0){
                 curDims[2] = centerZ + zRange;
-                appendIfFree(curDims, nodeList);
+                appendIfInside(curDims, nodes);
             }
         }
     }
-    return nodeList;
 }
 
 std::list<int>* Mesh3DMachine::getFreeAtLInfDistance(int center, int dist) const
@@ -294,6 +294,13 @@ int Mesh3DMachine::nodesAtDistance(int dist) const
         return 4 * pow(dist, 2) + 2;
 }
 
+void Mesh3DMachine::appendIfInside(const std::vector<int> & curDims, std::vector<int> & nodes) const
+{
+    if(curDims[0] >= 0 && curDims[0] < dims[0] && curDims[1] >= 0 && curDims[1] < dims[1] && curDims[2] >= 0 && curDims[2] < dims[2]){
+        nodes.push_back(indexOf(curDims));
+    }
+}
+
 void Mesh3DMachine::appendIfFree(std::vector<int> curDims, std::list<int>* nodeList) const
 {
     if(curDims[0] >= 0 && curDims[0] < dims[0] && curDims[1] >= 0 && curDims[1] < dims[1] && curDims[2] >= 0 && curDims[2] < dims[2]){
@@ -304,11 +311,13 @@ void Mesh3DMachine::appendIfFree(std::vector<int> curDims, std::list<int>* nodeL
     }
 }
 
-int Mesh3DMachine::getLinkIndex(std::vector<int> nodeDims, int dimension) const
+int Mesh3DMachine::getLinkIndex(const std::vector<int> & nodeDims, int dimension) const
+{
+    return linkIndex(nodeDims[0], nodeDims[1], nodeDims[2], dimension);
+}
+
+int Mesh3DMachine::linkIndex(int x, int y, int z, int dimension) const
 {
-    int x = nodeDims[0];
-    int y = nodeDims[1];
-    int z = nodeDims[2];
     int linkNo;
     //link order: first all links in x dimension (same ordering with nodes), then y, then z
     switch(dimension){
@@ -341,9 +350,8 @@ int Mesh3DMachine::getLinkIndex(std::vector<int> nodeDims, int dimension) const
     return linkNo;
 }
 
-std::vector<int>* Mesh3DMachine::getRoute(int node0, int node1, double commWeight) const
+void Mesh3DMachine::appendRoute(int node0, int node1, double commWeight, std::vector<int> & links) const
 {
-    std::vector<int>* links = new std::vector<int>();
     int x0 = coordOf(node0,0);
     int x1 = coordOf(node1,0);
     int y0 = coordOf(node0,1);
@@ -351,26 +359,15 @@ std::vector<int>* Mesh3DMachine::getRoute(int node0, int node1, double commWeigh
     int z0 = coordOf(node0,2);
     int z1 = coordOf(node1,2);
     //add X route
-    std::vector<int> loc(3);
     for(int x = std::min(x0, x1); x < std::max(x0, x1); x++){
-        loc[0] = x;
-        loc[1] = y0;
-        loc[2] = z0;
-        links->push_back(getLinkIndex(loc, 0));
+        links.push_back(linkIndex(x, y0, z0, 0));
     }
     //add Y route
     for(int y = std::min(y0, y1); y < std::max(y0, y1); y++){
-        loc[0] = x1;
-        loc[1] = y;
-        loc[2] = z0;
-        links->push_back(getLinkIndex(loc, 1));
+        links.push_back(linkIndex(x1, y, z0, 1));
     }
     //add Z route
     for(int z = std::min(z0, z1); z < std::max(z0, z1); z++){
-        loc[0] = x1;
-        loc[1] = y1;
-        loc[2] = z;
-        links->push_back(getLinkIndex(loc, 2));
+        links.push_back(linkIndex(x1, y1, z, 2));
     }
-    return links;
 }
@@ -63,6 +63,15 @@ namespace SST {
 
                 //used for FST, returns an exact copy of the current schedule
                 virtual Scheduler* copy(std::vector<Job*>* running, std::vector<Job*>* toRun) = 0;
+
+                //used for FST; true if jobs are considered strictly in order
+                //of arrival, so a job that cannot start does not change when
+                //the jobs that arrived before it start
+                virtual bool arrivalOrdered() const { return false; }
+
+                //used for FST; false if a job only starts once every job
+                //ahead of it has
+                virtual bool backfills() const { return true; }
             
             protected:
                 Job* nextToStart; //next ready job - used to give feedback to schedComponent
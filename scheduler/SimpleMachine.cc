@@ -12,6 +12,7 @@
 #include "sst_config.h"
 #include "SimpleMachine.h"
 
+#include <mutex>
 #include <string>
 #include <stdio.h>
 
@@ -23,7 +24,10 @@ using namespace SST::Scheduler;
 SimpleMachine::SimpleMachine(int numNodes, bool insimulationmachine, int numCoresPerNode, double** D_matrix)
                              : Machine(numNodes, numCoresPerNode, D_matrix, 1) 
 {  
-    schedout.init("", 8, ~0, Output::STDOUT);
+    //FST builds simple machines on its evaluation thread; set schedout up
+    //once rather than under a machine that is in use
+    static std::once_flag outputInit;
+    std::call_once(outputInit, [] { schedout.init("", 8, ~0, Output::STDOUT); });
     simulationmachine = insimulationmachine;
 }
 
@@ -40,14 +44,18 @@ std::string SimpleMachine::getSetupInfo(bool comment)
     return com + mesg;
 }
 
-std::list<int>* SimpleMachine::getFreeAtDistance(int center, int distance) const
+void SimpleMachine::appendAtDistance(int center, int distance, std::vector<int> & nodes) const
 {
-    std::list<int>* retList = new std::list<int>();
-    retList->push_back(0);
-    return retList;
+    if(distance == 1){
+        for(int node = 0; node < numNodes; node++){
+            if(node != center){
+                nodes.push_back(node);
+            }
+        }
+    }
 }
 
-int SimpleMachine::getNodeDistance(int node1, int node2) const
+int SimpleMachine::computeNodeDistance(int node1, int node2) const
 {
     return 1;
 }
@@ -57,7 +65,7 @@ int SimpleMachine::nodesAtDistance(int dist) const
     return numNodes;
 }
 
-std::vector<int>* SimpleMachine::getRoute(int node1, int node2, double commWeight) const
+void SimpleMachine::appendRoute(int node1, int node2, double commWeight, std::vector<int> & links) const
 {
-    return new std::vector<int>(1, 0);
+    links.push_back(0);
 }
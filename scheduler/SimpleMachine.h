@@ -38,15 +38,15 @@ namespace SST {
                 
                 AllocInfo* getBaselineAllocation(Job* job) const { return NULL; }
                 
-                int getNodeDistance(int node0, int node1) const;
-                
                 int nodesAtDistance(int dist) const;
-                
-                //returns the free nodes at given L1 distance
-                std::list<int>* getFreeAtDistance(int center, int distance) const;
 
                 //SimpleMachine assumes a single network link in the machine
-                std::vector<int>* getRoute(int node0, int node1, double commWeight) const;
+                void appendRoute(int node0, int node1, double commWeight, std::vector<int> & links) const;
+
+            protected:
+                //all nodes are at distance 1
+                int computeNodeDistance(int node0, int node1) const;
+                void appendAtDistance(int center, int distance, std::vector<int> & nodes) const;
 
             private:
                 bool simulationmachine;
@@ -12,6 +12,7 @@
 #include "Statistics.h"
 
 #include <fstream>
+#include <mutex>
 #include <stdio.h>
 #include <string>
 #include <time.h>
@@ -83,7 +84,9 @@ Statistics::Statistics(Machine* machine, Scheduler* sched, Allocator* alloc, Tas
 {
     this -> simulation = simulation;
     this -> calcFST = incalcFST;
-    schedout.init("", 8, ~0, Output::STDOUT);
+    //set up once, like the other objects FST may build off the main thread
+    static std::once_flag outputInit;
+    std::call_once(outputInit, [] { schedout.init("", 8, ~0, Output::STDOUT); });
     size_t pos = baseName.rfind("/");
     if (pos == string::npos) {
         this -> baseName = baseName;  //didn't find it so entire given string is base
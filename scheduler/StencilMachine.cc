@@ -24,6 +24,11 @@ StencilMachine::StencilMachine(std::vector<int> inDims, int numLinks, int numCor
                          : Machine(constHelper(inDims), numCoresPerNode, D_matrix, numLinks),
                            dims(inDims)
 {
+    int stride = 1;
+    for(unsigned int i = 0; i < dims.size(); i++){
+        strides.push_back(stride);
+        stride *= dims[i];
+    }
 }
 
 std::string StencilMachine::getParamHelp()
@@ -42,14 +47,16 @@ int StencilMachine::constHelper(std::vector<int> dims)
 
 int StencilMachine::coordOf(int node, int dim) const
 {
-    MeshLocation loc(node, *this);
-    return loc.dims[dim];
+    return (node / strides[dim]) % dims[dim];
 }
 
-int StencilMachine::indexOf(std::vector<int> dims) const
+int StencilMachine::indexOf(const std::vector<int> & inDims) const
 {
-    MeshLocation loc(dims);
-    return loc.toInt(*this);
+    int nodeID = 0;
+    for(unsigned int i = 0; i < inDims.size(); i++){
+        nodeID += inDims[i] * strides[i];
+    }
+    return nodeID;
 }
 
 AllocInfo* StencilMachine::getBaselineAllocation(Job* job) const
@@ -35,6 +35,8 @@ namespace SST {
 
                 static int constHelper(std::vector<int> dims); //calculates total number of nodes
 
+                std::vector<int> strides;      //node index step of each dimension
+
                 //helper for getFreeAt... functions
                 virtual void appendIfFree(std::vector<int> dims, std::list<int>* nodeList) const = 0;
 
@@ -58,7 +60,7 @@ namespace SST {
                 int coordOf(int node, int dim) const;
 
                 //returns index of given dimensions
-                int indexOf(std::vector<int> dims) const;
+                int indexOf(const std::vector<int> & dims) const;
 
                 //returns baseline allocation used for running time estimation
                 //baseline allocation: dimension-ordered allocation in minimum-volume
@@ -67,24 +69,18 @@ namespace SST {
 
                 virtual std::string getSetupInfo(bool comment) = 0;
 
-                //returns the network distance of the given nodes
-                virtual int getNodeDistance(int node0, int node1) const = 0;
-
                 //max number of nodes at a given distance - NearestAllocMapper uses this
                 int nodesAtDistance(int dist) const = 0;
 
-                //returns the free nodes at given distance
-                virtual std::list<int>* getFreeAtDistance(int center, int distance) const = 0;
                 //returns the free nodes at given LInf distance, sorted by L1 distance
                 virtual std::list<int>* getFreeAtLInfDistance(int center, int distance) const = 0;
 
                 //returns the index of the given network link
                 //@dim link dimension from the source node
-                virtual int getLinkIndex(std::vector<int> dims, int dim) const = 0;
+                virtual int getLinkIndex(const std::vector<int> & dims, int dim) const = 0;
 
                 //default routing is dimension ordered: first x, then y, ...
-                //@return vector of link indices
-                virtual std::vector<int>* getRoute(int node0, int node1, double commWeight) const = 0;
+                virtual void appendRoute(int node0, int node1, double commWeight, std::vector<int> & links) const = 0;
         };
 
         /**
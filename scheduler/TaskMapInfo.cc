@@ -139,22 +139,23 @@ void TaskMapInfo::updateNetworkMetrics()
 
     //create traffic
     //iterate through all nodes
+    std::vector<int> route;
     for(unsigned int nodeIter = 0; nodeIter < nodeCommInfo.size(); nodeIter++){
         //iterate through its neighbors in the nodeCommInfo
         for(std::map<unsigned int, double>::iterator it = nodeCommInfo[nodeIter].begin(); it != nodeCommInfo[nodeIter].end(); it++){
             //add communication to the traffic
             if(nodeIter < it->first){ //avoid duplicates
                 //get used links
-                std::vector<int>* route = machine.getRoute(nodeIter, it->first, it->second);
+                route.clear();
+                machine.appendRoute(nodeIter, it->first, it->second, route);
                 //iterate through the links to populate traffic
-                for(unsigned int linkIt = 0; linkIt < route->size(); linkIt++){
-                    if(traffic.count(route->at(linkIt)) == 0){ // no existing communication there
-                        traffic[route->at(linkIt)] = it->second;
+                for(unsigned int linkIt = 0; linkIt < route.size(); linkIt++){
+                    if(traffic.count(route[linkIt]) == 0){ // no existing communication there
+                        traffic[route[linkIt]] = it->second;
                     } else { //add to existing communication
-                        traffic[route->at(linkIt)] += it->second;
+                        traffic[route[linkIt]] += it->second;
                     }
                 }
-                delete route;
             }
         }
     }
@@ -41,7 +41,7 @@ std::string Torus3DMachine::getSetupInfo(bool comment)
     return ret.str();
 }
 
-int Torus3DMachine::getNodeDistance(int node1, int node2) const
+int Torus3DMachine::computeNodeDistance(int node1, int node2) const
 {
     int totalDist = 0;
     for(unsigned int i = 0; i < dims.size(); i++){
@@ -51,12 +51,11 @@ int Torus3DMachine::getNodeDistance(int node1, int node2) const
     return totalDist;
 }
 
-std::list<int>* Torus3DMachine::getFreeAtDistance(int center, int dist) const
+void Torus3DMachine::appendAtDistance(int center, int dist, std::vector<int> & nodes) const
 {
-    std::list<int>* nodeList = new std::list<int>();
     //optimization:
     if(dist < 1 || dist > dims[0] + dims[1] + dims[2]){
-        return nodeList;
+        return;
     }
 
     std::vector<int> centerDims(3);
@@ -85,15 +84,14 @@ std::list<int>* Torus3DMachine::getFreeAtDistance(int center, int dist) const
             int zDist = yRange - abs(yDist);
             if(zDist <= zMinDelta){
                 curDims[2] = mod(centerDims[2] - zDist, dims[2]);
-                appendIfFree(curDims, nodeList);
+                appendIfInside(curDims, nodes);
             }
             if(zDist != 0 && zDist <= zMaxDelta){
                 curDims[2] = mod(centerDims[2] + zDist, dims[2]);
-                appendIfFree(curDims, nodeList);
+                appendIfInside(curDims, nodes);
             }
         }
     }
-    return nodeList;
 }
 
 std::list<int>* Torus3DMachine::getFreeAtLInfDistance(int center, int dist) const
@@ -443,6 +441,15 @@ int Torus3DMachine::nodesAtDistance(int dist) const
         return 4 * pow(dist, 2) + 2;
 }
 
+void Torus3DMachine::appendIfInside(const std::vector<int> & curDims, std::vector<int> & nodes) const
+{
+    if(curDims[0] >= 0 && curDims[0] < dims[0] &&
+       curDims[1] >= 0 && curDims[1] < dims[1] &&
+       curDims[2] >= 0 && curDims[2] < dims[2]){
+        nodes.push_back(indexOf(curDims));
+    }
+}
+
 void Torus3DMachine::appendIfFree(std::vector<int> curDims, std::list<int>* nodeList) const
 {
     if(curDims[0] >= 0 && curDims[0] < dims[0] &&
@@ -455,11 +462,13 @@ void Torus3DMachine::appendIfFree(std::vector<int> curDims, std::list<int>* node
     }
 }
 
-int Torus3DMachine::getLinkIndex(std::vector<int> nodeDims, int dimension) const
+int Torus3DMachine::getLinkIndex(const std::vector<int> & nodeDims, int dimension) const
+{
+    return linkIndex(nodeDims[0], nodeDims[1], nodeDims[2], dimension);
+}
+
+int Torus3DMachine::linkIndex(int x, int y, int z, int dimension) const
 {
-    int x = nodeDims[0];
-    int y = nodeDims[1];
-    int z = nodeDims[2];
     int linkNo;
     //link order: first all links in x dimension (same ordering with nodes), then y, then z
     switch(dimension){
@@ -492,9 +501,8 @@ int Torus3DMachine::getLinkIndex(std::vector<int> nodeDims, int dimension) const
     return linkNo;
 }
 
-std::vector<int>* Torus3DMachine::getRoute(int node0, int node1, double commWeight) const
+void Torus3DMachine::appendRoute(int node0, int node1, double commWeight, std::vector<int> & links) const
 {
-    std::vector<int>* links = new std::vector<int>();
     int x0 = coordOf(node0,0);
     int x1 = coordOf(node1,0);
     int y0 = coordOf(node0,1);
@@ -502,26 +510,15 @@ std::vector<int>* Torus3DMachine::getRoute(int node0, int node1, double commWeig
     int z0 = coordOf(node0,2);
     int z1 = coordOf(node1,2);
     //add X route
-    std::vector<int> loc(3);
     for(int x = std::min(x0, x1); x < std::max(x0, x1); x++){
-        loc[0] = x;
-        loc[1] = y0;
-        loc[2] = z0;
-        links->push_back(getLinkIndex(loc, 0));
+        links.push_back(linkIndex(x, y0, z0, 0));
     }
     //add Y route
     for(int y = std::min(y0, y1); y < std::max(y0, y1); y++){
-        loc[0] = x1;
-        loc[1] = y;
-        loc[2] = z0;
-        links->push_back(getLinkIndex(loc, 1));
+        links.push_back(linkIndex(x1, y, z0, 1));
     }
     //add Z route
     for(int z = std::min(z0, z1); z < std::max(z0, z1); z++){
-        loc[0] = x1;
-        loc[1] = y1;
-        loc[2] = z;
-        links->push_back(getLinkIndex(loc, 2));
+        links.push_back(linkIndex(x1, y1, z, 2));
     }
-    return links;
 }
@@ -31,6 +31,10 @@ namespace SST {
 
                 //helper for getFreeAt... functions
                 void appendIfFree(std::vector<int> dims, std::list<int>* nodeList) const;
+                //helper for appendAtDistance
+                void appendIfInside(const std::vector<int> & dims, std::vector<int> & nodes) const;
+                //getLinkIndex without the coordinate vector
+                int linkIndex(int x, int y, int z, int dimension) const;
 
             public:
                 Torus3DMachine(std::vector<int> dims, int numCoresPerNode, double** D_matrix = NULL);
@@ -38,11 +42,6 @@ namespace SST {
 
                 std::string getSetupInfo(bool comment);
 
-                //returns the network distance of the given nodes
-                int getNodeDistance(int node0, int node1) const;
-
-                //returns the free nodes at given Distance
-                std::list<int>* getFreeAtDistance(int center, int distance) const;
                 //LInf distance list is sorted based on L1 distance
                 std::list<int>* getFreeAtLInfDistance(int center, int distance) const;
 
@@ -51,11 +50,10 @@ namespace SST {
                 //returns the index of the given network link
                 //@nodeDims the dimensions of the source node
                 //@dimension link dimension from the source node(x=0,y=1,...)
-                int getLinkIndex(std::vector<int> nodeDims, int dimension) const;
+                int getLinkIndex(const std::vector<int> & nodeDims, int dimension) const;
 
                 //MeshMachine default routing is dimension ordered: first x, then y, then z, all in increasing direction
-                //@return vector of link indices
-                std::vector<int>* getRoute(int node0, int node1, double commWeight) const;
+                void appendRoute(int node0, int node1, double commWeight, std::vector<int> & links) const;
 
                 //custom mod implementation to avoid negatives
                 int mod(const int a, const int b) const
@@ -65,6 +63,13 @@ namespace SST {
                         ret += b;
                     return ret;
                 }
+
+            protected:
+                //returns the network distance of the given nodes
+                int computeNodeDistance(int node0, int node1) const;
+
+                //appends all nodes at given Distance
+                void appendAtDistance(int center, int distance, std::vector<int> & nodes) const;
         };
     }
 }
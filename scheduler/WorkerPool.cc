@@ -0,0 +1,111 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "WorkerPool.h"
+
+using namespace SST::Scheduler;
+
+WorkerPool::WorkerPool(unsigned int numThreads)
+{
+    if (0 == numThreads) {
+        numThreads = std::thread::hardware_concurrency();
+        if (0 == numThreads) {
+            numThreads = 1;
+        }
+    }
+    this -> numThreads = numThreads;
+    stopping = false;
+    current = NULL;
+    count = 0;
+    chunk = 0;
+    numParts = 0;
+    nextPart = 0;
+    partsDone = 0;
+    generation = 0;
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        stopping = true;
+    }
+    workReady.notify_all();
+    for (unsigned int x = 0; x < workers.size(); x++) {
+        workers[x].join();
+    }
+}
+
+void WorkerPool::run(unsigned long count, const RangeFunction & fn)
+{
+    if (0 == count) {
+        return;
+    }
+    if (1 == numThreads || 1 == count) {
+        fn(0, 0, count);
+        return;
+    }
+    //the calling thread is one of the pool's threads
+    while (workers.size() < numThreads - 1) {
+        workers.push_back(std::thread(&WorkerPool::workerLoop, this));
+    }
+
+    std::unique_lock<std::mutex> guard(lock);
+    unsigned long parts = (count < numThreads) ? count : numThreads;
+    current = &fn;
+    this -> count = count;
+    chunk = (count + parts - 1) / parts;
+    numParts = (count + chunk - 1) / chunk;
+    nextPart = 0;
+    partsDone = 0;
+    generation++;
+    workReady.notify_all();
+
+    runParts(guard);
+    while (partsDone < numParts) {
+        workDone.wait(guard);
+    }
+    current = NULL;
+}
+
+void WorkerPool::runParts(std::unique_lock<std::mutex> & guard)
+{
+    while (NULL != current && nextPart < numParts) {
+        const RangeFunction & fn = *current;
+        unsigned int part = nextPart++;
+        unsigned long first = part * chunk;
+        unsigned long last = (first + chunk < count) ? first + chunk : count;
+        guard.unlock();
+        fn(part, first, last);
+        guard.lock();
+        partsDone++;
+        if (partsDone == numParts) {
+            workDone.notify_all();
+        }
+    }
+}
+
+void WorkerPool::workerLoop()
+{
+    std::unique_lock<std::mutex> guard(lock);
+    unsigned long seen = 0;
+    while (true) {
+        while (!stopping && seen == generation) {
+            workReady.wait(guard);
+        }
+        if (stopping) {
+            return;
+        }
+        seen = generation;
+        runParts(guard);
+    }
+}
@@ -0,0 +1,72 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * Runs a function over an index range split into contiguous parts, one
+ * per thread. The threads are started on the first parallel run and are
+ * kept until the pool is deleted; the calling thread works on a part too
+ */
+
+#ifndef SST_SCHEDULER_WORKERPOOL_H__
+#define SST_SCHEDULER_WORKERPOOL_H__
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SST {
+    namespace Scheduler {
+
+        class WorkerPool {
+            public:
+                //fn(part, first, last) handles indices [first, last); parts that
+                //run at the same time have different part numbers below size()
+                typedef std::function<void(unsigned int, unsigned long, unsigned long)> RangeFunction;
+
+                //numThreads = 0 uses one thread per hardware thread
+                WorkerPool(unsigned int numThreads = 0);
+                ~WorkerPool();
+
+                unsigned int size() const { return numThreads; }
+
+                //splits [0, count) into at most size() parts in increasing index
+                //order and returns when fn has run on all of them.
+                //Only one thread may call run() at a time
+                void run(unsigned long count, const RangeFunction & fn);
+
+            private:
+                unsigned int numThreads;
+                std::vector<std::thread> workers;
+                std::mutex lock;
+                std::condition_variable workReady;
+                std::condition_variable workDone;
+                bool stopping;
+
+                //the run in progress
+                const RangeFunction* current;
+                unsigned long count;
+                unsigned long chunk;     //indices per part
+                unsigned int numParts;
+                unsigned int nextPart;   //next part nobody has taken
+                unsigned int partsDone;
+                unsigned long generation; //number of runs started
+
+                //takes parts of the current run until none are left
+                //guard must hold lock
+                void runParts(std::unique_lock<std::mutex> & guard);
+                void workerLoop();
+        };
+
+    }
+}
+#endif
@@ -25,10 +25,12 @@
 #include "TaskCommInfo.h"
 
 #include <cfloat>
+#include <functional>
 #include <queue>
 
 using namespace SST::Scheduler;
 using namespace std;
+using namespace std::placeholders;
 
 NearestAllocMapper::NearestAllocMapper(const Machine & mach,
                                        bool allocateAndMap,
@@ -288,9 +290,6 @@ int NearestAllocMapper::getCenterTask(const std::vector<std::map<int,int> > & in
 
 int NearestAllocMapper::getCenterNodeExh(const int nodesNeeded, const long int upperLimit)
 {
-    int bestNode = -1;
-    double bestScore = -DBL_MAX;
-    long int searchCount = 0;
     int searchRadius = 0;
     //get minimum required distance
     while (radiusToVolume[searchRadius] < nodesNeeded) {
@@ -301,46 +300,71 @@ int NearestAllocMapper::getCenterNodeExh(const int nodesNeeded, const long int u
     searchRadius += 2;
 
     //for all nodes
+    centerCands.clear();
     for (long int nodeIt = 0; nodeIt < mach.numNodes; nodeIt++) {
         if (isFree->at(lastNode)) {
-            double curScore = 1;
-            int availNodes = 1;
-            for(int dist = 1; dist <= searchRadius; dist++){
-                double scoreFactor = mach.nodesAtDistance(dist);
-                if ( scoreFactor == 0) {
-                    continue;
-                }
-                std::list<int>* toDelete = closestNodes(lastNode, dist);
-                int availInDist = toDelete->size();
-                delete toDelete;
-                if (availNodes < nodesNeeded && availNodes + availInDist > nodesNeeded) {
-                    curScore += (2*nodesNeeded - 2*availNodes - availInDist) / scoreFactor;
-                    availNodes = nodesNeeded;
-                } else if(availNodes < nodesNeeded) {
-                    curScore += availInDist / scoreFactor;
-                    availNodes += availInDist;
-                } else { //penalize extra nodes
-                    curScore -= availInDist / scoreFactor;
-                }
-            }
-
-            //update best node
-            if(curScore > bestScore){
-                bestScore = curScore;
-                bestNode = lastNode;
-            }
-
+            centerCands.push_back(lastNode);
             //preempt if upper bound is reached
-            searchCount++;
-            if(searchCount >= upperLimit){
+            if ((long int) centerCands.size() >= upperLimit) {
                 break;
             }
         }
         lastNode = (lastNode + 1) % mach.numNodes;
     }
+
+    centerScores.resize(centerCands.size());
+    long int searchVolume = radiusToVolume[min(searchRadius, (int) radiusToVolume.size() - 1)];
+    if ((long int) centerCands.size() * searchVolume < minParallelWork) {
+        scoreCenters(nodesNeeded, searchRadius, 0, 0, centerCands.size());
+    } else {
+        workers.run(centerCands.size(), bind(&NearestAllocMapper::scoreCenters, this, nodesNeeded, searchRadius, _1, _2, _3));
+    }
+
+    //update best node
+    int bestNode = -1;
+    double bestScore = -DBL_MAX;
+    for (unsigned int i = 0; i < centerCands.size(); i++) {
+        if (centerScores[i] > bestScore) {
+            bestScore = centerScores[i];
+            bestNode = centerCands[i];
+        }
+    }
     return bestNode;
 }
 
+void NearestAllocMapper::scoreCenters(int nodesNeeded, int searchRadius,
+                                      unsigned int part, unsigned long first, unsigned long last)
+{
+    for (unsigned long i = first; i < last; i++) {
+        int center = centerCands[i];
+        double curScore = 1;
+        int availNodes = 1;
+        for(int dist = 1; dist <= searchRadius; dist++){
+            double scoreFactor = mach.nodesAtDistance(dist);
+            if ( scoreFactor == 0) {
+                continue;
+            }
+            int availInDist = 0;
+            const std::vector<int> & shell = mach.getShell(center, dist);
+            for(std::vector<int>::const_iterator it = shell.begin(); it != shell.end(); it++){
+                if(mach.isFree(*it) && isFree->at(*it)){
+                    availInDist++;
+                }
+            }
+            if (availNodes < nodesNeeded && availNodes + availInDist > nodesNeeded) {
+                curScore += (2*nodesNeeded - 2*availNodes - availInDist) / scoreFactor;
+                availNodes = nodesNeeded;
+            } else if(availNodes < nodesNeeded) {
+                curScore += availInDist / scoreFactor;
+                availNodes += availInDist;
+            } else { //penalize extra nodes
+                curScore -= availInDist / scoreFactor;
+            }
+        }
+        centerScores[i] = curScore;
+    }
+}
+
 int NearestAllocMapper::getCenterNodeGr()
 {
     for(long int nodeIt = 0; nodeIt < mach.numNodes; nodeIt++){
@@ -400,15 +424,11 @@ std::list<int>* NearestAllocMapper::closestNodes(const long int srcNode, const i
             //no available node found - this is an exception when allocating the last node in machine
             break;
         }
-        delete outList;
-        outList = machine.getFreeAtDistance(srcNode, delta);
-        //eliminate those which are not free in the temporary list
-        list<int>::iterator it = outList->begin();
-        while(it != outList->end()){
-            if(!isFree->at(*it)){
-                it = outList->erase(it);
-            } else {
-                it++;
+        //take those which are also free in the temporary list
+        const std::vector<int> & shell = machine.getShell(srcNode, delta);
+        for(std::vector<int>::const_iterator it = shell.begin(); it != shell.end(); it++){
+            if(machine.isFree(*it) && isFree->at(*it)){
+                outList->push_back(*it);
             }
         }
         if(initDist != 0){ //function is called for specific distance
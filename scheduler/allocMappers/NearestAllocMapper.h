@@ -13,6 +13,7 @@
 #define SST_SCHEDULER_NEARESTALLOCMAPPER_H_
 
 #include "AllocMapper.h"
+#include "WorkerPool.h"
 #include "FibonacciHeap.h"
 
 #include <climits>
@@ -43,9 +44,14 @@ namespace SST {
                 std::string getSetupInfo(bool comment) const;
 
             private:
+                static const long minParallelWork = 1 << 14; //candidates * searched nodes below this are scored serially
+
                 NodeGenType nodeGen;
                 long int lastNode;
                 std::vector<long> radiusToVolume;
+                WorkerPool workers;
+                std::vector<int> centerCands;      //free nodes in the order getCenterNodeExh() visits them
+                std::vector<double> centerScores;  //score of each of centerCands
 
                 //allocation variables:
                 std::vector<int> vertexToNode; //maps communication graph vertices to machine nodes
@@ -80,8 +86,14 @@ namespace SST {
                 //tries first next upperLimit nodes
                 //if(upperLimit < N),   O(N + upperLimit * V)
                 //else,                 O(N * V)
+                //candidates are scored on the workers; ties go to the first visited
                 int getCenterNodeExh(const int nodesNeeded, const long int upperLimit = LONG_MAX);
 
+                //scores centerCands[first, last) by how closely the nodes within
+                //searchRadius match nodesNeeded
+                void scoreCenters(int nodesNeeded, int searchRadius,
+                                  unsigned int part, unsigned long first, unsigned long last);
+
                 //returns a center machine node for allocation
                 //gets the next free node
                 //O(N), depends on the machine utilization, expected: O(N * util)
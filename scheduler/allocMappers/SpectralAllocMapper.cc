@@ -12,12 +12,93 @@
 #include "SpectralAllocMapper.h"
 
 #include "AllocInfo.h"
+#include "Job.h"
+#include "Machine.h"
+#include "TaskCommInfo.h"
 #include "output.h"
 
+#include <algorithm>
 #include <cfloat>
+#include <cmath>
+#include <functional>
 
 using namespace SST::Scheduler;
 using namespace std;
+using namespace std::placeholders;
+
+static double dot(const vector<double> & a, const vector<double> & b)
+{
+    double sum = 0;
+    for(unsigned long i = 0; i < a.size(); i++){
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+//a -= coef * b
+static void subtract(vector<double> & a, double coef, const vector<double> & b)
+{
+    for(unsigned long i = 0; i < a.size(); i++){
+        a[i] -= coef * b[i];
+    }
+}
+
+//cyclic Jacobi; returns the eigenvector of the largest eigenvalue of the
+//symmetric n x n (n <= 3) matrix H in vec and the eigenvalue itself
+static double largestEigen(double H[3][3], int n, double vec[3])
+{
+    double V[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    for(int sweep = 0; sweep < 50; sweep++){
+        double off = 0;
+        for(int p = 0; p < n; p++){
+            for(int q = p + 1; q < n; q++){
+                off += H[p][q] * H[p][q];
+            }
+        }
+        if(off < 1e-30){
+            break;
+        }
+        for(int p = 0; p < n; p++){
+            for(int q = p + 1; q < n; q++){
+                if(H[p][q] == 0){
+                    continue;
+                }
+                double theta = (H[q][q] - H[p][p]) / (2 * H[p][q]);
+                double t = (theta >= 0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1));
+                double c = 1 / sqrt(t * t + 1);
+                double s = t * c;
+                for(int k = 0; k < n; k++){
+                    double hkp = H[k][p];
+                    double hkq = H[k][q];
+                    H[k][p] = c * hkp - s * hkq;
+                    H[k][q] = s * hkp + c * hkq;
+                }
+                for(int k = 0; k < n; k++){
+                    double hpk = H[p][k];
+                    double hqk = H[q][k];
+                    H[p][k] = c * hpk - s * hqk;
+                    H[q][k] = s * hpk + c * hqk;
+                }
+                for(int k = 0; k < n; k++){
+                    double vkp = V[k][p];
+                    double vkq = V[k][q];
+                    V[k][p] = c * vkp - s * vkq;
+                    V[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+    int best = 0;
+    for(int i = 1; i < n; i++){
+        if(H[i][i] > H[best][best]){
+            best = i;
+        }
+    }
+    for(int i = 0; i < n; i++){
+        vec[i] = V[i][best];
+    }
+    return H[best][best];
+}
 
 SpectralAllocMapper::SpectralAllocMapper(const Machine & mach, bool alloacateAndMap, int rngSeed) : AllocMapper(mach, alloacateAndMap)
 {
@@ -26,6 +107,13 @@ SpectralAllocMapper::SpectralAllocMapper(const Machine & mach, bool alloacateAnd
     } else {
         randNG = SST::RNG::MersenneRNG();
     }*/
+    //smallest radius that holds minNeighbors nodes
+    long volume = 0;
+    maxDistance = 0;
+    while(volume < minNeighbors && volume < mach.numNodes - 1 && maxDistance < mach.numNodes){
+        maxDistance++;
+        volume += mach.nodesAtDistance(maxDistance);
+    }
 }
 
 SpectralAllocMapper::~SpectralAllocMapper()
@@ -41,7 +129,7 @@ std::string SpectralAllocMapper::getSetupInfo(bool comment) const
     } else  {
         com="";
     }
-    return com + "Nearest AllocMapper";
+    return com + "Spectral AllocMapper";
 }
 
 void SpectralAllocMapper::allocMap(const AllocInfo & ai,
@@ -53,125 +141,357 @@ void SpectralAllocMapper::allocMap(const AllocInfo & ai,
     }
 
     //initialize
-    std::vector<int>* freeNodes = mach.getFreeNodes();
-    commMatrix = ai.job->taskCommInfo->getCommInfo();
-    unsigned int numNodes = ai.getNodesNeeded();
-    unsigned long mappedcount = numNodes;
+    unsigned int numTasks = ai.getNodesNeeded();
+    candNodes.clear();
+    for(int node = 0; node < mach.numNodes; node++){
+        if(isFree->at(node)){
+            candNodes.push_back(node);
+        }
+    }
+    if(candNodes.size() < numTasks){
+        schedout.fatal(CALL_INFO, 1, "SpectralAllocMapper: not enough free nodes for job %ld\n", ai.job->getJobNum());
+    }
+
+    //node proximity graph
+    findNeighbors();
 
-    //pairs representing potential correspondence
-    possPairs = vector<pair<unsigned int, unsigned long int> >(numNodes * freeNodes->size());
-    pairIndices = list<unsigned long int>();
-    for(unsigned int task = 0; task < numNodes; task++){
-        for(unsigned long int node = 0; node < freeNodes->size(); node++){
-            possPairs[task*numNodes + node] = pair<int,long int>(task, node);
-            pairIndices.push_back(task*numNodes + node);
+    //communication graph, symmetrized so that M is symmetric
+    vector<map<int,int> >* commMatrix = ai.job->taskCommInfo->getCommInfo();
+    vector<map<int, double> > symmetric(numTasks);
+    for(unsigned int task = 0; task < numTasks; task++){
+        for(map<int,int>::const_iterator it = commMatrix->at(task).begin(); it != commMatrix->at(task).end(); it++){
+            if(it->first != (int) task && it->second != 0){
+                symmetric[task][it->first] += it->second / 2.0;
+                symmetric[it->first][task] += it->second / 2.0;
+            }
         }
     }
-    pair<unsigned int, unsigned long int> toMap;
-    usedNodes.clear();
+    delete commMatrix;
+    commGraph = vector<vector<pair<int, double> > >(numTasks);
+    for(unsigned int task = 0; task < numTasks; task++){
+        commGraph[task].assign(symmetric[task].begin(), symmetric[task].end());
+    }
+
+    //all pairs are available
+    unmappedTasks.resize(numTasks);
+    taskRow.resize(numTasks);
+    for(unsigned int task = 0; task < numTasks; task++){
+        unmappedTasks[task] = task;
+        taskRow[task] = task;
+    }
+    freeCands.resize(candNodes.size());
+    candCol.resize(candNodes.size());
+    for(unsigned int cand = 0; cand < candNodes.size(); cand++){
+        freeCands[cand] = cand;
+        candCol[cand] = cand;
+    }
+    mappedTasks.clear();
+    taskMapped.assign(numTasks, -1);
+    taskCand.assign(numTasks, -1);
 
     //main loop
-    while(mappedcount > 0){
-        //get principal eigenvector
-        vector<double>* principal = principalEigenVector();
-
-        //find max of it and select the corresponding pair
-        double max = 0;
-        int index = 0;
-        unsigned long maxIndex = -1;
-        for(list<unsigned long>::const_iterator it = pairIndices.begin(); it != pairIndices.end(); it++){
-            if(principal->at(index) > max && taskToNode[possPairs[*it].first] == -1){
-                max = principal->at(index);
-                maxIndex = *it;
-                toMap = possPairs[*it];
-            }
-            index++;
-        }
-        delete principal;
-
-        //map
-        taskToNode[toMap.first] = toMap.second;
-        usedNodes.push_back(toMap.first);
-
-        //remove conflicting pairs
-        list<unsigned long>::iterator tempIt;
-        for(list<unsigned long>::iterator it = pairIndices.begin(); it != pairIndices.end(); it++){
-            if(possPairs[*it].first == toMap.first || possPairs[*it].second == toMap.second){
-                tempIt = it;
-                pairIndices.erase(it);
-                it = tempIt;
-                it--;
+    //each eigenvector starts from the previous one restricted to the remaining pairs
+    vector<double> principal(numPairs(), 1);
+    while(!unmappedTasks.empty()){
+        principalEigenVector(principal);
+        unsigned long batchSize = min(unmappedTasks.size() / batchDivisor, mappedTasks.size());
+        mapBatch(principal, max(1ul, batchSize), usedNodes, taskToNode);
+    }
+
+    candNodes.clear();
+    nodeNeighbors.clear();
+    commGraph.clear();
+}
+
+void SpectralAllocMapper::findNeighbors()
+{
+    vector<int> nodeCand(mach.numNodes, -1);
+    for(unsigned int cand = 0; cand < candNodes.size(); cand++){
+        nodeCand[candNodes[cand]] = cand;
+    }
+    nodeNeighbors = vector<vector<pair<int, double> > >(candNodes.size());
+    if(candNodes.size() * candNodes.size() < (unsigned long) minParallelWork){
+        findCandNeighbors(nodeCand, 0, candNodes.size());
+    } else {
+        workers.run(candNodes.size(), bind(&SpectralAllocMapper::findCandNeighbors, this, cref(nodeCand), _2, _3));
+    }
+}
+
+void SpectralAllocMapper::findCandNeighbors(const vector<int> & nodeCand, unsigned long first, unsigned long last)
+{
+    for(unsigned long cand = first; cand < last; cand++){
+        for(int distance = 1; distance <= maxDistance; distance++){
+            const vector<int> & shell = mach.getShell(candNodes[cand], distance);
+            for(vector<int>::const_iterator it = shell.begin(); it != shell.end(); it++){
+                if(nodeCand[*it] != -1){
+                    nodeNeighbors[cand].push_back(pair<int, double>(nodeCand[*it], 1.0 / distance));
+                }
             }
         }
+    }
+}
 
-        //re-add mapped pair
-        pairIndices.push_back(maxIndex);
+void SpectralAllocMapper::mapBatch(vector<double> & principal, unsigned long batchSize,
+                                   vector<long int> & usedNodes, vector<int> & taskToNode)
+{
+    unsigned long numRows = unmappedTasks.size();
+    unsigned long numCols = freeCands.size();
 
-        mappedcount--;
+    //best node of each unmapped task. Once some tasks are mapped, only tasks that
+    //communicate with them are considered, on nodes near their partners; without
+    //this the vector favors the same central nodes for every task
+    vector<pair<double, unsigned long> > nearBest;
+    vector<pair<double, unsigned long> > anyBest;
+    vector<unsigned long> bestCol(numRows);
+    for(unsigned long row = 0; row < numRows; row++){
+        const double* rowVals = &principal[row * numCols];
+        int task = unmappedTasks[row];
+        long best = -1;
+        for(unsigned int e = 0; e < commGraph[task].size(); e++){
+            int partner = commGraph[task][e].first;
+            if(taskMapped[partner] < 0){
+                continue;
+            }
+            const vector<pair<int, double> > & neighbors = nodeNeighbors[taskCand[partner]];
+            for(unsigned int n = 0; n < neighbors.size(); n++){
+                int col = candCol[neighbors[n].first];
+                if(col >= 0 && (best < 0 || rowVals[col] > rowVals[best])){
+                    best = col;
+                }
+            }
+        }
+        if(best >= 0){
+            bestCol[row] = best;
+            nearBest.push_back(pair<double, unsigned long>(-rowVals[best], row));
+        } else if(nearBest.empty()){
+            best = 0;
+            for(unsigned long col = 1; col < numCols; col++){
+                if(rowVals[col] > rowVals[best]){
+                    best = col;
+                }
+            }
+            bestCol[row] = best;
+            anyBest.push_back(pair<double, unsigned long>(-rowVals[best], row));
+        }
     }
+    vector<pair<double, unsigned long> > & rowBest = nearBest.empty() ? anyBest : nearBest;
+    sort(rowBest.begin(), rowBest.end());
 
-    delete commMatrix;
-    possPairs.clear();
-    pairIndices.clear();
+    //map greedily, skipping tasks whose node was taken in this batch
+    vector<bool> rowMapped(numRows, false);
+    vector<bool> colTaken(numCols, false);
+    vector<double> mappedVals(principal.begin() + numRows * numCols, principal.end());
+    unsigned long mapped = 0;
+    for(unsigned long i = 0; i < rowBest.size() && mapped < batchSize; i++){
+        unsigned long row = rowBest[i].second;
+        unsigned long col = bestCol[row];
+        if(colTaken[col]){
+            continue;
+        }
+        rowMapped[row] = true;
+        colTaken[col] = true;
+        int task = unmappedTasks[row];
+        int cand = freeCands[col];
+        taskToNode[task] = candNodes[cand];
+        usedNodes[mappedTasks.size()] = candNodes[cand];
+        taskMapped[task] = mappedTasks.size();
+        taskCand[task] = cand;
+        taskRow[task] = -1;
+        candCol[cand] = -1;
+        mappedTasks.push_back(task);
+        mappedVals.push_back(principal[row * numCols + col]);
+        mapped++;
+    }
+
+    //remove conflicting pairs by compacting the unmapped block
+    vector<int> newTasks;
+    vector<int> newCands;
+    for(unsigned long col = 0; col < numCols; col++){
+        if(!colTaken[col]){
+            candCol[freeCands[col]] = newCands.size();
+            newCands.push_back(freeCands[col]);
+        }
+    }
+    vector<double> shrunk;
+    shrunk.reserve((numRows - mapped) * newCands.size() + mappedVals.size());
+    for(unsigned long row = 0; row < numRows; row++){
+        if(rowMapped[row]){
+            continue;
+        }
+        taskRow[unmappedTasks[row]] = newTasks.size();
+        newTasks.push_back(unmappedTasks[row]);
+        for(unsigned long col = 0; col < numCols; col++){
+            if(!colTaken[col]){
+                shrunk.push_back(principal[row * numCols + col]);
+            }
+        }
+    }
+    shrunk.insert(shrunk.end(), mappedVals.begin(), mappedVals.end());
+    unmappedTasks.swap(newTasks);
+    freeCands.swap(newCands);
+    principal.swap(shrunk);
 }
 
-vector<double>* SpectralAllocMapper::principalEigenVector(const unsigned int maxIteration,
-                                                          const double epsilon) const
+void SpectralAllocMapper::principalEigenVector(vector<double> & x,
+                                               const unsigned int maxIteration,
+                                               const double epsilon) const
 {
     //initialize
-    unsigned int size = pairIndices.size();
-    vector<double>* bPrev = new vector<double>();
-    //generate random vector with norm 1
-    vector<double>* bNext = new vector<double>(size);
-    for(unsigned int i = 0; i < size; i++){
-        bNext->at(i) = (double) (rand() % 1000 + 1) / 1000;//randNG.nextUniform();
+    unsigned long size = x.size();
+    if(dot(x, x) == 0){
+        x.assign(size, 1);
     }
-
-    normalize(*bNext);
+    normalize(x);
+    vector<double> Ax(size), w(size), Aw(size), p, Ap;
+    multWithM(x, Ax);
+    double lambda = dot(x, Ax);
 
     //converge
-    double error = DBL_MAX;
-    for(unsigned int iter = 0; iter < maxIteration && error > epsilon; iter++){
-        //iterate
-        delete bPrev;
-        bPrev = bNext;
-        bNext = multWithM(*bPrev);
-        normalize(*bNext);
-        //find error
-        error = 0;
-        for(unsigned i = 0; i < size; i++){
-            error += abs(bPrev->at(i) - bNext->at(i)) / size;
-        }
-    }
-    delete bPrev;
-
-    return bNext;
+    for(unsigned int iter = 0; iter < maxIteration; iter++){
+        //residual, orthogonal to x
+        for(unsigned long i = 0; i < size; i++){
+            w[i] = Ax[i] - lambda * x[i];
+        }
+        subtract(w, dot(x, w), x);
+        double resNorm = sqrt(dot(w, w));
+        if(resNorm <= epsilon * fabs(lambda) || resNorm < DBL_MIN){
+            break;
+        }
+        for(unsigned long i = 0; i < size; i++){
+            w[i] /= resNorm;
+        }
+        multWithM(w, Aw);
+
+        //search space [x, w, p] with p orthonormalized against the others
+        vector<double>* basis[3] = {&x, &w, &p};
+        vector<double>* Abasis[3] = {&Ax, &Aw, &Ap};
+        int dim = 2;
+        if(!p.empty()){
+            for(int b = 0; b < 2; b++){
+                double coef = dot(*basis[b], p);
+                subtract(p, coef, *basis[b]);
+                subtract(Ap, coef, *Abasis[b]);
+            }
+            double pNorm = sqrt(dot(p, p));
+            if(pNorm > 1e-8){
+                for(unsigned long i = 0; i < size; i++){
+                    p[i] /= pNorm;
+                    Ap[i] /= pNorm;
+                }
+                dim = 3;
+            }
+        }
+
+        //Rayleigh-Ritz on the search space
+        double H[3][3];
+        for(int a = 0; a < dim; a++){
+            for(int b = a; b < dim; b++){
+                H[a][b] = H[b][a] = (dot(*basis[a], *Abasis[b]) + dot(*basis[b], *Abasis[a])) / 2;
+            }
+        }
+        double c[3];
+        lambda = largestEigen(H, dim, c);
+
+        //p = c1 w + c2 p, x = c0 x + p
+        if(dim == 2){
+            p.resize(size);
+            Ap.resize(size);
+            c[2] = 0;
+        }
+        for(unsigned long i = 0; i < size; i++){
+            p[i] = c[1] * w[i] + c[2] * p[i];
+            Ap[i] = c[1] * Aw[i] + c[2] * Ap[i];
+            x[i] = c[0] * x[i] + p[i];
+            Ax[i] = c[0] * Ax[i] + Ap[i];
+        }
+
+        double xNorm = sqrt(dot(x, x));
+        for(unsigned long i = 0; i < size; i++){
+            x[i] /= xNorm;
+            Ax[i] /= xNorm;
+        }
+        lambda = dot(x, Ax);
+    }
+
+    //principal eigenvector of a nonnegative matrix is nonnegative
+    double sum = 0;
+    for(unsigned long i = 0; i < size; i++){
+        sum += x[i];
+    }
+    if(sum < 0){
+        for(unsigned long i = 0; i < size; i++){
+            x[i] = -x[i];
+        }
+    }
 }
 
-vector<double>* SpectralAllocMapper::multWithM(const vector<double> & inVector) const
+void SpectralAllocMapper::multWithM(const vector<double> & inVector, vector<double> & outVector) const
 {
-    //vector is ordered such that t0<->n0, t0<->n1, ..., t1<->n0, t1<->n1, ...
-    vector<double>* retVec = new vector<double>(pairIndices.size(), 0);
-    long int resInd = 0; //index for retVec
-    for(list<unsigned long>::const_iterator i = pairIndices.begin(); i != pairIndices.end(); i++){
-        int task0 = possPairs[*i].first;
-        unsigned long node0 = possPairs[*i].second;
-        for(list<unsigned long>::const_iterator j = pairIndices.begin(); j != pairIndices.end(); j++){
-            int task1 = possPairs[*j].first;
-            unsigned long node1 = possPairs[*j].second;
-            long int mulInd = 0; //index for inVector
-            if(task0 != task1
-                    && node0 != node1
-                    && commMatrix->at(task0).count(task1) != 0){
-                double commWeight = commMatrix->at(task0)[task1];
-                long int distance = mach.getNodeDistance(node0, node1);
-                retVec->at(resInd) += inVector[mulInd] * commWeight / distance;
+    outVector.resize(inVector.size());
+    unsigned long numRows = unmappedTasks.size();
+    if(numPairs() < (unsigned long) minParallelWork){
+        multRows(inVector, outVector, 0, numRows);
+    } else {
+        workers.run(numRows, bind(&SpectralAllocMapper::multRows, this, cref(inVector), ref(outVector), _2, _3));
+    }
+    multRows(inVector, outVector, numRows, numRows + mappedTasks.size());
+}
+
+//rows [0, unmappedTasks.size()) are unmapped tasks, the rest are mapped tasks
+void SpectralAllocMapper::multRows(const vector<double> & inVector, vector<double> & outVector,
+                                   unsigned long firstRow, unsigned long lastRow) const
+{
+    unsigned long numRows = unmappedTasks.size();
+    unsigned long numCols = freeCands.size();
+    const double* mappedVals = &inVector[0] + numRows * numCols;
+    vector<double> spread(candNodes.size());
+
+    for(unsigned long row = firstRow; row < lastRow; row++){
+        if(row < numRows){
+            //sum the communicating tasks' pairs by node, then spread to the neighboring nodes
+            int task0 = unmappedTasks[row];
+            fill(spread.begin(), spread.end(), 0);
+            for(unsigned int e = 0; e < commGraph[task0].size(); e++){
+                int task1 = commGraph[task0][e].first;
+                double commWeight = commGraph[task0][e].second;
+                if(taskRow[task1] >= 0){
+                    const double* in = &inVector[taskRow[task1] * numCols];
+                    for(unsigned long col = 0; col < numCols; col++){
+                        spread[freeCands[col]] += commWeight * in[col];
+                    }
+                } else {
+                    spread[taskCand[task1]] += commWeight * mappedVals[taskMapped[task1]];
+                }
+            }
+            double* out = &outVector[row * numCols];
+            for(unsigned long col = 0; col < numCols; col++){
+                const vector<pair<int, double> > & neighbors = nodeNeighbors[freeCands[col]];
+                double sum = 0;
+                for(unsigned int n = 0; n < neighbors.size(); n++){
+                    sum += neighbors[n].second * spread[neighbors[n].first];
+                }
+                out[col] = sum;
             }
-            mulInd++;
+        } else {
+            //a mapped task has a single pair
+            int task0 = mappedTasks[row - numRows];
+            const vector<pair<int, double> > & neighbors = nodeNeighbors[taskCand[task0]];
+            double sum = 0;
+            for(unsigned int e = 0; e < commGraph[task0].size(); e++){
+                int task1 = commGraph[task0][e].first;
+                double commWeight = commGraph[task0][e].second;
+                for(unsigned int n = 0; n < neighbors.size(); n++){
+                    int cand1 = neighbors[n].first;
+                    if(taskRow[task1] >= 0 && candCol[cand1] >= 0){
+                        sum += commWeight * neighbors[n].second * inVector[taskRow[task1] * numCols + candCol[cand1]];
+                    } else if(taskCand[task1] == cand1){
+                        sum += commWeight * neighbors[n].second * mappedVals[taskMapped[task1]];
+                    }
+                }
+            }
+            outVector[numRows * numCols + row - numRows] = sum;
         }
-        resInd++;
     }
-    return retVec;
 }
 
 void SpectralAllocMapper::normalize(vector<double> & inVector) const
@@ -185,4 +505,3 @@ void SpectralAllocMapper::normalize(vector<double> & inVector) const
         inVector[i] /= temp;
     }
 }
-
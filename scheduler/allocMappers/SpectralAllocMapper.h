@@ -13,10 +13,12 @@
 #define SPECTRALALLOCMAPPER_H_
 
 #include "AllocMapper.h"
+#include "WorkerPool.h"
 
 #include "sst/core/rng/mersenne.h"
 
 #include <map>
+#include <utility>
 #include <vector>
 
 using namespace std;
@@ -30,6 +32,12 @@ namespace SST {
     // Leordeanu, M.; Hebert, M., "A spectral technique for correspondence problems using pairwise
     // constraints," Computer Vision, 2005. ICCV 2005. Tenth IEEE International Conference on ,
     // vol.2, no., pp.1482,1489 Vol. 2, 17-21 Oct. 2005 doi: 10.1109/ICCV.2005.20
+    //
+    //The affinity of pairs (t0,n0) and (t1,n1) is comm(t0,t1) / distance(n0,n1), which is
+    //the Kronecker product of the task communication graph and the node proximity graph.
+    //M is never built: it is applied as (comm graph) x (pair vector) x (proximity graph),
+    //with nodes more than maxDistance hops apart treated as incompatible so the proximity
+    //graph is sparse too.
 
     class SpectralAllocMapper : public AllocMapper {
 
@@ -45,19 +53,56 @@ namespace SST {
                           std::vector<int> & taskToNode);
 
         private:
-            //SST::RNG::MersenneRNG randNG;   //random number generator
-            vector<pair<unsigned int, unsigned long int> > possPairs; //possible pairs
-            list<unsigned long int> pairIndices; //indices of available pairs - for optimization
-            vector<map<int,int> >* commMatrix;
+            static const int minNeighbors = 8;      //maxDistance covers at least this many nodes
+            static const int batchDivisor = 8;      //maps up to 1/batchDivisor of remaining tasks per eigenvector
+            static const long minParallelWork = 1 << 15; //smaller products are not worth the threads
 
-            //returns the approximate principle eigenvector for the given tasks & nodes
-            //uses Power (Von Mises) iteration
+            //SST::RNG::MersenneRNG randNG;   //random number generator
+            mutable WorkerPool workers;
+            int maxDistance;     //node pairs further apart have no affinity
+
+            //candidate nodes & their neighbors within maxDistance: (candidate index, 1 / distance)
+            vector<int> candNodes;
+            vector<vector<pair<int, double> > > nodeNeighbors;
+            //symmetrized communication graph: (task, weight)
+            vector<vector<pair<int, double> > > commGraph;
+
+            //the available pairs are (unmappedTasks x freeCands) + (mappedTasks, mappedCand)
+            //pair vectors hold the unmapped block row-major, followed by one entry per mapped task
+            vector<int> unmappedTasks;
+            vector<int> freeCands;
+            vector<int> mappedTasks;
+            vector<int> taskRow;       //task -> index in unmappedTasks, or -1
+            vector<int> taskMapped;    //task -> index in mappedTasks, or -1
+            vector<int> taskCand;      //task -> candidate it is mapped to, or -1
+            vector<int> candCol;       //candidate -> index in freeCands, or -1
+
+            unsigned long numPairs() const { return unmappedTasks.size() * freeCands.size() + mappedTasks.size(); }
+
+            //improves the given approximate principal eigenvector in place
+            //block LOBPCG with block size 1, warm started from inVector
             //matrix should be symmetric & positive
-            vector<double>* principalEigenVector(const unsigned int maxIteration = 100,
-                                                 const double epsilon = 5e-3) const; //error margin
-            //O(inVector.size()^2)
-            //multiply with M matrix - refer to paper for definition
-            vector<double>* multWithM(const vector<double> & inVector) const;
+            void principalEigenVector(vector<double> & inVector,
+                                      const unsigned int maxIteration = 100,
+                                      const double epsilon = 1e-2) const; //relative residual
+
+            //outVector = M * inVector over the available pairs
+            //O(E * F + T * F * neighbors), split over the workers
+            void multWithM(const vector<double> & inVector, vector<double> & outVector) const;
+            void multRows(const vector<double> & inVector, vector<double> & outVector,
+                          unsigned long firstRow, unsigned long lastRow) const;
+
+            //fills nodeNeighbors from the machine's distance shells
+            //O(F * nodes within maxDistance), split over the workers
+            void findNeighbors();
+            //fills nodeNeighbors[first, last); nodeCand maps nodes to candidate indices or -1
+            void findCandNeighbors(const vector<int> & nodeCand, unsigned long first, unsigned long last);
+
+            //maps the best non-conflicting pairs of the given eigenvector & shrinks it to the remaining pairs
+            //O(T * F)
+            void mapBatch(vector<double> & principal, unsigned long batchSize,
+                          vector<long int> & usedNodes, vector<int> & taskToNode);
+
             void normalize(vector<double> & inVector) const;
         };
 
@@ -65,4 +110,3 @@ namespace SST {
 }
 
 #endif /* SPECTRALALLOCMAPPER_H_ */
-
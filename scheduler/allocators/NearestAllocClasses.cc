@@ -37,7 +37,8 @@
 #include <sstream>
 #include <vector>
 #include <set>
-#include <algorithm>  //for std::stable_sort
+#include <algorithm>  //for std::stable_sort & std::sort
+#include <stdlib.h>
 
 #include "StencilMachine.h"
 
@@ -152,31 +153,21 @@ vector<MeshLocation*>* AllCenterGenerator::getCenters(vector<MeshLocation*>* ava
 
 //Point Collectors:
 
-vector<MeshLocation*>* L1PointCollector::getNearest(MeshLocation* center, int num, const StencilMachine & mach) 
+void L1PointCollector::getNearest(int center, int num, const StencilMachine & mach, vector<int> & nearest) const
 {
-    //get sufficient nodes
-    int found = 1;
-    int dist = 1;
-    std::list<int>* nodeList = new std::list<int>();
-    while(found < num && dist <= (mach.dims[0] + mach.dims[1] + mach.dims[2])){
-        std::list<int>* tempList = mach.getFreeAtDistance(center->toInt(mach), dist);
-        found += tempList->size();
-        nodeList->insert(nodeList->end(), tempList->begin(), tempList->end());
-        delete tempList;
-        dist++;
+    nearest.clear();
+    if (mach.isFree(center)) {
+        nearest.push_back(center);
     }
-    
-    //convert to MeshLocation
-    vector<MeshLocation*>* retList = new vector<MeshLocation*>(num);
-    retList->at(0) = center;
-    int i = 1;
-    for(std::list<int>::iterator it = nodeList->begin(); it != nodeList->end() && i < num; it++){
-        retList->at(i) = new MeshLocation(*it, mach);
-        i++;
+    int maxDist = mach.dims[0] + mach.dims[1] + mach.dims[2];
+    for (int dist = 1; (int) nearest.size() < num && dist <= maxDist; dist++) {
+        const vector<int> & shell = mach.getShell(center, dist);
+        for (vector<int>::const_iterator it = shell.begin(); it != shell.end() && (int) nearest.size() < num; it++) {
+            if (mach.isFree(*it)) {
+                nearest.push_back(*it);
+            }
+        }
     }
-    delete nodeList;
-    
-    return retList;
 }
 
 string  L1PointCollector::getSetupInfo(bool comment)
@@ -190,31 +181,20 @@ string  L1PointCollector::getSetupInfo(bool comment)
     return com + "L1PointCollector";
 }
 
-vector<MeshLocation*>* LInfPointCollector::getNearest(MeshLocation* center, int num, const StencilMachine & mach) 
+void LInfPointCollector::getNearest(int center, int num, const StencilMachine & mach, vector<int> & nearest) const
 {
-    //get sufficient nodes
-    int found = 1;
-    int dist = 1;
-    std::list<int>* nodeList = new std::list<int>();
-    while(found < num && dist <= (mach.dims[0] + mach.dims[1] + mach.dims[2])){
-        std::list<int>* tempList = mach.getFreeAtLInfDistance(center->toInt(mach), dist);
-        found += tempList->size();
-        nodeList->insert(nodeList->end(), tempList->begin(), tempList->end());
-        delete tempList;
-        dist++;
+    nearest.clear();
+    if (mach.isFree(center)) {
+        nearest.push_back(center);
     }
-    
-    //convert to MeshLocation
-    vector<MeshLocation*>* retList = new vector<MeshLocation*>(num);
-    retList->at(0) = center;
-    int i = 1;
-    for(std::list<int>::iterator it = nodeList->begin(); it != nodeList->end() && i < num; it++){
-        retList->at(i) = new MeshLocation(*it, mach);
-        i++;
+    int maxDist = mach.dims[0] + mach.dims[1] + mach.dims[2];
+    for (int dist = 1; (int) nearest.size() < num && dist <= maxDist; dist++) {
+        std::list<int>* tempList = mach.getFreeAtLInfDistance(center, dist);
+        for (std::list<int>::iterator it = tempList -> begin(); it != tempList -> end() && (int) nearest.size() < num; it++) {
+            nearest.push_back(*it);
+        }
+        delete tempList;
     }
-    delete nodeList;
-    
-    return retList;
 }
 
 string LInfPointCollector::getSetupInfo(bool comment)
@@ -241,15 +221,24 @@ string PairwiseL1DistScorer::getSetupInfo(bool comment)
     return com + "PairwiseL1DistScorer";
 }
 
-std::pair<long,long>* PairwiseL1DistScorer::valueOf(MeshLocation* center, std::vector<MeshLocation*>* procs, StencilMachine* mach) 
+std::pair<long,long> PairwiseL1DistScorer::valueOf(int center, const vector<int> & nodes, const StencilMachine & mach,
+                                                    vector<int> & scratch) const
 {
+    //in sorted order the i-th of n coordinates is at least as large as
+    //the i before it and at most as large as the n - 1 - i after it
     long retVal = 0;
-    for (unsigned int i = 0; i < procs->size(); i++) {
-        for (unsigned int j = i + 1; j < procs->size(); j++) {
-            retVal += procs->at(i)->L1DistanceTo(*(procs->at(j)));
+    long n = nodes.size();
+    scratch.resize(n);
+    for (int dim = 0; dim < mach.numDims(); dim++) {
+        for (long i = 0; i < n; i++) {
+            scratch[i] = mach.coordOf(nodes[i], dim);
+        }
+        sort(scratch.begin(), scratch.end());
+        for (long i = 0; i < n; i++) {
+            retVal += scratch[i] * (2 * i - n + 1);
         }
     }
-    return new std::pair<long,long>(retVal,0);
+    return std::pair<long,long>(retVal,0);
 }
 
 //Takes mesh center, available processors sorted by correct comparator,
@@ -380,16 +369,19 @@ string Tiebreaker::getInfo()
 }
 
 
-pair<long,long>* LInfDistFromCenterScorer::valueOf(MeshLocation* center, vector<MeshLocation*>* procs, StencilMachine* mach) {
+pair<long,long> LInfDistFromCenterScorer::valueOf(int center, const vector<int> & nodes, const StencilMachine & mach,
+                                                   vector<int> & scratch) const
+{
     //returns the sum of the LInf distances of the num closest processors
-
     long retVal = 0;
-    for (unsigned int i = 0; i < procs->size(); i++) 
-        retVal += center -> LInfDistanceTo(*((*procs)[i]));
-
-    long tiebreak = tiebreaker -> getTiebreak(center,procs, mach);
-
-    return new pair<long,long>(retVal,tiebreak);
+    for (unsigned int i = 0; i < nodes.size(); i++) {
+        int dist = 0;
+        for (int dim = 0; dim < mach.numDims(); dim++) {
+            dist = max(dist, abs(mach.coordOf(nodes[i], dim) - mach.coordOf(center, dim)));
+        }
+        retVal += dist;
+    }
+    return pair<long,long>(retVal,0);
 }
 
 LInfDistFromCenterScorer::LInfDistFromCenterScorer(Tiebreaker* tb)
@@ -411,12 +403,15 @@ string  LInfDistFromCenterScorer::getSetupInfo(bool comment)
     return ret.str();
 }
 
-pair<long,long>* L1DistFromCenterScorer::valueOf(MeshLocation* center, vector<MeshLocation*>* procs, StencilMachine* mach) 
+pair<long,long> L1DistFromCenterScorer::valueOf(int center, const vector<int> & nodes, const StencilMachine & mach,
+                                                 vector<int> & scratch) const
 {
     //returns sum of L1 distances from center
     long retVal = 0;
-    for (unsigned int i = 0; i < procs->size(); i++)
-        retVal += center -> L1DistanceTo(*(procs->at(i)));
-    return new pair<long,long>(retVal,0);
+    for (unsigned int i = 0; i < nodes.size(); i++) {
+        for (int dim = 0; dim < mach.numDims(); dim++) {
+            retVal += abs(mach.coordOf(nodes[i], dim) - mach.coordOf(center, dim));
+        }
+    }
+    return pair<long,long>(retVal,0);
 }
-
@@ -157,17 +157,17 @@ namespace SST {
             //a way to gather nearest free processors to a given center
 
             public:
-                virtual std::vector<MeshLocation*>* getNearest(MeshLocation* center, int num, const StencilMachine & mach) = 0;
+                virtual void getNearest(int center, int num, const StencilMachine & mach, std::vector<int> & nearest) const = 0;
                 virtual std::string getSetupInfo(bool comment) = 0;
-                //returns num nearest locations to center from available
-                //may reorder available and return it
+                //fills nearest with the num free nodes closest to center,
+                //starting with center itself if it is free
         };
 
 
         class L1PointCollector : public PointCollector {
             //collects points nearest to center in terms of L1 distance
             public:
-                std::vector<MeshLocation*>* getNearest(MeshLocation* center, int num, const StencilMachine & mach); 
+                void getNearest(int center, int num, const StencilMachine & mach, std::vector<int> & nearest) const;
 
                 std::string getSetupInfo(bool comment);
 
@@ -176,7 +176,7 @@ namespace SST {
         class LInfPointCollector : public PointCollector{
 
             public:
-                std::vector<MeshLocation*>* getNearest(MeshLocation* center, int num, const StencilMachine & mach); 
+                void getNearest(int center, int num, const StencilMachine & mach, std::vector<int> & nearest) const;
 
                 std::string getSetupInfo(bool comment);
 
@@ -187,10 +187,13 @@ namespace SST {
         class Scorer {
             //a way to evaluate a possible allocation; low is better
             public:
-                virtual std::pair<long,long>* valueOf(MeshLocation* center, std::vector<MeshLocation*>* procs, StencilMachine* mach) = 0;
+                virtual std::pair<long,long> valueOf(int center, const std::vector<int> & nodes, const StencilMachine & mach,
+                                                     std::vector<int> & scratch) const = 0;
                 virtual std::string getSetupInfo(bool comment) = 0;
-                //returns score associated with first num members of procs
+                //returns score associated with the given nodes
                 //center is the center point used to select these
+                //scratch is working space of the caller, so one scorer can
+                //serve several threads
 
         };
 
@@ -199,7 +202,9 @@ namespace SST {
 
             public:
                 //returns pairwise L1 dist between given procs
-                std::pair<long,long>* valueOf(MeshLocation* center, std::vector<MeshLocation*>* procs, StencilMachine* mach);
+                //O(n lg n): sums the coordinate differences of each dimension in sorted order
+                std::pair<long,long> valueOf(int center, const std::vector<int> & nodes, const StencilMachine & mach,
+                                             std::vector<int> & scratch) const;
                 std::string getSetupInfo(bool comment);
         };
 
@@ -250,7 +255,10 @@ namespace SST {
                 Tiebreaker* tiebreaker;
 
             public:
-                std::pair<long,long>* valueOf(MeshLocation* center, std::vector<MeshLocation*>* procs, StencilMachine* mach) ;
+                //the tiebreaker looks at free processors beyond the allocation,
+                //which are not scored here, so every allocation ties at 0
+                std::pair<long,long> valueOf(int center, const std::vector<int> & nodes, const StencilMachine & mach,
+                                             std::vector<int> & scratch) const;
 
                 LInfDistFromCenterScorer(Tiebreaker* tb);
 
@@ -268,7 +276,8 @@ namespace SST {
             public:
                 L1DistFromCenterScorer() { }
 
-                std::pair<long,long>* valueOf(MeshLocation* center, std::vector<MeshLocation*>* procs, StencilMachine* mach);
+                std::pair<long,long> valueOf(int center, const std::vector<int> & nodes, const StencilMachine & mach,
+                                             std::vector<int> & scratch) const;
 
                 std::string getSetupInfo(bool comment)
                 {
@@ -37,6 +37,9 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <functional>
+
+#include <limits.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -51,11 +54,13 @@
 
 using namespace SST::Scheduler;
 using namespace std;
+using namespace std::placeholders;
 
 NearestAllocator::NearestAllocator(std::vector<std::string>* params, Machine* mach) : Allocator(*mach)
 {
     schedout.init("", 8, 0, Output::STDOUT);
     mMachine = (StencilMachine*) mach;
+    scratch.resize(workers.size());
     if (NULL == mMachine || mMachine->numDims() != 3) {
         schedout.fatal(CALL_INFO, 1, "Nearest allocators require a 3D mesh or torus machine");
     }
@@ -215,19 +220,12 @@ AllocInfo* NearestAllocator::allocate(Job* job, std::vector<MeshLocation*>* avai
     if ((unsigned int) nodesNeeded == available -> size()) {
         for (int i = 0; i < nodesNeeded; i++) {
             retVal -> nodeIndices[i] = (*available)[i] -> toInt(*mMachine);
+            delete (*available)[i];
         }
         delete available;
         return retVal;
     }
 
-    //score of best value found so far with it tie-break score:
-    std::pair<long,long>* bestVal = new std::pair<long,long>(LONG_MAX,LONG_MAX);
-
-    bool recordingTies = false; //Statistics.recordingTies();
-
-    //stores allocations w/ best score (no tiebreaking) if ties being recorded:
-    //(actual best value w/ tiebreaking stored in retVal.processors)
-    std::vector<std::vector<MeshLocation*>*>* bestAllocs = new std::vector<std::vector<MeshLocation*> *>(); 
     std::vector<MeshLocation*>* possCenters;
 
     if ("Hybrid" == configName) {
@@ -249,45 +247,62 @@ AllocInfo* NearestAllocator::allocate(Job* job, std::vector<MeshLocation*>* avai
     } else { 
         possCenters = centerGenerator -> getCenters(available);
     }
+    for (unsigned int i = 0; i < available -> size(); i++) {
+        delete (*available)[i];
+    }
     delete available;
-    
-    std::vector<MeshLocation*>* nearest = NULL;
-    std::vector<MeshLocation*>* alloc = new std::vector<MeshLocation*>();
-    for (std::vector<MeshLocation*>::iterator center = possCenters -> begin(); center != possCenters -> end(); ++center) {        
-        nearest = pointCollector -> getNearest(*center, nodesNeeded, *mMachine);        
-        std::pair<long,long>* val = scorer -> valueOf(*center, nearest, mMachine); 
-        if (val -> first < bestVal -> first || 
-            (val -> first == bestVal -> first && val -> second < bestVal -> second) ) {
-            delete bestVal;
-            bestVal = val;
-            for (int i = 0; i < nodesNeeded; i++) {
-                retVal -> nodeIndices[i] = (*nearest)[i] -> toInt(*mMachine);
-            }
-            if (recordingTies) {
-                bestAllocs -> clear();
-            }
-        }
-        delete *center;
-        *center = NULL;
-
-        if (recordingTies && val -> first == bestVal -> first) {
-            delete alloc;
-            alloc = new std::vector<MeshLocation*>();
-            for (int i = 0; i < nodesNeeded; i++)
-                alloc -> push_back((*nearest)[i]);
-            bestAllocs -> push_back(alloc);
-        }
-        delete nearest;
+
+    std::vector<int> centers(possCenters -> size());
+    for (unsigned int i = 0; i < possCenters -> size(); i++) {
+        centers[i] = (*possCenters)[i] -> toInt(*mMachine);
+        delete (*possCenters)[i];
     }
-    //clear memory
-    delete alloc;
-    delete bestAllocs;
     delete possCenters;
-    delete bestVal;
+
+    //each part keeps its best center; parts cover the centers in order,
+    //so taking the first of equal parts picks the same center as a serial scan
+    unsigned int numParts = 1;
+    if ((long) centers.size() * nodesNeeded < minParallelWork) {
+        scoreCenters(centers, nodesNeeded, 0, 0, centers.size());
+    } else {
+        numParts = min((unsigned long) workers.size(), (unsigned long) centers.size());
+        workers.run(centers.size(), bind(&NearestAllocator::scoreCenters, this, cref(centers), nodesNeeded, _1, _2, _3));
+    }
+    CenterScratch* best = NULL;
+    for (unsigned int part = 0; part < numParts; part++) {
+        CenterScratch & cur = scratch[part];
+        if (!cur.best.empty() && (NULL == best || cur.bestVal < best -> bestVal)) {
+            best = &cur;
+        }
+    }
+    if (NULL == best) {
+        schedout.fatal(CALL_INFO, 1, "Nearest allocator found no center for %s\n", job -> toString().c_str());
+    }
+    for (int i = 0; i < nodesNeeded; i++) {
+        retVal -> nodeIndices[i] = best -> best[i];
+    }
     
     return retVal;
 }
 
+void NearestAllocator::scoreCenters(const std::vector<int> & centers, int nodesNeeded,
+                                    unsigned int part, unsigned long first, unsigned long last)
+{
+    CenterScratch & cur = scratch[part];
+    cur.best.clear();
+    for (unsigned long i = first; i < last; i++) {
+        pointCollector -> getNearest(centers[i], nodesNeeded, *mMachine, cur.nearest);
+        if ((int) cur.nearest.size() < nodesNeeded) {
+            continue;
+        }
+        std::pair<long,long> val = scorer -> valueOf(centers[i], cur.nearest, *mMachine, cur.scorerWork);
+        if (cur.best.empty() || val < cur.bestVal) {
+            cur.bestVal = val;
+            cur.best.swap(cur.nearest);
+        }
+    }
+}
+
 void NearestAllocator::genAlgAllocator(StencilMachine* m) {
     configName = "genAlg";
     mMachine = m;
@@ -33,8 +33,10 @@
 
 #include <vector>
 #include <string>
+#include <utility>
 
 #include "Allocator.h"
+#include "WorkerPool.h"
 
 namespace SST {
     namespace Scheduler {
@@ -61,6 +63,24 @@ namespace SST {
 
                 StencilMachine *mMachine;
 
+                //best allocation one thread found among its centers
+                struct CenterScratch {
+                    std::vector<int> nearest;      //nodes around the center being scored
+                    std::vector<int> scorerWork;   //scratch space for the scorer
+                    std::vector<int> best;         //nodes of the best allocation
+                    std::pair<long,long> bestVal;  //its score
+                };
+
+                static const long minParallelWork = 1 << 16; //centers * nodes below this are scored serially
+
+                WorkerPool workers;
+                std::vector<CenterScratch> scratch;  //one per worker
+
+                //scores centers [first, last) & keeps the best in scratch[part]
+                //ties go to the earlier center
+                void scoreCenters(const std::vector<int> & centers, int nodesNeeded,
+                                  unsigned int part, unsigned long first, unsigned long last);
+
             public:
 
                 NearestAllocator(std::vector<std::string>* params, Machine* mach);
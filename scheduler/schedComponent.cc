@@ -14,6 +14,7 @@
 #include "schedComponent.h" 
 
 #include <boost/thread.hpp>
+#include <chrono>
 #include <cstring>
 
 #include <iostream> //debug
@@ -152,7 +153,7 @@ schedComponent::schedComponent(ComponentId_t id, Params& params) :
 
     string trace = params.find_string("traceName");
     if (FSTtype > 0) {
-        calcFST = new FST(FSTtype);  //must call calcFST -> setup() once we know the number of jobs (in other words, in setup())
+        calcFST = new FST(FSTtype, factory.getFSTThreads(params));  //must call calcFST -> setup() once we know the number of jobs (in other words, in setup())
     } else {
         calcFST = NULL;
     }
@@ -189,6 +190,8 @@ schedComponent::schedComponent(ComponentId_t id, Params& params) :
         }
     }
 
+    allocTimeStat = registerStatistic<uint64_t>("AllocationTime");
+
     useYumYumSimulationKill = !params.find_string("useYumYumSimulationKill").empty();
     YumYumSimulationKillFlag = false;
 
@@ -199,11 +202,25 @@ schedComponent::schedComponent(ComponentId_t id, Params& params) :
     }
 
     useYumYumTraceFormat = !params.find_string("useYumYumTraceFormat").empty();
+    if (FSTtype > 0 && useYumYumTraceFormat) {
+        //FST replays completions at the times the scheduler sees them, which
+        //YumYum shifts away from the times its jobs start
+        schedout.fatal(CALL_INFO, 1, "FST is not supported with the YumYum trace format\n");
+    }
     printYumYumJobLog = !params.find_string("printYumYumJobLog").empty();
     printJobLog = !params.find_string("printJobLog").empty();
 
     jobParser = new JobParser(machine, params, &useYumYumSimulationKill, &YumYumSimulationKillFlag, &doDetailedNetworkSim);
 
+    traceWindow = 0;
+    if (!params.find_string("traceWindow").empty()) {
+        traceWindow = strtoul(params.find_string("traceWindow").c_str(), NULL, 0);
+    }
+    queuedArrivals = 0;
+    lastQueuedArrival = 0;
+    traceDone = false;
+    jobNumLastArrived = -1;
+
     machine -> reset();
     scheduler -> reset();
 
@@ -225,10 +242,17 @@ void schedComponent::setup()
         (*nodeIter)->send( setNetworkSim );
     }
     // done setting up the links, now read the job list
-    jobs = jobParser -> parseJobs(getCurrentSimTime());
-
-    // NetworkSim: record the total number of jobs as the jobs vector changes over time
-    numJobs = (int) jobs.size();
+    if (useYumYumTraceFormat) {
+        std::vector<Job*> parsed = jobParser -> parseJobs(getCurrentSimTime());
+        for (unsigned int i = 0; i < parsed.size(); i++) {
+            jobs[parsed[i] -> getJobNum()] = parsed[i];
+            selfLink -> send(0, new ArrivalEvent(parsed[i] -> getArrivalTime(), parsed[i] -> getJobNum()));
+            queuedArrivals++;
+        }
+        traceDone = true;
+    } else {
+        readJobs();
+    }
     
     if (doDetailedNetworkSim){
         //parse the ember completed/running job traces
@@ -249,16 +273,6 @@ void schedComponent::setup()
         }
     }
     
-    for(int i = 0; i < (int) jobs.size(); i++)
-    {
-        ArrivalEvent* ae = new ArrivalEvent(jobs[i]->getArrivalTime(), i);
-        if (useYumYumTraceFormat) {
-            selfLink -> send(0, ae); 
-        } else {
-            selfLink -> send(jobs[i]->getArrivalTime(), ae); 
-        }
-    }
-        
     if( useYumYumTraceFormat ){
         char* inputDir = getenv("SIMINPUT");
         string jobListFileName;
@@ -277,11 +291,66 @@ void schedComponent::setup()
     }
 
     if (FSTtype > 0){
-        calcFST -> setup(jobs.size());
+        if (traceDone) {
+            calcFST -> setup(jobs.size(), scheduler, machine);
+        } else {
+            calcFST -> setup(jobParser -> countJobs(), scheduler, machine);
+        }
     }
 }
 
 
+void schedComponent::readJobs()
+{
+    while (!traceDone && (0 == traceWindow
+                          || queuedArrivals < traceWindow
+                          || lastQueuedArrival <= getCurrentSimTime())) {
+        readJob();
+    }
+}
+
+
+Job* schedComponent::readJob()
+{
+    Job* job = jobParser -> nextJob();
+    if (NULL == job) {
+        traceDone = true;
+        return NULL;
+    }
+    if (job -> getArrivalTime() < getCurrentSimTime()) {
+        schedout.fatal(CALL_INFO, 1, "Job %ld arrives at %lu, before the jobs read ahead of it; streaming needs a trace sorted by arrival time (set traceWindow to 0)\n",
+                       job -> getJobNum(), job -> getArrivalTime());
+    }
+    jobs[job -> getJobNum()] = job;
+    selfLink -> send(job -> getArrivalTime() - getCurrentSimTime(),
+                     new ArrivalEvent(job -> getArrivalTime(), job -> getJobNum()));
+    queuedArrivals++;
+    lastQueuedArrival = job -> getArrivalTime();
+    return job;
+}
+
+
+Job* schedComponent::nextArrivalAfter(SimTime_t time, unsigned long & arrival)
+{
+    arrival = 0;
+    std::map<long, Job*>::iterator it = jobs.upper_bound(jobNumLastArrived);
+    for (; it != jobs.end(); it++) {
+        arrival = it -> second -> getArrivalTime();
+        if (arrival > time) {
+            return it -> second;
+        }
+    }
+    Job* job;
+    while (NULL != (job = readJob())) {
+        arrival = job -> getArrivalTime();
+        if (arrival > time) {
+            return job;
+        }
+    }
+    return NULL;
+}
+
+
 schedComponent::schedComponent() : Component(-1)
 {
     // for serialization only
@@ -317,7 +386,10 @@ void schedComponent::unregisterYourself()
         while( YumYumSimulationKillFlag != true && jobs.empty() ){
             boost::this_thread::sleep( boost::posix_time::milliseconds( YumYumPollWait ) );
             if (jobParser -> checkJobFile()) {
-                jobs = jobParser -> parseJobs(getCurrentSimTime());
+                std::vector<Job*> parsed = jobParser -> parseJobs(getCurrentSimTime());
+                for (unsigned int i = 0; i < parsed.size(); i++) {
+                    jobs[parsed[i] -> getJobNum()] = parsed[i];
+                }
                 if (!jobs.empty()) {
                     break;
                 }
@@ -378,11 +450,6 @@ void schedComponent::handleCompletionEvent(Event *ev, int node)
                 fte->forceExecute = true;
             selfLink->send(0, fte); //send back an event at the same time so we know it finished 
         }
-        if (jobNum == jobs.back()->jobNum) {
-            if (jobs.empty()) {
-                unregisterYourself();
-            }
-        }
         delete ev;
     } else {
         //If it is not a completion it is (hopefully) a fault.
@@ -427,6 +494,9 @@ void schedComponent::handleCompletionEvent(Event *ev, int node)
                 stats->jobFinishes(tmi, getCurrentSimTime() + 1);
                 scheduler->jobFinishes(tmi->job, getCurrentSimTime() + 1, *machine);
             } else {
+                if (FSTtype > 0) {
+                    calcFST -> jobCompletes(tmi->job, getCurrentSimTime());
+                }
                 stats->jobFinishes(tmi, getCurrentSimTime() );
                 scheduler->jobFinishes(tmi->job, getCurrentSimTime() , *machine);
             }
@@ -435,19 +505,13 @@ void schedComponent::handleCompletionEvent(Event *ev, int node)
             
             //its allocinfo again
             runningJobs.erase(jobNum);
+            delete jobs[jobNum];
+            jobs.erase(jobNum);
 
             startNextJob();
 
-            if (jobNum == jobs.back()->jobNum) {
-                while (!jobs.empty() && 
-                       runningJobs.find(jobs.back()->jobNum) == runningJobs.end() && 
-                       jobs.back()->hasRun == true) {
-                    delete jobs.back();
-                    jobs.pop_back();
-                }
-                if (jobs.empty()) {
-                    unregisterYourself();             // This is the one that actually does the unregistering.
-                }
+            if (jobs.empty() && traceDone) {
+                unregisterYourself();             // This is the one that actually does the unregistering.
             }
 
             delete ev;
@@ -487,13 +551,8 @@ void schedComponent::handleJobArrivalEvent(Event *ev)
                     //NetworkSim: if we could not start any job, we will still take a snapshot at t = ignoreUntilTime
                     if (doDetailedNetworkSim && !newJobsStarted && !emberRunningJobs.empty() && getCurrentSimTime() == ignoreUntilTime){
                         // find the closest job arrival time after the current time
-                        unsigned long NextArrivalTime = 0;
-                        for(int i = (jobNumLastArrived + 1); i < numJobs; i++){
-                            NextArrivalTime = jobs[i]->getArrivalTime();
-                            if (NextArrivalTime > ignoreUntilTime){
-                                break;
-                            }
-                        }
+                        unsigned long NextArrivalTime;
+                        nextArrivalAfter(ignoreUntilTime, NextArrivalTime);
                         snapshot->append(getCurrentSimTime(), NextArrivalTime, runningJobs);
                         schedout.output("Next Job is arriving at %lu\n", NextArrivalTime);
                         unregisterYourself();
@@ -506,6 +565,8 @@ void schedComponent::handleJobArrivalEvent(Event *ev)
         finishingarr.push_back(arevent);
         //NetworkSim: keep track of the last job that has arrived
         jobNumLastArrived = arevent->getJobIndex();
+        queuedArrivals--;
+        readJobs();
         
         FinalTimeEvent* fte = new FinalTimeEvent();
         if (useYumYumSimulationKill xor YumYumSimulationKillFlag) {
@@ -540,24 +601,17 @@ void schedComponent::handleJobArrivalEvent(Event *ev)
                 scheduler -> jobFinishes(tmi->job, getCurrentSimTime() + 1, *machine);
             } else {
                 if (FSTtype > 0){
-                    calcFST -> jobCompletes(tmi->job);
+                    calcFST -> jobCompletes(tmi->job, getCurrentSimTime());
                 }
                 stats -> jobFinishes(tmi, getCurrentSimTime());
                 scheduler -> jobFinishes(tmi->job, getCurrentSimTime(), *machine);
             }
             delete tmi;
+            delete jobs[finishedJobNum];
+            jobs.erase(finishedJobNum);
 
-            if (finishedJobNum == jobs.back()->jobNum) {
-                while (!jobs.empty() && 
-                       runningJobs.find(jobs.back()->jobNum) == runningJobs.end() && 
-                       jobs.back()->hasRun == true) {
-                    delete jobs.back();
-                    jobs.pop_back();
-                }
-
-                if (jobs.empty()) {
-                    unregisterYourself();
-                }
+            if (jobs.empty() && traceDone) {
+                unregisterYourself();
             }
             delete finishingcomp.front();
             finishingcomp.pop_front();
@@ -571,13 +625,13 @@ void schedComponent::handleJobArrivalEvent(Event *ev)
             Job* arrivingjob = jobs[finishingarr.front() -> getJobIndex()];
             if (FSTtype == 2) { 
                 //relaxed, so do FST before we tell the scheduler about the job
-                calcFST -> jobArrives(arrivingjob, scheduler, machine);
+                calcFST -> jobArrives(arrivingjob);
                 finishingarr.front() -> happen(*machine, theAllocator, 
                                                scheduler, stats, arrivingjob);
             } else if (FSTtype == 1){
                 finishingarr.front() -> happen(*machine, theAllocator, 
                                                scheduler, stats, arrivingjob);
-                calcFST -> jobArrives(arrivingjob, scheduler, machine);
+                calcFST -> jobArrives(arrivingjob);
             } else {
                 finishingarr.front() -> happen(*machine, theAllocator, 
                                                scheduler, stats, arrivingjob);
@@ -630,7 +684,9 @@ void schedComponent::startJob(Job* job)
         }
     }
     job->start( getCurrentSimTime() );              //job started flag
+    std::chrono::steady_clock::time_point allocStart = std::chrono::steady_clock::now();
     AllocInfo* ai = theAllocator->allocate(job);    //get allocation
+    allocTimeStat->addData(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - allocStart).count());
     TaskMapInfo* tmi = theTaskMapper->mapTasks(ai); //map tasks
     machine->allocate(tmi);                         //allocate
     scheduler->startNext(getCurrentSimTime(), *machine); //start in scheduler
@@ -703,18 +759,12 @@ void schedComponent::startJob(Job* job)
 
         schedout.output("Taking snapshot as Job %d is starting...\n", job->getJobNum());
 
-        int ii;
-        for(ii = (jobNumLastArrived + 1); ii < numJobs; ii++){
-            se->nextJobArrivalTime = jobs[ii]->getArrivalTime();
-            if (se->nextJobArrivalTime > ignoreUntilTime){
-                break;
-            }
-        }
+        Job* nextJob = nextArrivalAfter(ignoreUntilTime, se->nextJobArrivalTime);
 
-        if (ii == numJobs) {
+        if (NULL == nextJob) {
             schedout.output("All jobs have arrived!\n");
         } else {
-            schedout.output("Next Job: %d is arriving at %lu\n", jobs[ii]->getJobNum(), se->nextJobArrivalTime);
+            schedout.output("Next Job: %ld is arriving at %lu\n", nextJob->getJobNum(), se->nextJobArrivalTime);
         }
         selfLink->send(se);
         schedout.output("%lu: Sent snapshot event to self\n", getCurrentSimTime());
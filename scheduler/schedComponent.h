@@ -83,6 +83,17 @@ namespace SST {
 
                 void unregisterYourself();
 
+                //reads jobs from the trace until traceWindow arrivals are queued and the
+                //last of them is in the future, and sends their arrival events
+                void readJobs();
+                Job* readJob();   //@return NULL at the end of the trace
+
+                //NetworkSim: sets arrival to the arrival time of the first job that has not
+                //arrived yet & arrives after time, reading ahead as needed
+                //@return the job, or NULL if there is none; arrival is then that of the
+                //last job that has not arrived yet (0 if there are none)
+                Job* nextArrivalAfter(SimTime_t time, unsigned long & arrival);
+
                 void startNextJob();
                 void startJob(Job* job);
 
@@ -92,7 +103,11 @@ namespace SST {
 
                 typedef std::vector<int> targetList_t;
 
-                std::vector<Job*> jobs;
+                std::map<long, Job*> jobs;     //jobs read from the trace that have not finished, by job number
+                unsigned long traceWindow;    //arrivals to read ahead; 0 reads the whole trace in setup()
+                unsigned long queuedArrivals; //arrival events sent that have not happened
+                unsigned long lastQueuedArrival;
+                bool traceDone;               //the whole trace has been read
                 std::list<CompletionEvent*> finishingcomp;
                 std::list<ArrivalEvent*> finishingarr;
                 Machine* machine;
@@ -101,6 +116,7 @@ namespace SST {
                 Allocator* theAllocator;
                 TaskMapper* theTaskMapper;
                 Statistics* stats;
+                Statistic<uint64_t>* allocTimeStat;  //wall-clock microseconds per allocation decision
                 int FSTtype;
                 FST* calcFST;
                 std::vector<SST::Link*> nodes;
@@ -123,7 +139,6 @@ namespace SST {
                 std::map<int, std::pair<unsigned long, int> > emberRunningJobs; // The jobs that are still running on ember <jobNum, <soFarRunningTime, currentMotifCount>>
                 SimTime_t ignoreUntilTime; // Avoid taking snapshots until this time
                 int jobNumLastArrived;
-                int numJobs;
                 //end->NetworkSim
 
                 JobParser* jobParser;
@@ -112,6 +112,18 @@ static const SST::ElementInfoParam sched_params[] = {
       "Name of the simulation trace file",
       NULL
     },
+    { "traceWindow",
+      "Number of job arrivals to read ahead of the simulation; 0 reads the whole trace at setup. Streaming needs a trace sorted by arrival time",
+      "0"
+    },
+    { "traceStartTime",
+      "Jobs arriving before this time are skipped",
+      "0"
+    },
+    { "traceIndex",
+      "Binary index of the trace's line offsets & arrival times, used to seek to traceStartTime; rebuilt if missing or out of date",
+      "none"
+    },
     { "scheduler",
       "Determines when jobs are run",
       "First in first out priority queue"
@@ -129,7 +141,7 @@ static const SST::ElementInfoParam sched_params[] = {
         "Simple task mapper"
     },
     { "FST",
-      "Metric to analyze scheduler in terms of social justice",
+      "Metric to analyze scheduler in terms of social justice: none, strict or relaxed; strict[1] or relaxed[1] computes it on a background thread while the simulation goes on",
       "None"
     },
     { "timeperdistance",
@@ -271,6 +283,11 @@ static const SST::ElementInfoParam link_params[] = {
     {NULL,NULL,NULL} 
 };
 
+static const SST::ElementInfoStatistic sched_statistics[] = {
+    { "AllocationTime", "Wall-clock time the allocator takes to choose each job's nodes", "us", 1},
+    { NULL, NULL, NULL, 0 }
+};
+
 static const SST::ElementInfoComponent components[] = {
     { "schedComponent",
         "Schedules and allocates nodes for jobs from a simulation file",
@@ -278,7 +295,8 @@ static const SST::ElementInfoComponent components[] = {
         create_schedComponent,
         sched_params,
         sched_ports,
-        COMPONENT_CATEGORY_UNCATEGORIZED 
+        COMPONENT_CATEGORY_UNCATEGORIZED,
+        sched_statistics
     },
     { "nodeComponent",
         "Implements nodes for use with schedComponent",
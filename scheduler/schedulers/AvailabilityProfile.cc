@@ -0,0 +1,319 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "AvailabilityProfile.h"
+
+#include <stddef.h>
+
+#include "output.h"
+
+using namespace SST::Scheduler;
+
+const unsigned long AvailabilityProfile::INF;
+
+AvailabilityProfile::AvailabilityProfile(long initialValue)
+{
+    seed = 2463534242u;
+    count = 0;
+    root = newNode(0, initialValue);
+}
+
+AvailabilityProfile::AvailabilityProfile(const AvailabilityProfile & other)
+{
+    seed = other.seed;
+    count = other.count;
+    root = clone(other.root);
+}
+
+AvailabilityProfile::~AvailabilityProfile()
+{
+    destroy(root);
+}
+
+AvailabilityProfile::Node* AvailabilityProfile::newNode(unsigned long time, long value)
+{
+    //xorshift; the priorities only need to look random
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    Node* n = new Node();
+    n -> time = time;
+    n -> value = value;
+    n -> lazy = 0;
+    n -> min = value;
+    n -> max = value;
+    n -> priority = seed;
+    n -> left = NULL;
+    n -> right = NULL;
+    count++;
+    return n;
+}
+
+void AvailabilityProfile::apply(Node* n, long delta)
+{
+    if (n != NULL) {
+        n -> value += delta;
+        n -> lazy += delta;
+        n -> min += delta;
+        n -> max += delta;
+    }
+}
+
+void AvailabilityProfile::push(Node* n)
+{
+    if (n -> lazy != 0) {
+        apply(n -> left, n -> lazy);
+        apply(n -> right, n -> lazy);
+        n -> lazy = 0;
+    }
+}
+
+void AvailabilityProfile::update(Node* n)
+{
+    n -> min = n -> value;
+    n -> max = n -> value;
+    if (n -> left != NULL) {
+        if (n -> left -> min < n -> min) n -> min = n -> left -> min;
+        if (n -> left -> max > n -> max) n -> max = n -> left -> max;
+    }
+    if (n -> right != NULL) {
+        if (n -> right -> min < n -> min) n -> min = n -> right -> min;
+        if (n -> right -> max > n -> max) n -> max = n -> right -> max;
+    }
+}
+
+void AvailabilityProfile::split(Node* n, unsigned long time, Node*& lo, Node*& hi)
+{
+    if (n == NULL) {
+        lo = hi = NULL;
+        return;
+    }
+    push(n);
+    if (n -> time < time) {
+        split(n -> right, time, n -> right, hi);
+        lo = n;
+    } else {
+        split(n -> left, time, lo, n -> left);
+        hi = n;
+    }
+    update(n);
+}
+
+AvailabilityProfile::Node* AvailabilityProfile::merge(Node* lo, Node* hi)
+{
+    if (lo == NULL) return hi;
+    if (hi == NULL) return lo;
+    if (lo -> priority > hi -> priority) {
+        push(lo);
+        lo -> right = merge(lo -> right, hi);
+        update(lo);
+        return lo;
+    } else {
+        push(hi);
+        hi -> left = merge(lo, hi -> left);
+        update(hi);
+        return hi;
+    }
+}
+
+AvailabilityProfile::Node* AvailabilityProfile::leftmost(Node* n)
+{
+    while (n != NULL && n -> left != NULL) {
+        push(n);
+        n = n -> left;
+    }
+    if (n != NULL) push(n);
+    return n;
+}
+
+AvailabilityProfile::Node* AvailabilityProfile::rightmost(Node* n)
+{
+    while (n != NULL && n -> right != NULL) {
+        push(n);
+        n = n -> right;
+    }
+    if (n != NULL) push(n);
+    return n;
+}
+
+//earliest node in the subtree whose value is >= amount
+AvailabilityProfile::Node* AvailabilityProfile::firstAtLeast(Node* n, long amount)
+{
+    while (n != NULL && n -> max >= amount) {
+        push(n);
+        if (n -> left != NULL && n -> left -> max >= amount) {
+            n = n -> left;
+        } else if (n -> value >= amount) {
+            return n;
+        } else {
+            n = n -> right;
+        }
+    }
+    return NULL;
+}
+
+//earliest node in the subtree whose value is < amount
+AvailabilityProfile::Node* AvailabilityProfile::firstBelow(Node* n, long amount)
+{
+    while (n != NULL && n -> min < amount) {
+        push(n);
+        if (n -> left != NULL && n -> left -> min < amount) {
+            n = n -> left;
+        } else if (n -> value < amount) {
+            return n;
+        } else {
+            n = n -> right;
+        }
+    }
+    return NULL;
+}
+
+AvailabilityProfile::Node* AvailabilityProfile::clone(const Node* n)
+{
+    if (n == NULL) return NULL;
+    Node* copy = new Node(*n);
+    copy -> left = clone(n -> left);
+    copy -> right = clone(n -> right);
+    return copy;
+}
+
+int AvailabilityProfile::destroy(Node* n)
+{
+    if (n == NULL) return 0;
+    int freed = 1 + destroy(n -> left) + destroy(n -> right);
+    delete n;
+    return freed;
+}
+
+long AvailabilityProfile::valueAt(unsigned long time) const
+{
+    if (time == INF) {
+        return rightmost(root) -> value;
+    }
+    Node *lo, *hi;
+    split(root, time + 1, lo, hi);
+    if (lo == NULL) {
+        root = merge(lo, hi);
+        schedout.fatal(CALL_INFO, 1, "AvailabilityProfile queried at %lu, before the start of the profile\n", time);
+    }
+    long value = rightmost(lo) -> value;
+    root = merge(lo, hi);
+    return value;
+}
+
+void AvailabilityProfile::ensureBreakpoint(unsigned long time)
+{
+    Node *lo, *hi;
+    split(root, time, lo, hi);
+    Node* first = leftmost(hi);
+    if (first == NULL || first -> time != time) {
+        if (lo == NULL) {
+            root = merge(lo, hi);
+            schedout.fatal(CALL_INFO, 1, "AvailabilityProfile changed at %lu, before the start of the profile\n", time);
+        }
+        hi = merge(newNode(time, rightmost(lo) -> value), hi);
+    }
+    root = merge(lo, hi);
+}
+
+//a breakpoint with the same value as the one before it changes nothing
+void AvailabilityProfile::dropIfRedundant(unsigned long time)
+{
+    Node *lo, *mid, *hi;
+    split(root, time, lo, hi);
+    if (time == INF) {
+        mid = hi;
+        hi = NULL;
+    } else {
+        split(hi, time + 1, mid, hi);
+    }
+    if (mid != NULL && lo != NULL && rightmost(lo) -> value == mid -> value) {
+        count -= destroy(mid);
+        mid = NULL;
+    }
+    root = merge(lo, merge(mid, hi));
+}
+
+void AvailabilityProfile::add(unsigned long start, unsigned long end, long delta)
+{
+    if (start >= end || delta == 0) return;
+
+    ensureBreakpoint(start);
+    if (end != INF) ensureBreakpoint(end);
+
+    Node *lo, *mid, *hi;
+    split(root, start, lo, mid);
+    if (end != INF) {
+        split(mid, end, mid, hi);
+    } else {
+        hi = NULL;
+    }
+    apply(mid, delta);
+    root = merge(lo, merge(mid, hi));
+
+    dropIfRedundant(start);
+    if (end != INF) dropIfRedundant(end);
+}
+
+//first breakpoint after 'after' whose value is >= amount, or INF
+unsigned long AvailabilityProfile::nextAtLeast(unsigned long after, long amount) const
+{
+    if (after == INF) return INF;
+    Node *lo, *hi;
+    split(root, after + 1, lo, hi);
+    Node* n = firstAtLeast(hi, amount);
+    unsigned long time = (n == NULL) ? INF : n -> time;
+    root = merge(lo, hi);
+    return time;
+}
+
+unsigned long AvailabilityProfile::earliestStart(unsigned long from, long amount, unsigned long duration) const
+{
+    if (duration == 0) duration = 1;
+    unsigned long time = from;
+
+    while (true) {
+        if (valueAt(time) < amount) {
+            time = nextAtLeast(time, amount);
+            if (time == INF) return INF;
+        }
+
+        //does the value dip below amount before the job would end?
+        unsigned long end = (INF - time > duration) ? time + duration : INF;
+        Node *lo, *mid, *hi;
+        split(root, time + 1, lo, mid);
+        if (end != INF) {
+            split(mid, end, mid, hi);
+        } else {
+            hi = NULL;
+        }
+        Node* dip = firstBelow(mid, amount);
+        unsigned long dipTime = (dip == NULL) ? INF : dip -> time;
+        root = merge(lo, merge(mid, hi));
+
+        if (dip == NULL) return time;
+
+        time = nextAtLeast(dipTime, amount);
+        if (time == INF) return INF;
+    }
+}
+
+void AvailabilityProfile::discardBefore(unsigned long time)
+{
+    if (time == 0 || time == INF) return;
+    ensureBreakpoint(time);
+    Node *lo, *hi;
+    split(root, time, lo, hi);
+    count -= destroy(lo);
+    root = hi;
+}
@@ -0,0 +1,95 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * Number of free nodes over time, kept as a step function for backfilling
+ * schedulers.
+ *
+ * Each breakpoint holds the value the function has from its time up to the
+ * next breakpoint. Breakpoints live in a treap ordered by time with a lazy
+ * add and the subtree min/max, so adding a reservation over an interval,
+ * reading the value at a time, and finding the next time the value crosses
+ * a threshold are all O(log n) in the number of breakpoints. Earliest-start
+ * queries are a sequence of such crossings, one per gap they skip over.
+ */
+
+#ifndef SST_SCHEDULER_AVAILABILITYPROFILE_H__
+#define SST_SCHEDULER_AVAILABILITYPROFILE_H__
+
+#include <limits.h>
+
+namespace SST {
+    namespace Scheduler {
+
+        class AvailabilityProfile {
+            public:
+                static const unsigned long INF = ULONG_MAX;
+
+                //the function is initialValue from time 0 on
+                AvailabilityProfile(long initialValue);
+                AvailabilityProfile(const AvailabilityProfile & other);
+                ~AvailabilityProfile();
+
+                //adds delta to the value on [start, end); end may be INF
+                void add(unsigned long start, unsigned long end, long delta);
+
+                //value of the function at time
+                long valueAt(unsigned long time) const;
+
+                //earliest time >= from at which the value stays >= amount
+                //for duration time units (at least one), or INF if never
+                unsigned long earliestStart(unsigned long from, long amount, unsigned long duration) const;
+
+                //forgets the function before time; later queries must not
+                //ask about earlier times
+                void discardBefore(unsigned long time);
+
+                int numBreakpoints() const { return count; }
+
+            private:
+                struct Node {
+                    unsigned long time;
+                    long value;
+                    long lazy;     //pending add for the whole subtree
+                    long min;      //min/max of value over the subtree
+                    long max;
+                    unsigned int priority;
+                    Node* left;
+                    Node* right;
+                };
+
+                void operator=(const AvailabilityProfile &);  //do not implement
+
+                static void apply(Node* n, long delta);
+                static void push(Node* n);
+                static void update(Node* n);
+                static void split(Node* n, unsigned long time, Node*& lo, Node*& hi);  //lo < time <= hi
+                static Node* merge(Node* lo, Node* hi);
+                static Node* leftmost(Node* n);
+                static Node* rightmost(Node* n);
+                static Node* firstAtLeast(Node* n, long amount);
+                static Node* firstBelow(Node* n, long amount);
+                static Node* clone(const Node* n);
+                static int destroy(Node* n);  //returns the number of nodes freed
+
+                Node* newNode(unsigned long time, long value);
+                void ensureBreakpoint(unsigned long time);
+                void dropIfRedundant(unsigned long time);
+                unsigned long nextAtLeast(unsigned long after, long amount) const;
+
+                mutable Node* root;  //queries split and re-merge, which leaves the set unchanged
+                int count;
+                unsigned int seed;
+        };
+
+    }
+}
+#endif
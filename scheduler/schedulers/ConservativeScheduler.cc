@@ -0,0 +1,234 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "ConservativeScheduler.h"
+
+#include <math.h>
+
+#include "Job.h"
+#include "Machine.h"
+#include "output.h"
+
+using namespace std;
+using namespace SST::Scheduler;
+
+//a job with no estimated running time still holds its nodes for one unit
+static unsigned long holdLength(const Job* j)
+{
+    unsigned long length = j -> getEstimatedRunningTime();
+    return (length == 0) ? 1 : length;
+}
+
+ConservativeScheduler::ConservativeScheduler(int numNodes)
+{
+    schedout.init("", 8, 0, Output::STDOUT);
+    this -> numNodes = numNodes;
+    profile = new AvailabilityProfile(numNodes);
+}
+
+ConservativeScheduler::ConservativeScheduler(const ConservativeScheduler* insched)
+{
+    //schedout was set up when insched was built; FST copies schedulers while
+    //the original is in use, so it is not re-initialised here
+    numNodes = insched -> numNodes;
+    profile = new AvailabilityProfile(*(insched -> profile));
+    waiting = insched -> waiting;
+    byStart = insched -> byStart;
+    running = insched -> running;
+}
+
+ConservativeScheduler::~ConservativeScheduler()
+{
+    delete profile;
+}
+
+string ConservativeScheduler::getSetupInfo(bool comment)
+{
+    string com;
+    if (comment) {
+        com = "# ";
+    } else {
+        com = "";
+    }
+    return com + "Conservative Backfilling Scheduler";
+}
+
+int ConservativeScheduler::nodesNeeded(const Job* j, const Machine & mach) const
+{
+    return ceil(((float)j -> getProcsNeeded()) / mach.coresPerNode);
+}
+
+//adds delta nodes to the profile over the part of r's slot that is not
+//in the past
+void ConservativeScheduler::hold(const Reservation & r, long delta, unsigned long time)
+{
+    unsigned long start = (r.start > time) ? r.start : time;
+    if (start < r.end) {
+        profile -> add(start, r.end, delta);
+    }
+}
+
+//gives r the earliest slot from time on and takes its nodes out of the profile
+void ConservativeScheduler::reserve(Reservation & r, unsigned long time)
+{
+    unsigned long length = holdLength(r.job);
+    r.start = profile -> earliestStart(time, r.numNodes, length);
+    if (r.start == AvailabilityProfile::INF) {
+        schedout.fatal(CALL_INFO, 1, "Conservative scheduler could not make reservation for %s\n", r.job -> toString().c_str());
+    }
+    r.end = r.start + length;
+    hold(r, -r.numNodes, time);
+}
+
+void ConservativeScheduler::jobArrives(Job* j, unsigned long time, const Machine & mach)
+{
+    schedout.debug(CALL_INFO, 7, 0, "%ld: Job #%ld arrives\n", time, j -> getJobNum());
+    profile -> discardBefore(time);
+
+    Reservation r;
+    r.job = j;
+    r.numNodes = nodesNeeded(j, mach);
+    if (r.numNodes > numNodes) {
+        schedout.fatal(CALL_INFO, 1, "%s needs more nodes than the machine has\n", j -> toString().c_str());
+    }
+    reserve(r, time);
+    schedout.debug(CALL_INFO, 7, 0, "%ld: Job #%ld reserved for %lu\n", time, j -> getJobNum(), r.start);
+
+    waiting[j -> getJobNum()] = r;
+    byStart.insert(make_pair(r.start, j -> getJobNum()));
+}
+
+void ConservativeScheduler::jobFinishes(Job* j, unsigned long time, const Machine & mach)
+{
+    schedout.debug(CALL_INFO, 7, 0, "%ld: Job #%ld completes\n", time, j -> getJobNum());
+    map<long, Reservation>::iterator it = running.find(j -> getJobNum());
+    if (it == running.end()) {
+        schedout.fatal(CALL_INFO, 1, "Could not find finishing job in running list\n%s\n", j -> toString().c_str());
+    }
+    bool early = time < it -> second.end;
+    hold(it -> second, it -> second.numNodes, time);  //give back the rest of its slot
+    running.erase(it);
+
+    profile -> discardBefore(time);
+    if (early) {
+        compress(time);
+    }
+}
+
+//moves every waiting job to its earliest slot, in order of the current
+//reservations, so each is considered with only the earlier ones in place.
+//A job whose reservation is overdue (its nodes are still held by a job
+//running past its estimate) keeps it rather than being pushed behind
+//the jobs planned after it
+void ConservativeScheduler::compress(unsigned long time)
+{
+    vector<pair<unsigned long, long> > order(byStart.begin(), byStart.end());
+    for (vector<pair<unsigned long, long> >::iterator it = order.begin(); it != order.end(); it++) {
+        Reservation & r = waiting[it -> second];
+        Reservation old = r;
+        hold(r, r.numNodes, time);
+        reserve(r, time);
+        if (r.start > old.start) {
+            hold(r, r.numNodes, time);
+            r = old;
+            hold(r, -r.numNodes, time);
+        } else if (r.start != old.start) {
+            byStart.erase(*it);
+            byStart.insert(make_pair(r.start, it -> second));
+        }
+    }
+}
+
+Job* ConservativeScheduler::tryToStart(unsigned long time, const Machine & mach)
+{
+    schedout.debug(CALL_INFO, 10, 0, "trying to start at %lu\n", time);
+    nextToStart = NULL;
+
+    //a job that ran past its estimate can still hold nodes a reservation
+    //was counting on, so check the machine too
+    for (StartSet::iterator it = byStart.begin(); it != byStart.end() && it -> first <= time; it++) {
+        Reservation & r = waiting[it -> second];
+        if (mach.getNumFreeNodes() >= r.numNodes) {
+            nextToStart = r.job;
+            nextToStartTime = time;
+            break;
+        }
+    }
+    return nextToStart;
+}
+
+void ConservativeScheduler::startNext(unsigned long time, const Machine & mach)
+{
+    if (nextToStart == NULL) {
+        schedout.fatal(CALL_INFO, 1, "Called startNext() job from scheduler when there is no available Job at time %lu",
+                                      time);
+    } else if (nextToStartTime != time) {
+        schedout.fatal(CALL_INFO, 1, "startNext() and tryToStart() are called at different times for Job #%ld",
+                                      nextToStart -> getJobNum());
+    }
+
+    long jobNum = nextToStart -> getJobNum();
+    map<long, Reservation>::iterator it = waiting.find(jobNum);
+    if (it == waiting.end()) {
+        schedout.fatal(CALL_INFO, 1, "Job #%ld is not on toRun list.", jobNum);
+    }
+    Reservation r = it -> second;
+    byStart.erase(make_pair(r.start, jobNum));
+    waiting.erase(it);
+
+    schedout.debug(CALL_INFO, 7, 0, "%ld: %s starts\n", time, nextToStart -> toString().c_str());
+    bool late = r.start != time;
+    if (late) {
+        //the slot moves with the job, which frees the one the jobs
+        //behind it were planned around
+        hold(r, r.numNodes, time);
+        r.start = time;
+        r.end = time + holdLength(r.job);
+        hold(r, -r.numNodes, time);
+    }
+    r.job = NULL;
+    running[jobNum] = r;
+    nextToStart = NULL;
+
+    if (late) {
+        compress(time);
+    }
+}
+
+void ConservativeScheduler::reset()
+{
+    waiting.clear();
+    byStart.clear();
+    running.clear();
+    delete profile;
+    profile = new AvailabilityProfile(numNodes);
+}
+
+//for FST, creates an exact copy of the scheduler whose waiting jobs point
+//to the given deep copies; running jobs keep no pointer so need no fixing
+ConservativeScheduler* ConservativeScheduler::copy(std::vector<Job*>* inrunning, std::vector<Job*>* intoRun)
+{
+    map<long, Job*> copies;
+    for (vector<Job*>::iterator it = intoRun -> begin(); it != intoRun -> end(); it++) {
+        copies[(*it) -> getJobNum()] = *it;
+    }
+
+    ConservativeScheduler* newsched = new ConservativeScheduler(this);
+    for (map<long, Reservation>::iterator it = newsched -> waiting.begin(); it != newsched -> waiting.end(); it++) {
+        map<long, Job*>::iterator found = copies.find(it -> first);
+        if (found == copies.end()) {
+            schedout.fatal(CALL_INFO, 1, "Could not find deep copy for %s\nwhen copying ConservativeScheduler for FST\n", it -> second.job -> toString().c_str());
+        }
+        it -> second.job = found -> second;
+    }
+    return newsched;
+}
@@ -0,0 +1,79 @@
+// Copyright 2009-2015 Sandia Corporation. Under the terms
+// of Contract DE-AC04-94AL85000 with Sandia Corporation, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2015, Sandia Corporation
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * Conservative backfilling on an availability profile.  Every waiting job
+ * holds a reservation at the earliest time the profile has room for it for
+ * its whole estimated running time; a later job may only take a slot that
+ * leaves every earlier reservation in place.  When a job finishes early the
+ * reservations are compressed in order of their start times, so no
+ * reservation ever moves later.
+ */
+
+#ifndef SST_SCHEDULER_CONSERVATIVESCHEDULER_H__
+#define SST_SCHEDULER_CONSERVATIVESCHEDULER_H__
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AvailabilityProfile.h"
+#include "Scheduler.h"
+
+namespace SST {
+    namespace Scheduler {
+
+        class ConservativeScheduler : public Scheduler {
+            public:
+                ConservativeScheduler(int numNodes);
+                ~ConservativeScheduler();
+
+                std::string getSetupInfo(bool comment);
+
+                void jobArrives(Job* j, unsigned long time, const Machine & mach);
+                void jobFinishes(Job* j, unsigned long time, const Machine & mach);
+
+                Job* tryToStart(unsigned long time, const Machine & mach);
+                void startNext(unsigned long time, const Machine & mach);
+
+                void reset();
+
+                ConservativeScheduler* copy(std::vector<Job*>* running, std::vector<Job*>* toRun);
+
+            private:
+                struct Reservation {
+                    Job* job;             //NULL once the job is running
+                    int numNodes;
+                    unsigned long start;
+                    unsigned long end;    //estimated completion
+                };
+
+                typedef std::set<std::pair<unsigned long, long> > StartSet;  //(start, jobNum)
+
+                ConservativeScheduler(const ConservativeScheduler* insched);
+
+                int nodesNeeded(const Job* j, const Machine & mach) const;
+                void hold(const Reservation & r, long delta, unsigned long time);
+                void reserve(Reservation & r, unsigned long time);
+                void compress(unsigned long time);
+
+                int numNodes;
+                AvailabilityProfile* profile;            //free nodes over time as planned
+                std::map<long, Reservation> waiting;     //by jobNum
+                StartSet byStart;                        //waiting jobs in start order
+                std::map<long, Reservation> running;     //by jobNum
+        };
+
+    }
+}
+#endif
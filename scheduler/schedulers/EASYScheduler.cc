@@ -18,6 +18,7 @@
 #include "EASYScheduler.h"
 
 #include <functional>
+#include <map>
 #include <queue>
 #include <set>
 #include <string>
@@ -52,6 +53,7 @@ EASYScheduler::EASYScheduler(JobComparator* comp)
     RunningInfo* RIComp = new RunningInfo();
     running = new multiset<RunningInfo*, RunningInfo>(*RIComp); //don't need to pass comp because compare longs
     delete RIComp;
+    released = new AvailabilityProfile(0);
     compSetupInfo = comp -> toString();
     prevFirstJobNum = -1;
     guaranteedStart = 0;
@@ -60,10 +62,12 @@ EASYScheduler::EASYScheduler(JobComparator* comp)
 
 EASYScheduler::EASYScheduler(EASYScheduler* insched, std::set<Job*, JobComparator>* newtoRun, std::multiset<RunningInfo*, RunningInfo>* newrunning)
 { 
-    schedout.init("", 8, 0, Output::STDOUT);
+    //schedout was set up when insched was built; FST copies schedulers while
+    //the original is in use, so it is not re-initialised here
     comp = new JobComparator(insched -> comp);
     toRun = newtoRun;
     running = newrunning;
+    released = new AvailabilityProfile(*(insched -> released));
     compSetupInfo = comp -> toString();
     prevFirstJobNum = insched -> prevFirstJobNum;
     guaranteedStart = insched -> guaranteedStart;
@@ -102,16 +106,23 @@ void EASYScheduler::jobArrives(Job* j, unsigned long time, const Machine & mach)
 void EASYScheduler::jobFinishes(Job* j, unsigned long time, const Machine & mach)
 {
     schedout.debug(CALL_INFO, 7, 0, "%ld: Job #%ld completes\n", time, j -> getJobNum());
-    multiset<RunningInfo*, RunningInfo>::iterator it = running -> begin();
-    bool success = false;
-    while (!success && it != running -> end()) {  
-        if ((*it) -> jobNum == j -> getJobNum()) {
-            delete *it;
-            running -> erase(it);
-            success = true;
-            break;    
+    //a job started by startNext is keyed by its start plus estimate, so
+    //look there first before falling back to a scan
+    RunningInfo probe;
+    probe.jobNum = j -> getJobNum();
+    probe.estComp = j -> getStartTime() + j -> getEstimatedRunningTime();
+    multiset<RunningInfo*, RunningInfo>::iterator it = running -> find(&probe);
+    if (it == running -> end()) {
+        it = running -> begin();
+        while (it != running -> end() && (*it) -> jobNum != j -> getJobNum()) {
+            it++;
         }
-        it++;
+    }
+    bool success = (it != running -> end());
+    if (success) {
+        released -> add((*it) -> estComp, AvailabilityProfile::INF, -(*it) -> numNodes);
+        delete *it;
+        running -> erase(it);
     }
     if (!success) schedout.fatal(CALL_INFO, 1, "Could not find finishing job in running list\n%s\n", j -> toString().c_str());
     giveGuarantee(time, mach);
@@ -146,12 +157,7 @@ Job* EASYScheduler::tryToStart(unsigned long time, const Machine & mach)
             if (time + (*job)->getEstimatedRunningTime() <= guaranteedStart){
                 succeeded = true;
             } else {
-                int avail = availNodes;
-                multiset<RunningInfo*, RunningInfo>::iterator it  = running->begin();
-                while (it != running->end() && (*it)->estComp <= guaranteedStart) {
-                    avail += (*it)->numNodes;
-                    it++;
-                }
+                int avail = availNodes + released -> valueAt(guaranteedStart);
                 set<Job*, JobComparator>::iterator tempit = toRun->begin();
                 if (avail  - nodesNeeded >= ceil(((float)(*tempit)->getProcsNeeded()) / mach.coresPerNode) ){
                     succeeded = true;
@@ -200,6 +206,7 @@ void EASYScheduler::startNext(unsigned long time, const Machine & mach)
     started -> estComp = time + nextToStart->getEstimatedRunningTime();
     toRun -> erase(jobIt); //remove the job from toRun list
     running -> insert(started); //add to running list       
+    released -> add(started -> estComp, AvailabilityProfile::INF, started -> numNodes);
 
     if (first) { //update the guarantee if starting the first job
         giveGuarantee(time, mach);      
@@ -220,6 +227,8 @@ void EASYScheduler::reset()
 {
     toRun -> clear();
     running -> clear();
+    delete released;
+    released = new AvailabilityProfile(0);
 }
 
 //gives a guaranteed start time for a job.  The first job in the queue cannot
@@ -249,16 +258,13 @@ void EASYScheduler::giveGuarantee(unsigned long time, const Machine & mach)
         succeeded = true;
     }
 
-    int futureFree = free;
-    multiset<RunningInfo*, RunningInfo>::iterator it = running -> begin();
-
-    while (!succeeded && it != running->end()) {
-        futureFree += (*it)->numNodes;
-        if(futureFree >= size) {
-            guaranteedStart = (*it) -> estComp;
+    if (!succeeded) {
+        //first estimated completion by which enough nodes are back
+        unsigned long start = released -> earliestStart(0, size - free, 1);
+        if (start != AvailabilityProfile::INF) {
+            guaranteedStart = start;
             succeeded = true;
         }
-        it++;
     }
     if (succeeded)
     {
@@ -328,15 +334,14 @@ EASYScheduler* EASYScheduler::copy(std::vector<Job*>* inrunning, std::vector<Job
     }
 
     //replace pointers in toRun
+    map<long, Job*> copies;
+    for (vector<Job*>::iterator it = intoRun -> begin(); it != intoRun -> end(); it++) {
+        copies[(*it) -> getJobNum()] = *it;
+    }
     for (set<Job*, JobComparator, std::allocator<Job*> >::iterator it = toRun -> begin(); it != toRun -> end(); it++) {
-        bool found = false;
-        for (vector<Job*>::iterator it2 = intoRun -> begin(); !found && it2 != intoRun -> end(); it2++) {
-            if ((*it2) -> getJobNum() == (*it) -> getJobNum()) {
-                newtoRun -> insert(*it2);
-                found = true;
-            }
-        }
-        if (!found) schedout.fatal(CALL_INFO, 1, "Could not find deep copy for %s\nwhen copying EASYScheduler for FST\n", (*it) -> toString().c_str());
+        map<long, Job*>::iterator found = copies.find((*it) -> getJobNum());
+        if (found == copies.end()) schedout.fatal(CALL_INFO, 1, "Could not find deep copy for %s\nwhen copying EASYScheduler for FST\n", (*it) -> toString().c_str());
+        newtoRun -> insert(found -> second);
     } 
 
     //call the constructor and return
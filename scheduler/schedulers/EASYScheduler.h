@@ -17,6 +17,7 @@
 #include <set>
 #include <string>
 
+#include "AvailabilityProfile.h"
 #include "Scheduler.h"
 
 
@@ -59,6 +60,7 @@ namespace SST {
                         bool operator()(Job*& j1, Job*& j2);
                         bool operator()(Job* const& j1, Job* const& j2);
                         std::string toString();
+                        bool isFIFO() const { return FIFO == type; }
                         JobComparator(JobComparator* incomp) { 
                            type = incomp -> type;
                         }
@@ -95,6 +97,7 @@ namespace SST {
                 virtual ~EASYScheduler() {
                     delete toRun;
                     delete running;
+                    delete released;
                     delete comp;
                 }
 
@@ -112,6 +115,7 @@ namespace SST {
                 void reset();
 
                 EASYScheduler* copy(std::vector<Job*>* running, std::vector<Job*>* toRun);
+                bool arrivalOrdered() const { return comp -> isFIFO(); }
 
             protected:
                 //need to use a set instead of a priority queue to suppport iteration
@@ -122,6 +126,10 @@ namespace SST {
                 //completion time.  Must use multi in case jobs end at same
                 //time (careful not to erase jobs by key = finishing time)
                 std::multiset<RunningInfo*, RunningInfo>* running; 
+
+                //nodes the running jobs will have given back by each time,
+                //assuming they finish at their estimates
+                AvailabilityProfile* released;
         };
     }
 }
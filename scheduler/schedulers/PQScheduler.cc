@@ -18,6 +18,7 @@
 #include "PQScheduler.h"
 
 #include <functional>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -53,7 +54,8 @@ PQScheduler::PQScheduler(JobComparator* comp)
 //constructor only used in copy()
 PQScheduler::PQScheduler(PQScheduler* insched, priority_queue<Job*,std::vector<Job*>,JobComparator>* intoRun) 
 {
-    schedout.init("", 8, ~0, Output::STDOUT);
+    //schedout was set up when insched was built; FST copies schedulers while
+    //the original is in use, so it is not re-initialised here
     toRun = intoRun;
     compSetupInfo = insched -> compSetupInfo;
     origcomp = insched -> origcomp;
@@ -75,19 +77,20 @@ PQScheduler* PQScheduler::copy(std::vector<Job*>* inrunning, std::vector<Job*>*
         toRun -> pop();
     }
 
+    map<long, Job*> copies;
+    for (vector<Job*>::iterator it2 = intoRun -> begin(); it2 != intoRun -> end(); it2++) {
+        copies[(*it2) -> getJobNum()] = *it2;
+    }
+
     int notfound = 0;
     while (!copyToRun -> empty()) {
-        bool found = false;
         Job* it = copyToRun -> top();
         toRun -> push(it); //add the element back to toRun
         copyToRun -> pop();
-        for (vector<Job*>::iterator it2 = intoRun -> begin(); !found && it2 != intoRun -> end(); it2++) {
-            if ((*it2) -> getJobNum() == it -> getJobNum()) {
-                newtoRun -> push(*it2);
-                found = true;
-            }
-        }
-        if (!found) {
+        map<long, Job*>::iterator found = copies.find(it -> getJobNum());
+        if (found != copies.end()) {
+            newtoRun -> push(found -> second);
+        } else {
             schedout.debug(CALL_INFO, 7, 0, "Cannot find %s in toRun\n", it -> toString().c_str());
             notfound++;
         }
@@ -53,6 +53,8 @@ namespace SST {
                     delete toRun;
                 }
                 PQScheduler* copy(std::vector<Job*>* running, std::vector<Job*>* toRun);
+                bool arrivalOrdered() const { return origcomp -> isFIFO(); }
+                bool backfills() const { return false; }
 
                 class JobComparator : public std::binary_function<Job*,Job*,bool> {
                 public:
@@ -61,6 +63,7 @@ namespace SST {
                     bool operator()(Job*& j1, Job*& j2);
                     bool operator()(Job* const& j1, Job* const& j2);
                     std::string toString();
+                    bool isFIFO() const { return FIFO == type; }
 
                 private:
                     JobComparator(ComparatorType type);
@@ -96,7 +96,8 @@ StatefulScheduler::StatefulScheduler(int numprocs, StatefulScheduler::JobCompara
 //copy constructor for copy() (which is, in turn, for FST)
 StatefulScheduler::StatefulScheduler(StatefulScheduler* insched, set<SchedChange*, SCComparator>* inestSched, Manager* inheart, map<Job*, SchedChange*, StatefulScheduler::JobComparator>* inJobToEvents, const Machine & inmach) : mach(inmach)
 {
-    schedout.init("", 8, ~0, Output::STDOUT);
+    //schedout was set up when insched was built; FST copies schedulers while
+    //the original is in use, so it is not re-initialised here
     numProcs = insched -> numProcs;
     freeProcs = insched -> freeProcs;
     //if (NULL == inestSched) {
@@ -119,6 +120,16 @@ StatefulScheduler::StatefulScheduler(StatefulScheduler* insched, set<SchedChange
     sc = NULL;
 }
 
+//indexes the deep copies FST hands to copy() by job number
+static map<long, Job*> indexCopies(std::vector<Job*>* jobs)
+{
+    map<long, Job*> index;
+    for (vector<Job*>::iterator it = jobs -> begin(); it != jobs -> end(); it++) {
+        index[(*it) -> getJobNum()] = *it;
+    }
+    return index;
+}
+
 //for FST, creates an exact copy of the scheduler if running and/or toRun are
 //given. inrunning and intoRun contain (deep) copies of the jobs in
 //StatefulScheduler's estSched and toRun (i.e. heart -> backfill if it exists),
@@ -135,52 +146,49 @@ StatefulScheduler* StatefulScheduler::copy(std::vector<Job*>* inrunning, std::ve
     std::set<SchedChange*, SCComparator>* newestSched = new std::set<SchedChange*, SCComparator>(sccomp);
     map<Job*, SchedChange*, StatefulScheduler::JobComparator>* newJobToEvents = new map<Job*, SchedChange*, StatefulScheduler::JobComparator>(*(origcomp));
 
+    //jobs in estSched can be either running or can be waiting to be
+    //scheduled, so index the deep copies in both by job number (running
+    //first, as the copies are looked up in that order)
+    map<long, Job*> copies = indexCopies(intoRun);
+    for (vector<Job*>::iterator it = inrunning -> begin(); it != inrunning -> end(); it++) {
+        copies[(*it) -> getJobNum()] = *it;
+    }
+
     for (set<SchedChange*, SCComparator>::iterator it = estSched -> begin(); it != estSched -> end(); it++) {
-        bool found = false;
-        //jobs in estSched can be either running or can be waiting to be
-        //scheduled, so we must check in both inrunning and intoRun
-        for (vector<Job*>::iterator it2 = inrunning -> begin(); !found && it2 != inrunning -> end(); it2++) {
-            if ((*it2) -> getJobNum() == (*it) -> j -> getJobNum()) {
-                SchedChange* tempsc = new SchedChange(*it, mach);
-                tempsc -> j = *it2;
-                newestSched -> insert(tempsc);
-                found = true;
-            }
-        }
-        for (vector<Job*>::iterator it2 = intoRun -> begin(); !found && it2 != intoRun -> end(); it2++) {
-            if ((*it2) -> getJobNum() == (*it) -> j -> getJobNum()) {
-                SchedChange* tempsc = new SchedChange(*it, mach);
-                tempsc -> j = *it2;
-                newestSched -> insert(tempsc);
-                found = true;
-            }
-        }
-        if (!found) {
+        map<long, Job*>::iterator found = copies.find((*it) -> j -> getJobNum());
+        if (found == copies.end()) {
             printPlan();    
             schedout.output("toRun:\n");
-            for (vector<Job*>::iterator it2 = intoRun -> begin(); !found && it2 != intoRun -> end(); it2++) {
+            for (vector<Job*>::iterator it2 = intoRun -> begin(); it2 != intoRun -> end(); it2++) {
                 schedout.output("%s\n", (*it2) -> toString().c_str());
             }
             schedout.output("running:\n");
-            for (vector<Job*>::iterator it2 = inrunning -> begin(); !found && it2 != inrunning -> end(); it2++) {
+            for (vector<Job*>::iterator it2 = inrunning -> begin(); it2 != inrunning -> end(); it2++) {
                 schedout.output("%s\n", (*it2) -> toString().c_str());
             } 
             schedout.fatal(CALL_INFO, 1, "Could not find deep copy for %s\nwhen copying StatefulScheduler estSched for FST\n", (*it) -> j -> toString().c_str());
         }
+        SchedChange* tempsc = new SchedChange(*it, mach);
+        tempsc -> j = found -> second;
+        newestSched -> insert(tempsc);
     } 
+
     //now the SchedChanges in newEstSched are not pointing to their correct partner (they're pointing to the old version)
-    //we must iterate through newEstSched and fix that
+    //we must iterate through newEstSched and fix that.  Each job's first
+    //change is the one jobToEvents points to
+    map<long, SchedChange*> firstChange;
+    map<long, SchedChange*> endChange;
+    for (set<SchedChange*, SCComparator>::reverse_iterator it = newestSched -> rbegin(); it != newestSched -> rend(); it++) {
+        firstChange[(*it) -> j -> getJobNum()] = *it;
+        if ((*it) -> isEnd) {
+            endChange[(*it) -> j -> getJobNum()] = *it;
+        }
+    }
     for (set<SchedChange*, SCComparator>::iterator it = newestSched -> begin(); it != newestSched -> end(); it++) {
         if (!(*it) -> isEnd) {
             //find the corresponding SchedChange
-            bool found = false;
-            for (set<SchedChange*, SCComparator>::iterator it2 = it; !found && it2 != newestSched -> end(); it2++) {
-                if ((*it2) -> isEnd && (*it) -> j -> getJobNum() == (*it2) -> j -> getJobNum()) {
-                    found = true;
-                    (*it) -> partner = *it2;
-                }
-            }
-            if (!found) {
+            map<long, SchedChange*>::iterator partner = endChange.find((*it) -> j -> getJobNum());
+            if (partner == endChange.end()) {
                 schedout.output("plan: \n");
                 for (set<SchedChange*, SCComparator>::iterator it3 = newestSched -> begin(); it3 != newestSched -> end(); it3++) {
                     (*it3) -> print();
@@ -189,42 +197,21 @@ StatefulScheduler* StatefulScheduler::copy(std::vector<Job*>* inrunning, std::ve
                 (*it)->print();
                 schedout.fatal(CALL_INFO, 1, "Was not able to find partner\n"); 
             }
+            (*it) -> partner = partner -> second;
         }
     }
-    
 
     for (map<Job*, SchedChange*, StatefulScheduler::JobComparator>::iterator it = jobToEvents -> begin(); it != jobToEvents -> end(); it++) {
-        bool found = false;
-        for (vector<Job*>::iterator it2 = inrunning -> begin(); !found && it2 != inrunning -> end(); it2++) {
-            //schedout.output("it2jte %p\n", *it2);
-            if ((*it2) -> getJobNum() == it -> first -> getJobNum()) {
-                //make a new pair; same schedchange but different job number
-                for (set<SchedChange*, SCComparator>::iterator it3 = newestSched -> begin(); it3 != newestSched -> end(); it3++) {
-                    if ((*it3) -> j -> getJobNum() == (*it2) -> getJobNum()) {
-                        newJobToEvents -> insert(pair<Job*,SchedChange*>(*it2, *it3));
-                        found = true;
-                    }
-                }
-            }
-        }
-        for (vector<Job*>::iterator it2 = intoRun -> begin(); !found && it2 != intoRun -> end(); it2++) {
-            //schedout.output("it2jte2 %p\n", *it2);
-            //fflush(stdout);
-            if ((*it2) -> getJobNum() == it -> first -> getJobNum()) {
-                //newJobToEvents -> insert(pair<Job*,SchedChange*>(*it2, new SchedChange(it -> second)));
-                for (set<SchedChange*, SCComparator>::iterator it3 = newestSched -> begin(); it3 != newestSched -> end(); it3++) {
-                    if ((*it3) -> j -> getJobNum() == (*it2) -> getJobNum()) {
-                        newJobToEvents -> insert(pair<Job*,SchedChange*>(*it2, *it3));
-                        found = true;
-                    }
-                }
-                found = true;
-            }
-        }
-        if (!found) {
+        map<long, Job*>::iterator found = copies.find(it -> first -> getJobNum());
+        if (found == copies.end()) {
             printPlan();
             schedout.fatal(CALL_INFO, 1, "Could not find deep copy for %s\nwhen copying StatefulScheduler jobToEvents for FST\n", it -> first -> toString().c_str());
         }
+        //make a new pair; same schedchange but different job number
+        map<long, SchedChange*>::iterator sc = firstChange.find(it -> first -> getJobNum());
+        if (sc != firstChange.end()) {
+            newJobToEvents -> insert(pair<Job*,SchedChange*>(found -> second, sc -> second));
+        }
     }
 
     Manager* newheart = heart -> copy(inrunning, intoRun);
@@ -737,15 +724,14 @@ StatefulScheduler::PrioritizeCompressionManager* StatefulScheduler::PrioritizeCo
 {
     set<Job*, JobComparator>* newbackfill = new set<Job*, JobComparator>(*origcomp);
     int notfound = 0;
+    map<long, Job*> copies = indexCopies(intoRun);
     for (set<Job*, JobComparator>::iterator it = backfill -> begin(); it != backfill -> end(); it++) {
-        bool found = false;
-        for (std::vector<Job*>::iterator it2 = intoRun -> begin(); !found && it2 != intoRun -> end(); it2++) {
-            if ((*it) -> getJobNum() == (*it2) -> getJobNum()) {
-                newbackfill -> insert(*it2);
-                found = true;
-            }
+        map<long, Job*>::iterator found = copies.find((*it) -> getJobNum());
+        if (found != copies.end()) {
+            newbackfill -> insert(found -> second);
+        } else {
+            notfound++;
         }
-        if (!found) notfound++;
     }
     if (notfound > 1) schedout.fatal(CALL_INFO, 1, "Prioritize Compression Manager could not find two jobs for its new backfill in copy()");
     return new PrioritizeCompressionManager(this, newbackfill, mach);
@@ -840,15 +826,14 @@ StatefulScheduler::DelayedCompressionManager* StatefulScheduler::DelayedCompress
 {
     set<Job*, JobComparator>* newbackfill = new set<Job*, JobComparator>(*origcomp);
     int notfound = 0;
+    map<long, Job*> copies = indexCopies(intoRun);
     for (set<Job*, JobComparator>::iterator it = backfill -> begin(); it != backfill -> end(); it++) {
-        bool found = false;
-        for (std::vector<Job*>::iterator it2 = intoRun -> begin(); !found && it2 != intoRun -> end(); it2++) {
-            if ((*it) -> getJobNum() == (*it2) -> getJobNum()) {
-                newbackfill -> insert(*it2);
-                found = true;
-            }
+        map<long, Job*>::iterator found = copies.find((*it) -> getJobNum());
+        if (found != copies.end()) {
+            newbackfill -> insert(found -> second);
+        } else {
+            notfound++;
         }
-        if (!found) notfound++;
     }
     if (notfound > 1) schedout.fatal(CALL_INFO, 1, "Delayed Compression Manager could not find two jobs for its new backfill in copy()");
     return new DelayedCompressionManager(this, newbackfill, mach);
@@ -1003,15 +988,14 @@ StatefulScheduler::EvenLessManager* StatefulScheduler::EvenLessManager::copy(std
 {
     set<Job*, JobComparator>* newbackfill = new set<Job*, JobComparator>(*origcomp);
     int notfound = 0; 
+    map<long, Job*> copies = indexCopies(intoRun);
     for (set<Job*, JobComparator>::iterator it = backfill -> begin(); it != backfill -> end(); it++) {
-        bool found = false;
-        for (std::vector<Job*>::iterator it2 = intoRun -> begin(); !found && it2 != intoRun -> end(); it2++) {
-            if ((*it) -> getJobNum() == (*it2) -> getJobNum()) {
-                newbackfill -> insert(*it2);
-                found = true;
-            }
+        map<long, Job*>::iterator found = copies.find((*it) -> getJobNum());
+        if (found != copies.end()) {
+            newbackfill -> insert(found -> second);
+        } else {
+            notfound++;
         }
-        if (!found) notfound++;
     }
     if (notfound > 1) schedout.fatal(CALL_INFO, 1, "Even Less Conservative Manager could not find two jobs for its new backfill in copy()");
     EvenLessManager* ret = new EvenLessManager(this, newbackfill, mach);
@@ -1019,30 +1003,26 @@ StatefulScheduler::EvenLessManager* StatefulScheduler::EvenLessManager::copy(std
     //gJTE using the job pointer from backfill; also fill in guarantee 
     map<Job*, SchedChange*, JobComparator>* newguarJobToEvents = ret -> guarJobToEvents;
     set<SchedChange*, SCComparator>* newguarantee = ret -> guarantee;
+    map<long, Job*> backfillCopies;
+    for (set<Job*, JobComparator>::iterator it = newbackfill -> begin(); it != newbackfill -> end(); it++) {
+        backfillCopies[(*it) -> getJobNum()] = *it;
+    }
+    map<long, Job*> runningCopies = indexCopies(running);
     for (map<Job*, SchedChange*, JobComparator>::iterator it = guarJobToEvents -> begin(); it != guarJobToEvents -> end(); it++)
     {
-        bool found = false;
-        //find the job in newbackfill
-        for (set<Job*, JobComparator>::iterator it2 = newbackfill -> begin(); !found && it2 != newbackfill -> end(); it2++) {
-            if ((*it2) -> getJobNum() == it -> first -> getJobNum()) {
-                found = true;
-                SchedChange* tempsched = new SchedChange (it -> second, mach);
-                tempsched -> j = *it2;
-                newguarJobToEvents -> insert(pair<Job*, SchedChange*>(*it2, tempsched)); 
-                newguarantee -> insert(tempsched);
-                tempsched -> print();
-            }
+        //find the job in newbackfill; if it's not there it has to be in running
+        map<long, Job*>::iterator copy = backfillCopies.find(it -> first -> getJobNum());
+        bool found = copy != backfillCopies.end();
+        if (!found) {
+            copy = runningCopies.find(it -> first -> getJobNum());
+            found = copy != runningCopies.end();
         }
-        //if it's not there it has to be in running
-        for (vector<Job*>::iterator it2 = running -> begin(); !found && it2 != running -> end(); it2++) {
-            if ((*it2) -> getJobNum() == it -> first -> getJobNum()) {
-                found = true;
-                SchedChange* tempsched = new SchedChange (it -> second, mach);
-                tempsched -> j = *it2;
-                newguarJobToEvents -> insert(pair<Job*, SchedChange*>(*it2, tempsched)); 
-                newguarantee -> insert(tempsched);
-                tempsched -> print();
-            }
+        if (found) {
+            SchedChange* tempsched = new SchedChange (it -> second, mach);
+            tempsched -> j = copy -> second;
+            newguarJobToEvents -> insert(pair<Job*, SchedChange*>(copy -> second, tempsched)); 
+            newguarantee -> insert(tempsched);
+            tempsched -> print();
         }
         if (!found) schedout.fatal(CALL_INFO, 1, "Could not find %s in new backfill\n", it -> first -> toString().c_str());
     } 
@@ -26,7 +26,7 @@ numberNodes = ''
 coresPerNode = '4'
 
 # Scheduler algorithm:
-# cons, delayed, easy, elc, pqueue, prioritize. (default: pqueue)
+# cons, conservative, delayed, easy, elc, pqueue, prioritize. (default: pqueue)
 scheduler = 'easy' 
 
 # Fair start time algorithm: